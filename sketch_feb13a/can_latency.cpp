@@ -0,0 +1,166 @@
+/**
+ * can_latency.cpp — CAN 往返时延探针
+ *
+ * 每个电机同一时刻只跟踪一条未应答指令 (抽样测量, 不做 FIFO 匹配):
+ *   ACK  — 指令发出后第一个 0x02 帧 (RollerCAN 对写寄存器的应答即 0x02 反馈帧)
+ *   RESP — 指令与当前反馈电流相差 ≥ LATENCY_STEP_MA 时, 等反馈电流走过阶跃一半
+ *   READ — readParam 内部直接计时
+ * 接收时刻为软件出队时刻: 平时受控制周期 (2ms) 量化, 探针开启时 driveMotors
+ * 在发送后自旋接收最多 LATENCY_SPIN_US, 使 ACK 分辨率接近总线本身。
+ *
+ * 直方图按 1/4 倍频程分桶 (16µs 起, 约 19% 相对分辨率), 分位数取桶上沿。
+ */
+
+#include "can_latency.h"
+#include "config.h"
+
+static const int HIST_BINS = 56;
+
+struct Hist {
+  uint32_t bin[HIST_BINS];
+  uint32_t count;
+  uint32_t maxUs;
+  uint32_t lost;
+};
+
+struct Pending {
+  bool     ack;
+  uint32_t ackTxUs;
+  bool     resp;
+  uint32_t respTxUs;
+  int16_t  respFrom;
+  int32_t  respTarget;
+  int16_t  lastCur;
+};
+
+static bool    enabled = false;
+static Hist    hist[LAT_TYPES][2];
+static Pending pend[2];
+
+static inline int motorIdx(uint8_t id) {
+  return id == MOTOR_L ? 1 : 0;
+}
+
+// 1/4 倍频程桶: <16µs 归 0 号, 之后每倍频程 4 桶
+static int binOf(uint32_t us) {
+  if (us < 16)
+    return 0;
+  int o = 31 - __builtin_clz(us);
+  int sub = (us >> (o - 2)) & 3;
+  int b = (o - 4) * 4 + sub + 1;
+  return b < HIST_BINS ? b : HIST_BINS - 1;
+}
+
+static uint32_t binUpper(int b) {
+  if (b == 0)
+    return 16;
+  int o = (b - 1) / 4 + 4;
+  int sub = (b - 1) % 4;
+  return (uint32_t)(5 + sub) << (o - 2);
+}
+
+static uint32_t percentile(const Hist &h, float q) {
+  if (h.count == 0)
+    return 0;
+  uint32_t rank = (uint32_t)ceilf(q * h.count);
+  uint32_t acc = 0;
+  for (int b = 0; b < HIST_BINS; b++) {
+    acc += h.bin[b];
+    if (acc >= rank)
+      return min(binUpper(b), h.maxUs);
+  }
+  return h.maxUs;
+}
+
+void latencyProbeEnable(bool on) {
+  if (on) {
+    memset(hist, 0, sizeof(hist));
+    memset(pend, 0, sizeof(pend));
+  }
+  enabled = on;
+}
+
+bool latencyProbeEnabled() {
+  return enabled;
+}
+
+void latencyRecord(int type, uint8_t id, uint32_t us) {
+  if (!enabled || type < 0 || type >= LAT_TYPES)
+    return;
+  Hist &h = hist[type][motorIdx(id)];
+  h.bin[binOf(us)]++;
+  h.count++;
+  if (us > h.maxUs)
+    h.maxUs = us;
+}
+
+void latencyRecordLost(int type, uint8_t id) {
+  if (!enabled || type < 0 || type >= LAT_TYPES)
+    return;
+  hist[type][motorIdx(id)].lost++;
+}
+
+void latencyOnCurrentTx(uint8_t id, int32_t mA) {
+  if (!enabled)
+    return;
+  Pending &p = pend[motorIdx(id)];
+  uint32_t now = micros();
+
+  if (p.ack && (now - p.ackTxUs) > LATENCY_TIMEOUT_US) {
+    p.ack = false;
+    latencyRecordLost(LAT_ACK, id);
+  }
+  if (!p.ack) {
+    p.ack = true;
+    p.ackTxUs = now;
+  }
+
+  if (p.resp && (now - p.respTxUs) > LATENCY_RESP_TIMEOUT_US) {
+    p.resp = false;
+    latencyRecordLost(LAT_RESP, id);
+  }
+  if (!p.resp && abs(mA - p.lastCur) >= LATENCY_STEP_MA) {
+    p.resp = true;
+    p.respTxUs = now;
+    p.respFrom = p.lastCur;
+    p.respTarget = mA;
+  }
+}
+
+void latencyOnFeedback(uint8_t id, int16_t curMa) {
+  if (!enabled)
+    return;
+  Pending &p = pend[motorIdx(id)];
+  uint32_t now = micros();
+  p.lastCur = curMa;
+
+  if (p.ack) {
+    p.ack = false;
+    latencyRecord(LAT_ACK, id, now - p.ackTxUs);
+  }
+  if (p.resp) {
+    int32_t step = p.respTarget - p.respFrom;
+    int32_t moved = (int32_t)curMa - p.respFrom;
+    if ((step > 0 ? moved : -moved) * 2 >= abs(step)) {
+      p.resp = false;
+      latencyRecord(LAT_RESP, id, now - p.respTxUs);
+    }
+  }
+}
+
+bool latencyAwaitingAck() {
+  return enabled && (pend[0].ack || pend[1].ack);
+}
+
+LatencyStats latencyStats(int type, uint8_t id) {
+  LatencyStats s = {};
+  if (type < 0 || type >= LAT_TYPES)
+    return s;
+  const Hist &h = hist[type][motorIdx(id)];
+  s.count = h.count;
+  s.p50Us = percentile(h, 0.50f);
+  s.p99Us = percentile(h, 0.99f);
+  s.maxUs = h.maxUs;
+  s.lost = h.lost;
+  return s;
+}
@@ -0,0 +1,34 @@
+#pragma once
+/**
+ * can_latency.h — CAN 往返时延探针: 指令发出 → 0x02 应答 / 电流响应, readParam 请求 → 读回
+ */
+
+#include <Arduino.h>
+
+#define LAT_ACK   0  // setMotorCurrent 发出 → 首个 0x02 应答帧
+#define LAT_RESP  1  // setMotorCurrent 发出 → 反馈电流走过指令阶跃的一半
+#define LAT_READ  2  // readParam 请求 → 匹配的读回帧
+#define LAT_TYPES 3
+
+struct LatencyStats {
+  uint32_t count;
+  uint32_t p50Us;
+  uint32_t p99Us;
+  uint32_t maxUs;
+  uint32_t lost;  // 超时未匹配
+};
+
+// 开启时清空直方图; 关闭时探针钩子全部直通
+void latencyProbeEnable(bool on);
+bool latencyProbeEnabled();
+
+// can_motor.cpp 钩子 (id 为电机 CAN ID, 电流为电机坐标 mA)
+void latencyOnCurrentTx(uint8_t id, int32_t mA);
+void latencyOnFeedback(uint8_t id, int16_t curMa);
+void latencyRecord(int type, uint8_t id, uint32_t us);
+void latencyRecordLost(int type, uint8_t id);
+
+// 是否有等待应答的电流指令 (探针开启时 driveMotors 据此短时自旋接收)
+bool latencyAwaitingAck();
+
+LatencyStats latencyStats(int type, uint8_t id);
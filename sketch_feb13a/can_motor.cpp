@@ -3,10 +3,15 @@
  */
 
 #include "can_motor.h"
+#include "can_latency.h"
 #include "config.h"
 #include "driver/gpio.h"
 #include "driver/twai.h"
 #include "globals.h"
+#include "motor_regs.h"
+#include "power_mgmt.h"
+#include "profiler.h"
+#include "thermal_model.h"
 
 // ============ 轮询状态 ============
 static int motorReadIdx = 0;
@@ -15,7 +20,10 @@ static const uint8_t FEEDBACK_CMD = 0x02;
 static void parseFeedback(const twai_message_t *rx);
 static int gMotorMode = MODE_SPEED;
 static unsigned long lastFeedbackMsR = 0, lastFeedbackMsL = 0;
+static uint32_t feedbackFramesR = 0, feedbackFramesL = 0;
 static const unsigned long FEEDBACK_STALE_MS = 20;
+static volatile bool outputLocked = false;   // 安全监督已切断输出
+static unsigned long bootOffMs = 0;          // 上电后发出 CMD_OFF 的时刻
 
 // ============ CAN 底层 ============
 static bool canSend(uint8_t id, uint8_t cmd, uint16_t opt, uint8_t *d, int txTimeoutMs = 5) {
@@ -70,6 +78,21 @@ void canInit() {
   twai_filter_config_t f = TWAI_FILTER_CONFIG_ACCEPT_ALL();
   twai_driver_install(&g, &t, &f);
   twai_start();
+
+  // 复位后第一件事: CMD_OFF + 电流/速度设定点清零 (不等应答)。RollerCAN 没有通信超时,
+  // 控制器崩溃/看门狗复位前的电流指令一直保持, 到这里才被切断。
+  uint8_t ids[] = {MOTOR_R, MOTOR_L};
+  uint8_t d[8] = {};
+  for (int i = 0; i < 2; i++)
+    canSend(ids[i], CMD_OFF, 0, d, SUP_CAN_TX_TIMEOUT_MS);
+  const uint16_t regs[] = {REG_CURRENT, REG_SPEED};
+  for (int r = 0; r < 2; r++) {
+    d[0] = regs[r] & 0xFF;
+    d[1] = (regs[r] >> 8) & 0xFF;
+    for (int i = 0; i < 2; i++)
+      canSend(ids[i], CMD_WRITE, 0, d, SUP_CAN_TX_TIMEOUT_MS);
+  }
+  bootOffMs = millis();
   delay(500);
   flushCAN();
 }
@@ -82,6 +105,7 @@ int32_t readParam(uint8_t id, uint16_t reg) {
   if (!canSend(id, CMD_READ, 0, d, 10))
     return -99999;
 
+  uint32_t startUs = micros();
   unsigned long startMs = millis();
   while ((int)(millis() - startMs) < READ_TIMEOUT_MS) {
     twai_message_t rx;
@@ -105,9 +129,13 @@ int32_t readParam(uint8_t id, uint16_t reg) {
     if (rxMotorId != id || rxReg != reg)
       continue;
 
-    return (int32_t)rx.data[4] | ((int32_t)rx.data[5] << 8) |
-           ((int32_t)rx.data[6] << 16) | ((int32_t)rx.data[7] << 24);
+    latencyRecord(LAT_READ, id, micros() - startUs);
+    int32_t val = (int32_t)rx.data[4] | ((int32_t)rx.data[5] << 8) |
+                  ((int32_t)rx.data[6] << 16) | ((int32_t)rx.data[7] << 24);
+    motorRegsNote(id, reg, val);
+    return val;
   }
+  latencyRecordLost(LAT_READ, id);
   return -99999;
 }
 
@@ -121,20 +149,23 @@ bool writeParam(uint8_t id, uint16_t reg, int32_t val) {
   d[7] = (val >> 24) & 0xFF;
   if (!canSend(id, CMD_WRITE, 0, d, 10))
     return false;
+  motorRegsNote(id, reg, val);
   twai_message_t rx;
   canRecv(&rx, 20);
   return true;
 }
 
 void flushCAN() {
+  // 清空接收队列, 其中的反馈帧仍然解析 (保持反馈新鲜度与时延探针匹配)
   twai_message_t rx;
   while (twai_receive(&rx, pdMS_TO_TICKS(1)) == ESP_OK) {
+    parseFeedback(&rx);
   }
 }
 
 // ============ 0x02 反馈帧解析 ============
 // 应答帧 ID: bit28-24=0x02, bit15-8=电机CAN ID; 数据: Byte0-1 速度RPM, 2-3
-// 位置°, 4-5 电流mA, 6-7 电压V
+// 位置°, 4-5 电流mA, 6-7 电压 (V×100, 与 REG_VIN 同比例)
 static void parseFeedback(const twai_message_t *rx) {
   if (!isExtFrame(rx))
     return;
@@ -164,16 +195,19 @@ static void parseFeedback(const twai_message_t *rx) {
     actualSpdR = spd;
     actualPosR = (float)pos;
     actualCurrentR = (float)cur;
-    vinR = (float)vol;
+    vinR = vol / 100.0f;
     lastFeedbackMsR = nowMs;
+    feedbackFramesR++;
   } else if (motorId == MOTOR_L) {
     actualSpeedL = (float)spd;
     actualSpdL = spd;
     actualPosL = (float)pos;
     actualCurrentL = (float)cur;
-    vinL = (float)vol;
+    vinL = vol / 100.0f;
     lastFeedbackMsL = nowMs;
+    feedbackFramesL++;
   }
+  latencyOnFeedback(motorId, cur);
 }
 
 // ============ 电机控制 ============
@@ -187,6 +221,8 @@ void setMotorOutput(uint8_t id, bool on) {
 
 void setMotorSpeed(uint8_t id, int32_t rpm) {
   uint8_t d[8] = {};
+  if (outputLocked)
+    rpm = 0;
   int32_t val = rpm * 100;
   d[0] = REG_SPEED & 0xFF;
   d[1] = (REG_SPEED >> 8) & 0xFF;
@@ -213,6 +249,8 @@ static void setMotorSpeedReliable(uint8_t id, int32_t rpm) {
 
 void setMotorCurrent(uint8_t id, int32_t mA) {
   uint8_t d[8] = {};
+  if (outputLocked)
+    mA = 0;
   int32_t val = mA * 100;
   d[0] = REG_CURRENT & 0xFF;
   d[1] = (REG_CURRENT >> 8) & 0xFF;
@@ -223,9 +261,13 @@ void setMotorCurrent(uint8_t id, int32_t mA) {
   // 非阻塞: 500Hz(2ms)周期容不下阻塞等待, 队列满时丢帧而非卡死控制环
   if (!canSend(id, CMD_WRITE, 0, d, 0))
     canTxFailCount++;
+  else
+    latencyOnCurrentTx(id, mA);
 }
 
 void setMotorPosition(uint8_t id, int32_t deg_x100) {
+  if (outputLocked)
+    return;
   uint8_t d[8] = {};
   d[0] = REG_POSITION & 0xFF;
   d[1] = (REG_POSITION >> 8) & 0xFF;
@@ -272,27 +314,72 @@ int getMotorMode() {
   return gMotorMode;
 }
 
+static void refreshFeedback();
+
+// 时延探针开启时: 发送后短时自旋接收, 让应答帧在到达时即被解析打时间戳
+static void latencySpin() {
+  if (!latencyProbeEnabled())
+    return;
+  uint32_t startUs = micros();
+  twai_message_t rx;
+  while (latencyAwaitingAck() && (micros() - startUs) < LATENCY_SPIN_US) {
+    if (twai_receive(&rx, 0) == ESP_OK)
+      parseFeedback(&rx);
+  }
+}
+
 // 统一处理接收缓冲区中的所有反馈帧 (非阻塞)
 static void processAllFeedback() {
   twai_message_t rx;
   // 循环读取直到缓冲区空, 超时设为 0 (非阻塞)
+  PROF_BEGIN(PROF_CAN_RX);
   while (twai_receive(&rx, 0) == ESP_OK) {
     parseFeedback(&rx);
   }
+  PROF_END(PROF_CAN_RX);
 }
 
 void driveMotors(int outR, int outL) {
   // 发送指令 (非阻塞). 平衡默认速度模式; 其余模式用于实验扩展。
+  PROF_BEGIN(PROF_CAN_TX);
   if (gMotorMode == MODE_CURRENT) {
-    int curR = (int)constrain(outR * CURRENT_MODE_GAIN_MA_PER_RPM, -(float)CURRENT_MODE_LIMIT_MA, (float)CURRENT_MODE_LIMIT_MA);
-    int curL = (int)constrain(outL * CURRENT_MODE_GAIN_MA_PER_RPM, -(float)CURRENT_MODE_LIMIT_MA, (float)CURRENT_MODE_LIMIT_MA);
+    // 电压补偿 → 单电机热限流 (I²t/绕组温度) → 两电机合计预算 (防止 1A 脉冲拉垮母线)
+    float gain = CURRENT_MODE_GAIN_MA_PER_RPM * powerCompGain();
+    float limR = (float)thermalLimitMa(THERMAL_R);
+    float limL = (float)thermalLimitMa(THERMAL_L);
+    int curR = (int)constrain(outR * gain, -limR, limR);
+    int curL = (int)constrain(outL * gain, -limL, limL);
+    powerApplyBudget(&curR, &curL);
     setMotorCurrent(MOTOR_R, curR * DIR_R);
     setMotorCurrent(MOTOR_L, curL * DIR_L);
+    latencySpin();
   } else {
     setMotorSpeed(MOTOR_R, outR * DIR_R);
     setMotorSpeed(MOTOR_L, outL * DIR_L);
   }
+  PROF_END(PROF_CAN_TX);
+  refreshFeedback();
+}
 
+void driveMotorsRaw(int cmdR, int cmdL) {
+  // 架空轮辨识: 跳过 RPM→mA 映射/电压补偿/电流预算, 仍受热模型限流保护
+  if (gMotorMode == MODE_CURRENT) {
+    int limR = thermalLimitMa(THERMAL_R);
+    int limL = thermalLimitMa(THERMAL_L);
+    setMotorCurrent(MOTOR_R, constrain(cmdR, -limR, limR) * DIR_R);
+    setMotorCurrent(MOTOR_L, constrain(cmdL, -limL, limL) * DIR_L);
+  } else {
+    setMotorSpeed(MOTOR_R, cmdR * DIR_R);
+    setMotorSpeed(MOTOR_L, cmdL * DIR_L);
+  }
+  refreshFeedback();
+}
+
+uint32_t motorFeedbackFrames(uint8_t id) {
+  return id == MOTOR_R ? feedbackFramesR : feedbackFramesL;
+}
+
+static void refreshFeedback() {
   // 集中处理反馈 (非阻塞)
   processAllFeedback();
 
@@ -330,6 +417,47 @@ void stopMotors() {
   flushCAN();
 }
 
+// ============ 安全监督保留路径 ============
+// 由 supervisor 任务 (核 0) 调用, 不读任何应答帧 (接收队列归控制环所有)。
+// 先置锁再清队列: 控制环此后入队的指令已被钳为 0, 队列里残留的旧电流帧被丢弃。
+void motorsEmergencyOff() {
+  outputLocked = true;
+  twai_clear_transmit_queue();
+  uint8_t ids[] = {MOTOR_R, MOTOR_L};
+  const uint16_t reg = (gMotorMode == MODE_CURRENT) ? REG_CURRENT : REG_SPEED;
+  uint8_t d[8] = {};
+  d[0] = reg & 0xFF;
+  d[1] = (reg >> 8) & 0xFF;   // 值字节 4..7 = 0
+  for (int i = 0; i < 2; i++)
+    canSend(ids[i], CMD_WRITE, 0, d, SUP_CAN_TX_TIMEOUT_MS);
+  memset(d, 0, sizeof(d));
+  for (int i = 0; i < 2; i++)
+    canSend(ids[i], CMD_OFF, 0, d, SUP_CAN_TX_TIMEOUT_MS);
+}
+
+void motorsUnlockOutput() {
+  if (!outputLocked)
+    return;
+  uint8_t ids[] = {MOTOR_R, MOTOR_L};
+  for (int i = 0; i < 2; i++) {
+    setMotorCurrent(ids[i], 0);   // 仍处于锁定, 发送 0
+    delay(10);
+  }
+  outputLocked = false;
+  for (int i = 0; i < 2; i++) {
+    setMotorOutput(ids[i], true);  // CMD_ON: 设定点已为 0
+    delay(20);
+  }
+}
+
+bool motorsOutputLocked() {
+  return outputLocked;
+}
+
+unsigned long motorsBootOffMs() {
+  return bootOffMs;
+}
+
 // ============ 扫描 + 初始化电机 ============
 bool motorsInit() {
   int32_t vr = readParam(MOTOR_R, REG_VIN);
@@ -390,14 +518,18 @@ void motorsPollParams() {
   }
   case 2: {
     int32_t v = readParam(MOTOR_R, REG_TEMP);
-    if (v != -99999)
+    if (v != -99999) {
       motorTempR = (float)v;
+      thermalCalibrate(THERMAL_R, motorTempR);
+    }
     break;
   }
   case 3: {
     int32_t v = readParam(MOTOR_L, REG_TEMP);
-    if (v != -99999)
+    if (v != -99999) {
       motorTempL = (float)v;
+      thermalCalibrate(THERMAL_L, motorTempL);
+    }
     break;
   }
   case 4: {
@@ -23,8 +23,21 @@ void setMotorSpeedLoopGains(int32_t kp_reg, int32_t ki_reg, int32_t kd_reg);
 void setMotorSpeedCurrentLimit(int32_t mA);
 int  getMotorMode();
 void driveMotors(int outR, int outL);  // 速度模式: 参数单位 RPM
+void driveMotorsRaw(int cmdR, int cmdL); // 原始指令: 电流模式 mA / 速度模式 RPM (架空轮辨识用)
 void stopMotors();
 
+// 安全监督保留路径 (可在任意核调用): 锁定输出 → 清空发送队列 → 零电流 + CMD_OFF。
+// 锁定期间所有电流/速度/位置指令按 0 发送, 直到 motorsUnlockOutput() 重新 CMD_ON。
+void motorsEmergencyOff();
+void motorsUnlockOutput();
+bool motorsOutputLocked();
+
+// canInit() 发出上电 CMD_OFF 的时刻 (ms, 复位到断力矩的启动段耗时)
+unsigned long motorsBootOffMs();
+
+// 已解析的 0x02 反馈帧计数 (判断本周期是否有新反馈)
+uint32_t motorFeedbackFrames(uint8_t id);
+
 // 扫描并初始化两个电机, 返回 true 表示全部OK
 bool motorsInit();
 
@@ -75,6 +75,11 @@
 #define INTEGRAL_DECAY_THRESHOLD 2.0f  // |error|>此值时积分开始衰减, 大扰动时让P+D主导
 #define INTEGRAL_DECAY_RATE      0.98f // 大误差时每周期积分衰减 (~100ms τ, 500Hz等效)
 #define D_LIMIT        300.0f // D 项最大贡献 (RPM), 与 OUTPUT_LIMIT 一致, 保证D项充分制动
+#define KP_MAX         100.0f // 在线调参上限 (P 命令 / 参数接口)
+#define KI_MAX         50.0f
+#define KD_MAX         20.0f
+#define SPEED_IL_MIN_MA 200   // 速度模式限流可设范围 (mA)
+#define SPEED_IL_MAX_MA 3000
 
 // ============ 位置+速度环 (防漂移, 修正目标角度) ============
 #define POSITION_K           0.004f  // 位置→目标角修正 (度/mm), 软弹簧防过冲
@@ -89,6 +94,11 @@
 #define STEER_GAIN         0.15f   // phoneX(-100~100) -> steer RPM, max +-15 RPM
 #define MOVE_INPUT_LPF     0.96f   // 移动输入低通 (~50ms τ, 500Hz等效)
 #define STEER_INPUT_LPF    0.94f   // 转向输入低通 (~30ms τ, 500Hz等效)
+#define JOY_TIMEOUT_MS     300     // 摇杆超时: 超过此时间无新包即衰减到 0 (JT,ms 可改)
+#define JOY_TIMEOUT_MIN_MS 100
+#define JOY_TIMEOUT_MAX_MS 2000
+#define JOY_DECAY_TAU_S    0.15f   // 超时后指数衰减时间常数 (s)
+#define JOY_INTERP_MAX_MS  100     // 样本间线性插值时长上限 (ms)
 
 // ============ IMU / 姿态 (6轴互补滤波, 无需校准) ============
 // 实测: 竖直raw=+90°, 前倾极限raw=+77°(-13°), 后仰极限raw=+105°(+15°)
@@ -100,6 +110,26 @@
 #define FALL_CONFIRM_COUNT 8   // 8×2ms=16ms确认窗口 (500Hz等效, 从200Hz的3×5ms=15ms转换)
 #define STANDUP_MAX_ANGLE 17.0f  // 直接自立: 前倾极限-13°/后仰+15°, ±2°余量 → 最大17°
 
+// ============ 倒立摆线性模型 (跌倒预测 / 自立规划共用) ============
+// θ'' = ω0²·(θ - I/G), 由 tools/standup_planner.py 从轮-车身耦合模型线性化得到
+// (总重 838g, 重心 60mm, 轮径 85mm, Kt 0.070N·m/A)。电机力矩同时反推车身并加速底盘,
+// 两者都使车身回正, 等效 G 约为只算静力矩 (66mA/°) 的一半
+#define PEND_OMEGA0            15.8f  // 固有角频率 (rad/s)
+#define PEND_GRAVITY_MA_PER_DEG 24.9f // 抵消 1° 倾角需要的单电机电流 (mA/°)
+
+// ============ 相平面跌倒预测 (电流模式, 恢复保护期外) ============
+// 捕获条件 |θ + ω·(1/ω0 + τ)| < Imax/G; 越界且电流已饱和 → 斜坡降力矩后进入跌倒
+#define FP_ENABLE            1       // 0 = 只计算裕度, 不提前判定
+#define FP_LATENCY_S         0.006f  // 指令→力矩时延 (s, CAN + 电流环)
+#define FP_SAT_LEVEL         0.9f    // 电流指令 ≥ 上限×此值 计为饱和
+#define FP_SAT_ALPHA         0.1f    // 饱和比例指数平均 (~20ms τ, 500Hz)
+#define FP_SAT_MIN           0.5f    // 越界时要求的近期饱和比例
+#define FP_MARGIN_SOFT_DEG   2.5f    // 越界判定带宽 (°): 吸收 ω0/G/时延的模型误差
+#define FP_MARGIN_HARD_DEG   4.0f    // 深度越界 (°): 不看饱和历史直接判定
+#define FP_CONFIRM_TICKS     3       // 连续越界拍数 (6ms)
+#define FP_RAMP_MS           100     // 判定后力矩线性降到 0 的时长
+#define FP_OBSERVE_MS        500     // 判定后观察旧判据成立的窗口 (算提前量)
+
 // ============ 启动安全门限 (直接自立) ============
 // 按下 Stand 时: 若 pitch 在 ±STANDUP_MAX_ANGLE 内且角速度小、连续几拍静止即可启动
 #define GYRO_START_THRESHOLD  8.0f   // 启动门限: pitch 轴角速度 (°/s)
@@ -109,16 +139,102 @@
 #define SOFT_START_MS  100           // 斜坡时长 (ms)
 
 // ============ 极限角度恢复模式 ============
-// 从支架极限角度启动时, 使用更强PID全力回正, 回到安全区后切换回正常参数
-#define RECOVERY_KP          20.0f  // 恢复模式 Kp: 全力拉回
-#define RECOVERY_KD          4.0f   // 恢复模式 Kd: 强阻尼防止回正过冲
+// 从支架极限角度启动时暂时抑制跌倒检测; 大角度下的增益由增益调度表给出
+#define RECOVERY_KP          20.0f  // 恢复 Kp: 调度表大角度单元默认倍率 = RECOVERY_KP/DEFAULT_KP
+#define RECOVERY_KD          4.0f   // 恢复 Kd: 调度表大角度单元默认倍率 = RECOVERY_KD/DEFAULT_KD
 #define RECOVERY_ENTER_ANGLE 8.0f   // 恢复模式进入: 启动时|pitch|>此值即用恢复模式(覆盖前倾-12°)
 #define RECOVERY_EXIT_ANGLE  5.0f   // 恢复模式退出: |pitch|<此值后切换回正常PID
 #define STANDUP_GRACE_MS     800    // 保护期时长 (ms, 恢复期间不判跌倒)
 
-// ============ 温度保护 ============
-// 电机温度超过此值开始线性降额，最低保留 30% 输出
-#define TEMP_THROTTLE_DEG  55.0f     // 降额起始温度 (°C)
+// ============ 支架自立轨迹 (离线规划表 standup_profile.cpp) ============
+// 从支架启动时按 tools/standup_planner.py 规划的时间最优电流曲线起身, 到表末
+// (PID 指令与表电流匹配的状态) 交给平衡 PID; 跟踪失败时退回上面的恢复增益
+#define SU_ENABLE            1      // 0 = 只用恢复增益 (运行时也可用 SU,0/1 切换做对比)
+#define SU_PLAN_LIMIT_MA     800    // 规划用电流 (mA), 到 CURRENT_MODE_LIMIT_MA 的余量留给跟踪反馈
+#define SU_MATCH_MA          100    // 交接点 PID 指令与表电流之差上限 (mA, 规划用)
+#define SU_START_TOL_DEG     2.0f   // 启动角与表起点之差上限 (°), 超出则用恢复增益
+#define SU_ABORT_DEG         3.0f   // 跟踪误差上限 (°), 超出中止并交给恢复增益
+#define SU_UPRIGHT_DEG       2.0f   // 站稳判定: |pitch| < 此值
+#define SU_UPRIGHT_DPS       20.0f  //           且 |角速度| < 此值 (°/s)
+#define SU_UPRIGHT_HOLD_MS   50     //           持续此时长
+#define SU_OBSERVE_MS        1500   // 自立计时窗口 (ms), 超时未站稳报 -1
+
+// ============ 轨迹跟踪 (TV 定时 v/ω 点 / TW 航点, 平衡之上的速度 + 航向闭环) ============
+// 参考速度经位置+速度环移动锚点/零点, 航向由差速里程计闭环; 摇杆输入即中止
+#define MC_QUEUE_LEN         32      // 轨迹队列长度 (TV/TW 条目)
+#define MC_TRACK_MM          120.0f  // 轮距 (mm, 估计值): 差速里程计 + 角速度前馈
+#define MC_MAX_SPEED_MMS     500.0f  // 参考线速度上限 (mm/s)
+#define MC_MAX_ACCEL_MMS2    600.0f  // 参考线加速度上限 (mm/s²)
+#define MC_MAX_YAW_DPS       180.0f  // 参考角速度上限 (°/s)
+#define MC_MAX_YAW_ACCEL_DPS2 720.0f // 参考角加速度上限 (°/s²)
+#define MC_ACCEL_FF_GAIN     1.0f    // 加速度前馈: 目标角偏 atan(a/g) × 此倍率
+#define MC_YAW_KP            0.5f    // 航向误差 → 转向 (RPM/°)
+#define MC_XTRACK_K          0.1f    // 横向误差 → 航向修正 (°/mm)
+#define MC_XTRACK_MAX_DEG    30.0f   // 横向修正上限 (°)
+#define MC_STEER_LIMIT       20.0f   // 航向反馈转向上限 (RPM, 摇杆满舵 15)
+#define MC_WP_TURN_K         3.0f    // 航点: 方位误差 → 参考角速度 (1/s)
+#define MC_WP_TOL_MM         30.0f   // 到达航点半径 (mm)
+#define MC_ABORT_MM          300.0f  // 沿程/横向误差超过此值中止 (被推走/打滑)
+#define MC_REPORT_MS         50      // TE 跟踪误差上报周期 (ms)
+
+// ============ 增益调度 (|pitch| × |线速度| × Vin 三维插值) ============
+// 表中存放 Kp/Kd 倍率 (相对当前 Kp/Kd), 每拍三线性插值; 可经 WebSocket 上传并存入 NVS
+#define GS_PITCH_N      4        // |pitch| 轴: 0, 5, 10, 15°
+#define GS_PITCH_STEP   5.0f
+#define GS_SPEED_N      3        // |线速度| 轴: 0, 250, 500 mm/s
+#define GS_SPEED_STEP   250.0f
+#define GS_VIN_N        3        // 母线电压轴: 9, 12, 15 V (PwrCAN 下限 9V, RollerCAN 上限 16V)
+#define GS_VIN_MIN      9.0f
+#define GS_VIN_STEP     3.0f
+#define GS_VIN_NOMINAL  12.0f    // 尚无电压读数时按此值查表
+#define GS_MUL_MAX      5.0f     // 单元倍率上限 (上传校验)
+
+// ============ 电源管理 (母线电压 / 内阻 / SOC / 电流预算) ============
+#define BATT_FULL_V            12.6f  // 满电开路电压 (3S 锂电 4.2V/cell)
+#define BATT_EMPTY_V           9.9f   // 放空开路电压 (3.3V/cell)
+#define BUS_NOMINAL_V          12.0f  // 电流补偿参考电压: 低于此值按比例放大电流指令
+#define POWER_COMP_MAX         1.15f  // 电压补偿倍率上限
+#define BROWNOUT_V             9.0f   // 欠压线: PwrCAN 最低工作电压
+#define BROWNOUT_MARGIN_V      0.6f   // 预测满载压降距欠压线小于此值即告警/收紧预算
+#define POWER_TOTAL_BUDGET_MA  1600   // 两电机合计电流上限 (mA), 单电机仍受 CURRENT_MODE_LIMIT_MA 限制
+#define POWER_MIN_BUDGET_MA    400    // 欠压收紧后的预算下限 (mA), 保证仍能维持平衡
+#define RINT_DEFAULT_OHM       0.25f  // 内阻初值 (Ω), 之后由 V-I 回归在线估计
+#define RINT_EST_ALPHA         0.999f // 内阻回归遗忘因子 (~1s τ, 500Hz等效)
+#define VBUS_MIN_WINDOW_MS     500    // 最低电压统计窗口 (ms): 报告值覆盖最近 1~2 个窗口
+#define SOC_LOW_PCT            20.0f  // 低电量告警阈值 (%)
+
+// ============ 电机热模型 (I²t + 一阶绕组温升, 取代按芯片温度线性降额) ============
+// 每拍由 0x02 反馈电流推算绕组温度; REG_TEMP 读数 (倒地/诊断时轮询) 用于校正
+#define MOTOR_CONT_CURRENT_MA  500       // 连续额定电流 (mA)
+#define MOTOR_PEAK_CURRENT_MA  CURRENT_MODE_LIMIT_MA  // 短时额定电流 (mA)
+#define THERMAL_PEAK_S         2.0f      // 峰值电流可持续时间: I²t 预算 = (Ipk²-Icont²)×此值
+#define THERMAL_TAU_S          60.0f     // 绕组热时间常数 (s)
+#define THERMAL_RISE_AT_CONT   40.0f     // 连续额定电流下稳态温升 (°C)
+#define THERMAL_MAX_DEG        85.0f     // 绕组温度上限 (°C)
+#define THERMAL_TAPER_DEG      15.0f     // 距上限此范围内线性收紧电流
+#define THERMAL_MIN_LIMIT_MA   300       // 热限流下限 (mA), 保证仍能维持平衡
+#define THERMAL_CAL_GAIN       0.5f      // 每次 REG_TEMP 读数的模型校正增益
+#define THERMAL_AMBIENT_DEG    25.0f     // 无读数时的环境温度初值 (°C)
+
+// ============ 架空轮电机特性辨识 ============
+// 扫频/PRBS/斜坡电流激励 + 速度模式阶跃/扫频, 全速率记录指令与响应供主机拟合
+#define CHARACT_REST_S       1.0f   // 每段前零指令静置 (s)
+#define CHARACT_MAX_RPM      600    // 电流段超速保护: 任一轮超过此转速即本拍零电流
+#define CHARACT_PRBS_TICKS   10     // PRBS 码元宽度 (控制周期数, 10×2ms=20ms)
+
+// ============ CAN 时延探针 (WebSocket LP,1 开启) ============
+#define LATENCY_SPIN_US          300     // 探针开启时发送后自旋接收应答的上限 (µs)
+#define LATENCY_TIMEOUT_US       20000   // 应答超时计为丢失 (µs)
+#define LATENCY_RESP_TIMEOUT_US  50000   // 电流响应超时计为丢失 (µs)
+#define LATENCY_STEP_MA          30      // 指令与反馈电流相差超过此值才测电流响应 (mA)
+
+// ============ 控制循环分段计时 ============
+#define PROFILER_ENABLE     1      // 0 = 编译期移除全部 PROF_BEGIN/PROF_END
+#define PROFILER_REPORT_MS  1000   // 统计窗口 / PF 上报周期 (ms)
+
+// ============ 控制拍超时监测 ============
+#define DEADLINE_LATE_US    1000   // 执行时刻晚于计划超过半个周期记为迟到 (µs)
+#define DEADLINE_PUMP_MS    100    // 事件日志发送间隔 (ms, 每次最多 4 条)
 
 // ============ 控制循环 ============
 #define CTRL_HZ  500
@@ -127,3 +243,89 @@
 // ============ WiFi ============
 #define WIFI_SSID_STR "aiden"
 #define WIFI_PASS_STR "633234001"
+
+// ============ HTTP 页面 (gzip 内置, 分块发送) ============
+#define HTTP_CHUNK_BYTES    1024    // 每轮 loop 最多写入的页面字节数
+#define HTTP_SEND_TIMEOUT_MS 5000   // 页面未发完的放弃时限 (ms)
+
+// ============ 网络任务 (HTTP/WebSocket 在核 0, 与控制核经无锁队列交接) ============
+#define NET_TASK_CORE       0
+#define NET_TASK_PRIO       1       // 低于 WiFi 协议栈; 与核 0 idle 任务轮转
+#define NET_TASK_STACK      8192
+#define NET_IN_QUEUE_BYTES  4096    // 入站 (命令/连接事件) 环, 2 的幂
+#define NET_OUT_QUEUE_BYTES 16384   // 出站 (遥测/事件/辨识采样) 环, 2 的幂
+#define NET_MSG_MAX         1280    // 单条出站消息上限 (辨识采样帧 1032 字节)
+#define NET_IN_DRAIN_MAX    8       // webLoop() 每轮最多处理的入站消息
+
+// ============ HTTP 接口 (/api/*) ============
+#define API_CMD_TIMEOUT_MS  250     // 写操作等待控制核执行的时限 (ms)
+#define API_JSON_BYTES      4096    // 响应缓冲区
+#define MREG_POLL_MS        100     // 非平衡期寄存器补读间隔 (ms, 每次一个)
+#define MREG_REFRESH_MS     2000    // 寄存器快照超过此龄才补读 (ms)
+
+// ============ 闭环日志 (设备端记录, /api/log 下载) ============
+#define RUNLOG_PSRAM_BYTES  (4 * 1024 * 1024)   // 48 字节/条 → 约 87k 条, 500Hz 约 170s
+#define RUNLOG_DRAM_BYTES   (48 * 1024)         // 无 PSRAM 时的退化容量 (约 2s)
+#define RUNLOG_DECIM        1       // 每 N 个控制拍记录一条
+#define RUNLOG_MAX_RUNS     32      // 保留的 run 边界记录数
+#define RUNLOG_BIN_HDR      20      // 二进制下载头部字节数
+#define RUNLOG_BIN_TRAILER  8       // 二进制下载结尾记录字节数 (完整/截断 + 实际条数)
+
+// ============ WebSocket 遥测分发 (每客户端订阅 + 流控) ============
+#define TEL_MAX_CLIENTS     5       // 与 WebSocketsServer 默认客户端上限一致
+#define TEL_MIN_PERIOD_MS   10      // 最短订阅周期 (ms)
+#define TEL_CLIENT_WINDOW   32      // 每客户端未确认帧上限 (队列深度), 超出即丢帧
+#define TEL_SLOW_SEND_US    3000    // 单次发送超过此时长视为慢客户端 (µs)
+#define TEL_SLOW_BACKOFF    4       // 慢客户端随后跳过的帧数
+#define TEL_STREAM_RING     512     // 逐拍遥测流环长 (条, 500Hz 约 1s)
+#define TEL_STREAM_FRAME_MAX 48     // 每个 K 帧最多条数 (8 + 48×24 字节 < NET_MSG_MAX)
+
+// ============ 频谱分析 (控制拍采样, 核 0 计算, SP,1 开启 / FS 上报) ============
+#define SPEC_FFT_N          512     // 每段 FFT 点数 (2 的幂, 500Hz 下频点间隔 0.98Hz)
+#define SPEC_SEGMENTS       3       // Welch 平均段数 (50% 重叠)
+#define SPEC_WINDOW         (SPEC_FFT_N * (SPEC_SEGMENTS + 1) / 2)   // 每次分析的采样数 (约 2s)
+#define SPEC_RING           2048    // 采样环长 (> SPEC_WINDOW, 留出复制余量)
+#define SPEC_PUBLISH_MS     1000    // 谱上报周期 (ms)
+#define SPEC_TASK_CORE      0
+#define SPEC_TASK_PRIO      0       // 低于网络任务, 只用核 0 空闲时间
+#define SPEC_TASK_STACK     4096
+
+// ============ LCD 显示任务 (核 0, 离屏 sprite + 脏块 DMA) ============
+#define DISPLAY_TASK_CORE   0
+#define DISPLAY_TASK_PRIO   0       // 低于网络任务
+#define DISPLAY_TASK_STACK  4096
+#define DISPLAY_PERIOD_MS   100     // 刷新周期 (10fps)
+#define DISPLAY_TILE_W      40      // 脏块尺寸 (须整除 320×240, 宽为偶数)
+#define DISPLAY_TILE_H      20
+#define DISPLAY_CHART_PERIOD_MS 33  // 曲线模式刷新周期 (30fps)
+#define DISPLAY_CHART_DECIM 5       // 曲线每列对应的控制拍数 (292 列 ≈ 2.9s)
+#define DISPLAY_CHART_DEG   15.0f   // 曲线上半区 pitch/target 满量程 (±°)
+
+// ============ 触屏菜单 ============
+#define TOUCH_QUEUE_LEN     8       // 触摸事件队列 (loop → 显示任务, 满则丢弃)
+#define TOUCH_REPEAT_MS     150     // 按住连发间隔
+#define UI_CMD_QUEUE_LEN    4       // 菜单命令队列 (显示任务 → loop)
+#define UI_CMD_DRAIN_MAX    2       // loop 每轮最多执行的菜单命令
+#define UI_ROW_H            36      // 参数列表行高
+
+// ============ 安全监督 (核 0 高优先级任务, 独立于控制环) ============
+#define SUP_TASK_CORE       0
+#define SUP_TASK_PRIO       5       // 高于网络/显示任务, 低于 WiFi/lwIP 协议栈
+#define SUP_TASK_STACK      3072
+#define SUP_PERIOD_MS       1       // 检查周期 (1 tick)
+#define SUP_HEARTBEAT_MS    8       // 平衡期控制拍心跳超时 (4 拍)
+#define SUP_FEEDBACK_MS     6       // 平衡期任一电机 0x02 反馈帧超时 (约连续 3 帧丢失)
+#define SUP_BEAT_FRESH_MS   4       // 心跳间隔不超过此值 (2 拍) 才判定反馈超时: 反馈在 loop 中解析,
+                                    // loop 卡顿时反馈同样停止, 应归为 HEARTBEAT
+#define SUP_OVERCURRENT_MA  1300    // 实测电流上限 (mA, 指令上限 CURRENT_MODE_LIMIT_MA + 余量)
+#define SUP_OVERCURRENT_MS  6       // 超限持续时间
+#define SUP_ANGLE_DEG       25.0f   // 倾角上限 (°, 高于 STANDUP_MAX_ANGLE, 正常跌倒检测的后备)
+#define SUP_ANGLE_MS        4       // 超限持续时间
+#define SUP_CAN_TX_TIMEOUT_MS 2     // 保留路径每帧发送超时
+#define SUP_WDT_TIMEOUT_MS  1000    // 任务看门狗 (loop/监督任务未喂狗即复位; IDF 4.x 按整秒)
+
+// ============ UDP 低延迟通道 (摇杆 + 高速遥测, 配置仍走 WebSocket) ============
+#define UDP_ENABLE          1       // 0 = 不启用 UDP 通道
+#define UDP_PORT            4210
+#define UDP_TELEM_MIN_MS    5       // 客户端可订阅的最短遥测周期 (ms)
+#define UDP_SUB_TIMEOUT_MS  3000    // 订阅需周期性续订, 超时停止发送
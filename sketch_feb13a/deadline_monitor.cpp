@@ -0,0 +1,139 @@
+/**
+ * deadline_monitor.cpp — 控制拍超时统计与事件日志
+ *
+ * 活动打点只记录"自上一轮追赶以来最长的一段", 当追赶循环发现迟到/跳拍时,
+ * 把它作为肇事活动写入事件。事件先进环形缓冲, 由 loop() 中的 deadlinePump()
+ * 限速发送, 避免日志本身再造成超时。
+ */
+
+#include "deadline_monitor.h"
+#include "config.h"
+#include "web_control.h"
+
+static const char *const TAG_NAMES[DL_TAG_N] = {
+    "none", "ctrl", "m5", "net", "canRead", "autotune", "udp",
+};
+
+struct DlEvent {
+    uint32_t ms;
+    uint32_t lateUs;     // 迟到: 延迟; 跳拍: 丢弃时滞后
+    uint16_t skipped;    // 0 = 迟到事件
+    uint8_t  tag;
+    uint32_t tagUs;      // 肇事活动耗时
+};
+
+static const int EVENT_N = 32;
+
+static DeadlineStats stats;
+static DlEvent  events[EVENT_N];
+static uint32_t evHead = 0, evTail = 0;
+
+static const int STACK_N = 4;          // 允许嵌套 (如 wsLoop 内的命令触发 wsSend)
+static DlTag    stackTag[STACK_N];
+static uint32_t stackStart[STACK_N];
+static int      depth    = 0;
+static DlTag    worstTag = DL_NONE;
+static uint32_t worstUs  = 0;
+static bool     burstLogged = false;   // 一轮追赶只记一条迟到事件
+static unsigned long lastPumpMs = 0;
+static uint32_t winMaxLateUs = 0;
+static uint32_t winMiss      = 0;
+
+void deadlineBegin(DlTag tag) {
+    if (depth >= STACK_N) return;
+    stackTag[depth] = tag;
+    stackStart[depth] = micros();
+    depth++;
+}
+
+void deadlineEnd(DlTag tag) {
+    if (depth == 0 || stackTag[depth - 1] != tag) return;
+    depth--;
+    uint32_t us = micros() - stackStart[depth];
+    if (us > worstUs) {
+        worstUs = us;
+        worstTag = tag;
+    }
+}
+
+static void pushEvent(uint32_t lateUs, uint32_t skipped) {
+    stats.events++;
+    stats.missByTag[worstTag]++;
+    if (evHead - evTail >= (uint32_t)EVENT_N) {
+        stats.lostEvents++;
+        return;
+    }
+    DlEvent &e = events[evHead % EVENT_N];
+    e.ms      = millis();
+    e.lateUs  = lateUs;
+    e.skipped = (uint16_t)min(skipped, (uint32_t)0xFFFF);
+    e.tag     = worstTag;
+    e.tagUs   = worstUs;
+    evHead++;
+}
+
+void deadlineTick(uint32_t lateUs) {
+    stats.ticks++;
+    if (lateUs > stats.maxLateUs) stats.maxLateUs = lateUs;
+    if (lateUs > winMaxLateUs) winMaxLateUs = lateUs;
+    if (lateUs < DEADLINE_LATE_US) return;
+    stats.late++;
+    winMiss++;
+    if (!burstLogged) {
+        burstLogged = true;
+        pushEvent(lateUs, 0);
+    }
+}
+
+void deadlineSkip(uint32_t n, uint32_t lagUs) {
+    stats.skipped += n;
+    if (lagUs > stats.maxLateUs) stats.maxLateUs = lagUs;
+    if (lagUs > winMaxLateUs) winMaxLateUs = lagUs;
+    winMiss += n;
+    pushEvent(lagUs, n);
+}
+
+void deadlineBurstEnd() {
+    worstTag = DL_NONE;
+    worstUs = 0;
+    burstLogged = false;
+}
+
+void deadlinePump() {
+    unsigned long nowMs = millis();
+    if (evHead == evTail || nowMs - lastPumpMs < DEADLINE_PUMP_MS) return;
+    lastPumpMs = nowMs;
+
+    char msg[96];
+    for (int i = 0; i < 4 && evTail != evHead; i++, evTail++) {
+        const DlEvent &e = events[evTail % EVENT_N];
+        // DL,E,ms,lateUs,skipped,tag,tagUs
+        snprintf(msg, sizeof(msg), "DL,E,%lu,%lu,%u,%s,%lu",
+                 (unsigned long)e.ms, (unsigned long)e.lateUs, (unsigned)e.skipped,
+                 TAG_NAMES[e.tag], (unsigned long)e.tagUs);
+        webBroadcastText(msg);
+    }
+}
+
+void deadlineWindowBegin() {
+    winMaxLateUs = 0;
+    winMiss = 0;
+}
+
+void deadlineWindowEnd(uint32_t *maxLateUs, uint32_t *missTicks) {
+    *maxLateUs = winMaxLateUs;
+    *missTicks = winMiss;
+}
+
+const DeadlineStats &deadlineStats() {
+    return stats;
+}
+
+const char *deadlineTagName(DlTag tag) {
+    return tag < DL_TAG_N ? TAG_NAMES[tag] : "?";
+}
+
+void deadlineReset() {
+    memset(&stats, 0, sizeof(stats));
+    evTail = evHead;
+}
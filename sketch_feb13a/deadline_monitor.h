@@ -0,0 +1,50 @@
+#pragma once
+/**
+ * deadline_monitor.h — 500Hz 控制拍超时统计: 迟到拍 / 跳过拍 / 最大延迟 + 肇事活动事件日志
+ */
+
+#include <Arduino.h>
+
+// 主循环中可能阻塞控制拍的活动
+enum DlTag : uint8_t {
+    DL_NONE,
+    DL_CTRL,       // 控制拍自身 (updateIMU + balanceControl)
+    DL_M5,         // M5.update() (触屏/按键)
+    DL_NET,        // webLoop(): 网络任务转来的命令处理 (socket 操作已移到核 0)
+    DL_CAN_READ,   // motorsPollParams() 阻塞读寄存器
+    DL_AUTOTUNE,   // autoTuneUpdate()
+    DL_UDP,        // udpLoop() 收包 + 遥测发送
+    DL_TAG_N
+};
+
+struct DeadlineStats {
+    uint32_t ticks;        // 已执行控制拍
+    uint32_t late;         // 执行时刻晚于计划 ≥ DEADLINE_LATE_US 的拍
+    uint32_t skipped;      // 追赶上限外被丢弃的拍
+    uint32_t maxLateUs;    // 最大延迟 (µs)
+    uint32_t events;       // 已记录事件 (含溢出)
+    uint32_t lostEvents;   // 日志环满被丢弃的事件
+    uint32_t missByTag[DL_TAG_N];  // 按肇事活动统计 (迟到 + 跳过事件)
+};
+
+// 活动打点: 成对调用; 记录自上一轮控制拍以来耗时最长的活动
+void deadlineBegin(DlTag tag);
+void deadlineEnd(DlTag tag);
+
+// 追赶循环中每执行一拍调用 (lateUs = 实际执行时刻 - 计划时刻)
+void deadlineTick(uint32_t lateUs);
+// 追赶上限外丢弃 n 拍 (lagUs = 丢弃时累计滞后)
+void deadlineSkip(uint32_t n, uint32_t lagUs);
+// 一轮追赶结束: 清空肇事活动记录
+void deadlineBurstEnd();
+
+// 从事件环取出若干条发送 (DL,E,...)
+void deadlinePump();
+
+// 观测窗口 (同一时刻仅一个): 统计一段活动期间 (如页面传输) 的最大延迟与迟到/跳过拍
+void deadlineWindowBegin();
+void deadlineWindowEnd(uint32_t *maxLateUs, uint32_t *missTicks);
+
+const DeadlineStats &deadlineStats();
+const char *deadlineTagName(DlTag tag);
+void deadlineReset();
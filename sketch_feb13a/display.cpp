@@ -1,109 +1,356 @@
 /**
  * display.cpp — CoreS3 LCD 屏幕显示
+ *
+ * 显示任务每 DISPLAY_PERIOD_MS 把整屏画进 PSRAM 中的 sprite (纯内存操作), 再按
+ * DISPLAY_TILE_W × DISPLAY_TILE_H 分块计算 FNV 哈希, 只有与上一帧哈希不同的块才复制到
+ * 内部 RAM 的双缓冲区并用 DMA 推送。数值不变的区域不产生 SPI 传输, 典型一帧只推几块。
+ *
+ * 任务固定在核 0 (控制环在核 1), 优先级低于网络任务; LCD 独占 SPI, 与 IMU (I²C)、
+ * 电机 (TWAI) 无总线共享。读取的全局量均为 32 位标量, 单个字段不会撕裂。
+ *
+ * 曲线模式不清屏: 数据来自 tel_stream 逐拍采样环 (无锁复制), 每 DISPLAY_CHART_DECIM 拍
+ * 在扫描光标处画一列 (列内 min/max 竖线), 光标前方擦出几列空隙, 其余像素保持不变,
+ * 因此每帧只有光标所在的一两列块和底部读数行需要推送。
+ *
+ * 任务在刷新周期内阻塞等待触摸事件 (touch_ui), 有事件时立即处理并重绘, 菜单画面
+ * 打开期间覆盖主视图。
  */
 
 #include "display.h"
 #include "config.h"
 #include "globals.h"
+#include "tel_stream.h"
+#include "touch_ui.h"
 #include <M5Unified.h>
+#include <limits.h>
+
+static const int TILE_PIX = DISPLAY_TILE_W * DISPLAY_TILE_H;
+
+static M5Canvas canvas(&M5.Lcd);
+static uint16_t *frame = nullptr;      // sprite 像素 (RGB565, 已按面板字节序)
+static int       tilesX = 0, tilesY = 0;
+static uint32_t *tileHash = nullptr;
+static uint16_t  dmaBuf[2][TILE_PIX] __attribute__((aligned(4)));
+static volatile bool fullRedraw = true;
+static volatile bool chartMode = false;
+static char      ipText[24];
+
+// ---- 曲线模式 ----
+static const int CHART_X0   = 28;    // 左侧刻度标签宽度
+static const int CHART_TOP  = 20;
+static const int CHART_MID  = 120;   // 上: pitch/target; 下: PID 输出/电流
+static const int CHART_BOT  = 220;   // 其下为读数行
+static const int CHART_GAP  = 4;     // 光标前擦出的空白列
+static const int CHART_COLS_MAX = 64;   // 每帧最多补画列数, 落后更多时跳到最新
+static bool     chartDrawn = false;
+static uint32_t chartSeq = 0;
+static int      chartX = CHART_X0;
+static int      lastY[4];
 
 // ============ 绘制主 UI ============
 void drawMainUI() {
-    M5.Lcd.fillScreen(BLACK);
-    M5.Lcd.setTextSize(1);
-    M5.Lcd.setTextColor(CYAN);
-    M5.Lcd.setCursor(4, 4);
-    M5.Lcd.print("Balance Bot CAN | ");
-    M5.Lcd.setTextColor(WHITE);
-    M5.Lcd.print(myIP);
-}
-
-// ============ 刷新动态数据 ============
-void updateDisplay() {
-    float displayPitch = currentPitch + PITCH_MOUNT_OFFSET;
-
-    // --- 诊断模式: 大字显示原始 Pitch + 滤波 Pitch，方便找平衡点 ---
-    if (diagMode) {
-        M5.Lcd.fillRect(0, 20, screenW, screenH - 20, BLACK);
-        M5.Lcd.setTextDatum(TL_DATUM);
-
-        M5.Lcd.setTextSize(2);
-        M5.Lcd.setTextColor(YELLOW, BLACK);
-        M5.Lcd.setCursor(4, 24);
-        M5.Lcd.printf("RAW Pitch");
-
-        M5.Lcd.setTextSize(4);
-        M5.Lcd.setTextColor(WHITE, BLACK);
-        char buf[32];
-        snprintf(buf, sizeof(buf), "%+7.2f", rawAccelPitchDeg);
-        M5.Lcd.setCursor(4, 50);
-        M5.Lcd.print(buf);
-
-        M5.Lcd.setTextSize(2);
-        M5.Lcd.setTextColor(GREEN, BLACK);
-        M5.Lcd.setCursor(4, 100);
-        M5.Lcd.printf("Filt: %+7.2f", displayPitch);
-
-        M5.Lcd.setTextSize(1);
-        M5.Lcd.setTextColor(CYAN, BLACK);
-        M5.Lcd.setCursor(4, 130);
-        M5.Lcd.printf("ay=%+.3f  az=%+.3f", (double)rawAccelAy, (double)rawAccelAz);
-
-        M5.Lcd.setCursor(4, 148);
-        M5.Lcd.printf("gyro=%+.1f  offset=%.1f", (double)gyroRate, (double)PITCH_MOUNT_OFFSET);
-
-        M5.Lcd.setCursor(4, 166);
-        uint16_t stColor = (stableCount >= STABLE_HOLD_COUNT) ? GREEN : YELLOW;
-        M5.Lcd.setTextColor(stColor, BLACK);
-        M5.Lcd.printf("stable=%d/%d  %s",
-                       stableCount, STABLE_HOLD_COUNT,
-                       (stableCount >= STABLE_HOLD_COUNT) ? "** READY **" : "");
-        return;
-    }
+    fullRedraw = true;
+}
+
+static void drawHeader() {
+    canvas.setTextSize(1);
+    canvas.setTextDatum(TL_DATUM);
+    canvas.setCursor(4, 4);
+    canvas.setTextColor(CYAN);
+    canvas.print("Balance Bot CAN | ");
+    canvas.setTextColor(WHITE);
+    canvas.print(ipText);
+}
 
-    // --- 平衡/倒地模式: 简洁运行视图 ---
-    int barY = 30, barH = 40;
-    M5.Lcd.fillRect(0, barY, screenW, barH + 30, BLACK);
+// ============ 诊断模式: 大字显示原始 Pitch + 滤波 Pitch，方便找平衡点 ============
+static void drawDiagView(float displayPitch) {
+    canvas.setTextDatum(TL_DATUM);
+
+    canvas.setTextSize(2);
+    canvas.setTextColor(YELLOW);
+    canvas.setCursor(4, 24);
+    canvas.print("RAW Pitch");
+
+    canvas.setTextSize(4);
+    canvas.setTextColor(WHITE);
+    canvas.setCursor(4, 50);
+    canvas.printf("%+7.2f", rawAccelPitchDeg);
+
+    canvas.setTextSize(2);
+    canvas.setTextColor(GREEN);
+    canvas.setCursor(4, 100);
+    canvas.printf("Filt: %+7.2f", displayPitch);
+
+    canvas.setTextSize(1);
+    canvas.setTextColor(CYAN);
+    canvas.setCursor(4, 130);
+    canvas.printf("ay=%+.3f  az=%+.3f", (double)rawAccelAy, (double)rawAccelAz);
+
+    canvas.setCursor(4, 148);
+    canvas.printf("gyro=%+.1f  offset=%.1f", (double)gyroRate, (double)PITCH_MOUNT_OFFSET);
+
+    canvas.setCursor(4, 166);
+    bool ready = stableCount >= STABLE_HOLD_COUNT;
+    canvas.setTextColor(ready ? GREEN : YELLOW);
+    canvas.printf("stable=%d/%d  %s", stableCount, STABLE_HOLD_COUNT, ready ? "** READY **" : "");
+}
 
-    int barCenter = screenW / 2;
-    int barLen = constrain((int)(displayPitch * screenW / 90.0), -barCenter, barCenter);
+// ============ 平衡/倒地模式: 简洁运行视图 ============
+static void drawRunView(float displayPitch) {
+    const int barY = 30, barH = 40;
+    const int barCenter = screenW / 2;
+    int barLen = constrain((int)(displayPitch * screenW / 90.0f), -barCenter, barCenter);
 
-    uint16_t barColor = fallen ? RED : (fabs(displayPitch) < 5 ? GREEN : YELLOW);
+    uint16_t barColor = fallen ? RED : (fabsf(displayPitch) < 5 ? GREEN : YELLOW);
     if (barLen > 0)
-        M5.Lcd.fillRect(barCenter, barY, barLen, barH, barColor);
+        canvas.fillRect(barCenter, barY, barLen, barH, barColor);
     else
-        M5.Lcd.fillRect(barCenter + barLen, barY, -barLen, barH, barColor);
-    M5.Lcd.drawLine(barCenter, barY, barCenter, barY + barH, WHITE);
+        canvas.fillRect(barCenter + barLen, barY, -barLen, barH, barColor);
+    canvas.drawLine(barCenter, barY, barCenter, barY + barH, WHITE);
 
-    M5.Lcd.setTextSize(2);
-    M5.Lcd.setTextDatum(MC_DATUM);
-    M5.Lcd.setTextColor(WHITE, BLACK);
     char buf[32];
     snprintf(buf, sizeof(buf), "%+.1f", displayPitch);
-    M5.Lcd.drawString(buf, barCenter, barY + barH + 12);
+    canvas.setTextSize(2);
+    canvas.setTextDatum(MC_DATUM);
+    canvas.setTextColor(WHITE);
+    canvas.drawString(buf, barCenter, barY + barH + 12);
+
+    const int infoY = barY + barH + 30;
+    canvas.setTextSize(1);
+    canvas.setTextDatum(TL_DATUM);
+
+    canvas.setTextColor(CYAN);
+    canvas.setCursor(4, infoY);
+    canvas.printf("Kp=%.1f Ki=%.1f Kd=%.2f", Kp, Ki, Kd);
+
+    canvas.setCursor(4, infoY + 14);
+    canvas.setTextColor(YELLOW);
+    canvas.printf("Out=%+.0f  Target=%+.1f", pidOutput, targetAngleFilt);
+
+    canvas.setCursor(4, infoY + 28);
+    canvas.setTextColor(fallen ? RED : GREEN);
+    canvas.printf("Status: %s", fallen ? "FALLEN" : "BALANCING");
+
+    canvas.setCursor(4, infoY + 42);
+    canvas.setTextColor(CYAN);
+    canvas.printf("RPM R=%d L=%d  Act %.0f %.0f", cmdSpdR, cmdSpdL, (double)actualSpeedR, (double)actualSpeedL);
+
+    canvas.setCursor(4, infoY + 56);
+    canvas.setTextColor(YELLOW);
+    canvas.printf("I=%.0f/%.0fmA  %.0fmm/s", (double)actualCurrentR, (double)actualCurrentL, (double)linearSpeed);
+}
+
+// ============ 曲线模式 ============
+static inline int yAngle(float deg) {
+    const float half = (CHART_MID - CHART_TOP) * 0.5f;
+    int y = (int)(CHART_TOP + half - deg * (half - 1) / DISPLAY_CHART_DEG);
+    return constrain(y, CHART_TOP, CHART_MID - 1);
+}
+
+static inline int yCurrent(float ma) {
+    const float half = (CHART_BOT - CHART_MID) * 0.5f;
+    int y = (int)(CHART_MID + half - ma * (half - 1) / CURRENT_MODE_LIMIT_MA);
+    return constrain(y, CHART_MID, CHART_BOT - 1);
+}
+
+// 某一列的背景: 清空 + 零线/分隔线
+static void chartClearColumn(int x) {
+    canvas.drawFastVLine(x, CHART_TOP, CHART_BOT - CHART_TOP, BLACK);
+    canvas.drawPixel(x, yAngle(0), DARKGREY);
+    canvas.drawPixel(x, yCurrent(0), DARKGREY);
+    canvas.drawPixel(x, CHART_MID, NAVY);
+}
+
+static void chartBegin() {
+    canvas.fillScreen(BLACK);
+    canvas.setTextSize(1);
+    canvas.setTextDatum(TL_DATUM);
+    canvas.setTextColor(WHITE);
+    canvas.drawString(ipText, 4, 4);
+    canvas.setTextDatum(TR_DATUM);
+    canvas.setTextColor(GREEN);  canvas.drawString("cur", screenW - 4, 4);
+    canvas.setTextColor(ORANGE); canvas.drawString("PID", screenW - 28, 4);
+    canvas.setTextColor(YELLOW); canvas.drawString("target", screenW - 52, 4);
+    canvas.setTextColor(CYAN);   canvas.drawString("pitch", screenW - 94, 4);
+
+    canvas.setTextDatum(ML_DATUM);
+    char buf[12];
+    canvas.setTextColor(LIGHTGREY);
+    snprintf(buf, sizeof(buf), "+%d", (int)DISPLAY_CHART_DEG);
+    canvas.drawString(buf, 0, CHART_TOP + 6);
+    canvas.drawString("0", 0, yAngle(0));
+    snprintf(buf, sizeof(buf), "-%d", (int)DISPLAY_CHART_DEG);
+    canvas.drawString(buf, 0, CHART_MID - 6);
+    snprintf(buf, sizeof(buf), "%.1fA", CURRENT_MODE_LIMIT_MA / 1000.0f);
+    canvas.drawString(buf, 0, CHART_MID + 6);
+    canvas.drawString("0", 0, yCurrent(0));
+    for (int x = CHART_X0; x < screenW; x++) chartClearColumn(x);
 
-    int infoY = barY + barH + 30;
-    M5.Lcd.fillRect(0, infoY, screenW, screenH - infoY, BLACK);
-    M5.Lcd.setTextSize(1);
-    M5.Lcd.setTextDatum(TL_DATUM);
+    chartSeq = telStreamHead();
+    chartX = CHART_X0;
+    for (int i = 0; i < 4; i++) lastY[i] = -1;
+    chartDrawn = true;
+}
+
+// 一条迹线在本列的竖线: 覆盖本列 min..max, 并与上一列末值相连
+static void chartTrace(int x, int idx, int yMin, int yMax, int yLast, uint16_t color) {
+    if (lastY[idx] >= 0) {
+        yMin = min(yMin, lastY[idx]);
+        yMax = max(yMax, lastY[idx]);
+    }
+    canvas.drawFastVLine(x, yMin, yMax - yMin + 1, color);
+    lastY[idx] = yLast;
+}
+
+static void chartColumn(const TelStreamSample *s, int n) {
+    int lo[4] = {INT_MAX, INT_MAX, INT_MAX, INT_MAX};
+    int hi[4] = {INT_MIN, INT_MIN, INT_MIN, INT_MIN};
+    int last[4] = {0, 0, 0, 0};
+    for (int i = 0; i < n; i++) {
+        const float cur = 0.5f * (s[i].curR * DIR_R + s[i].curL * DIR_L);
+        int y[4] = {yAngle(s[i].pitch100 * 0.01f), yAngle(s[i].target100 * 0.01f),
+                    yCurrent(s[i].pid10 * 0.1f), yCurrent(cur)};
+        for (int k = 0; k < 4; k++) {
+            lo[k] = min(lo[k], y[k]);
+            hi[k] = max(hi[k], y[k]);
+            last[k] = y[k];
+        }
+    }
+    chartClearColumn(chartX);
+    chartTrace(chartX, 1, lo[1], hi[1], last[1], YELLOW);
+    chartTrace(chartX, 0, lo[0], hi[0], last[0], CYAN);
+    chartTrace(chartX, 2, lo[2], hi[2], last[2], ORANGE);
+    chartTrace(chartX, 3, lo[3], hi[3], last[3], GREEN);
+
+    chartX = (chartX + 1 < screenW) ? chartX + 1 : CHART_X0;
+    for (int g = 0, x = chartX; g < CHART_GAP; g++) {
+        chartClearColumn(x);
+        x = (x + 1 < screenW) ? x + 1 : CHART_X0;
+    }
+    // 光标回绕处不与旧曲线相连
+    if (chartX == CHART_X0) {
+        for (int i = 0; i < 4; i++) lastY[i] = -1;
+    }
+}
+
+static void drawChartView(float displayPitch) {
+    if (!chartDrawn) chartBegin();
+
+    static TelStreamSample buf[DISPLAY_CHART_DECIM];
+    uint32_t head = telStreamHead();
+    if (head - chartSeq > (uint32_t)(CHART_COLS_MAX * DISPLAY_CHART_DECIM)) {
+        chartSeq = head - CHART_COLS_MAX * DISPLAY_CHART_DECIM;
+    }
+    while (head - chartSeq >= (uint32_t)DISPLAY_CHART_DECIM) {
+        if (telStreamRead(chartSeq, buf, DISPLAY_CHART_DECIM) != DISPLAY_CHART_DECIM) {
+            chartSeq = telStreamHead();   // 被覆盖: 重新同步
+            break;
+        }
+        chartColumn(buf, DISPLAY_CHART_DECIM);
+        chartSeq += DISPLAY_CHART_DECIM;
+    }
+
+    canvas.fillRect(0, CHART_BOT, screenW, screenH - CHART_BOT, BLACK);
+    canvas.setTextSize(1);
+    canvas.setTextDatum(TL_DATUM);
+    canvas.setCursor(4, CHART_BOT + 6);
+    canvas.setTextColor(fallen ? RED : (diagMode ? YELLOW : GREEN));
+    canvas.printf("%s  P%+6.1f  T%+5.1f  Out%+5.0f  I%+5.0f/%+5.0f",
+                  fallen ? "FALL" : (diagMode ? "DIAG" : "RUN "), displayPitch, targetAngleFilt,
+                  pidOutput, (double)actualCurrentR, (double)actualCurrentL);
+}
+
+// ============ 脏块推送 ============
+static uint32_t hashTile(int tx, int ty) {
+    uint32_t h = 2166136261u;
+    const int x0 = tx * DISPLAY_TILE_W, y0 = ty * DISPLAY_TILE_H;
+    for (int y = 0; y < DISPLAY_TILE_H; y++) {
+        const uint32_t *row = (const uint32_t *)(frame + (y0 + y) * screenW + x0);
+        for (int i = 0; i < DISPLAY_TILE_W / 2; i++) h = (h ^ row[i]) * 16777619u;
+    }
+    return h;
+}
 
-    M5.Lcd.setTextColor(CYAN);
-    M5.Lcd.setCursor(4, infoY);
-    M5.Lcd.printf("Kp=%.1f Ki=%.1f Kd=%.2f", Kp, Ki, Kd);
+static void pushDirtyTiles(bool all) {
+    int buf = 0;
+    M5.Lcd.startWrite();
+    for (int ty = 0; ty < tilesY; ty++) {
+        for (int tx = 0; tx < tilesX; tx++) {
+            uint32_t h = hashTile(tx, ty);
+            uint32_t &old = tileHash[ty * tilesX + tx];
+            if (!all && h == old) continue;
+            old = h;
 
-    M5.Lcd.setCursor(4, infoY + 14);
-    M5.Lcd.setTextColor(YELLOW);
-    M5.Lcd.printf("Out=%+.0f  Target=%+.1f", pidOutput, targetAngleFilt);
+            // 上一次 DMA 用的是另一块缓冲区, pushImageDMA 内部先等待其完成
+            const int x0 = tx * DISPLAY_TILE_W, y0 = ty * DISPLAY_TILE_H;
+            for (int y = 0; y < DISPLAY_TILE_H; y++) {
+                memcpy(dmaBuf[buf] + y * DISPLAY_TILE_W, frame + (y0 + y) * screenW + x0,
+                       DISPLAY_TILE_W * sizeof(uint16_t));
+            }
+            // sprite 缓冲区已是面板字节序 (swap565), 按该类型推送不做转换, 也不改 LCD 的 swapBytes 状态
+            M5.Lcd.pushImageDMA(x0, y0, DISPLAY_TILE_W, DISPLAY_TILE_H,
+                                (const lgfx::swap565_t *)dmaBuf[buf]);
+            buf ^= 1;
+        }
+    }
+    M5.Lcd.waitDMA();
+    M5.Lcd.endWrite();
+}
 
-    M5.Lcd.setCursor(4, infoY + 28);
-    M5.Lcd.setTextColor(fallen ? RED : GREEN);
-    M5.Lcd.printf("Status: %s", fallen ? "FALLEN" : "BALANCING");
+void displaySetChartMode(bool on) {
+    chartMode = on;
+}
 
-    M5.Lcd.setCursor(4, infoY + 42);
-    M5.Lcd.setTextColor(CYAN);
-    M5.Lcd.printf("RPM R=%d L=%d  Act %.0f %.0f", cmdSpdR, cmdSpdL, (double)actualSpeedR, (double)actualSpeedL);
+bool displayChartMode() {
+    return chartMode;
+}
 
-    M5.Lcd.setCursor(4, infoY + 56);
-    M5.Lcd.setTextColor(YELLOW);
-    M5.Lcd.printf("I=%.0f/%.0fmA  %.0fmm/s", (double)actualCurrentR, (double)actualCurrentL, (double)linearSpeed);
+static void displayTask(void *) {
+    TickType_t last = xTaskGetTickCount();
+    for (;;) {
+        // 等到本帧时刻; 期间来了触摸事件则提前醒来, 处理完所有积压事件后立即重绘
+        const TickType_t period = pdMS_TO_TICKS(chartMode ? DISPLAY_CHART_PERIOD_MS : DISPLAY_PERIOD_MS);
+        const TickType_t elapsed = xTaskGetTickCount() - last;
+        TouchEvent ev;
+        if (touchUiWait(&ev, elapsed < period ? (period - elapsed) * portTICK_PERIOD_MS : 0)) {
+            do {
+                touchUiHandle(ev);
+            } while (touchUiWait(&ev, 0));
+        }
+        last = xTaskGetTickCount();
+
+        bool all = fullRedraw;
+        fullRedraw = false;
+        float displayPitch = currentPitch + PITCH_MOUNT_OFFSET;
+        if (touchUiDraw(canvas)) {
+            chartDrawn = false;
+        } else if (chartMode) {
+            if (all) chartDrawn = false;
+            drawChartView(displayPitch);
+        } else {
+            chartDrawn = false;
+            canvas.fillScreen(BLACK);
+            drawHeader();
+            if (diagMode) drawDiagView(displayPitch);
+            else          drawRunView(displayPitch);
+        }
+        pushDirtyTiles(all);
+    }
+}
+
+void displayInit() {
+    snprintf(ipText, sizeof(ipText), "%s", myIP.c_str());
+
+    canvas.setColorDepth(16);
+    canvas.setPsram(true);
+    frame = (uint16_t *)canvas.createSprite(screenW, screenH);
+    tilesX = screenW / DISPLAY_TILE_W;
+    tilesY = screenH / DISPLAY_TILE_H;
+    tileHash = (uint32_t *)calloc(tilesX * tilesY, sizeof(uint32_t));
+    if (!frame || !tileHash) {
+        Serial.println("[DISP] sprite alloc failed, LCD static");
+        return;
+    }
+    xTaskCreatePinnedToCore(displayTask, "display", DISPLAY_TASK_STACK, nullptr,
+                            DISPLAY_TASK_PRIO, nullptr, DISPLAY_TASK_CORE);
 }
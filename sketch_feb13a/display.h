@@ -1,10 +1,16 @@
 #pragma once
 /**
- * display.h — CoreS3 LCD 屏幕显示
+ * display.h — CoreS3 LCD 屏幕显示 (核 0 低优先级任务, 离屏 sprite + 脏块 DMA 推送)
+ *
+ * 控制核不再做任何 SPI 操作, 平衡期间也持续刷新。
  */
 
-// 绘制主 UI 框架 (标题栏 + IP)
+// 创建 sprite 与显示任务 (WiFi 连接提示之后调用)
+void displayInit();
+
+// 请求整屏重绘 (标题栏 + IP); 任意核可调用, 下一帧生效
 void drawMainUI();
 
-// 刷新动态数据 (角度条、PID、状态)
-void updateDisplay();
+// 曲线模式: pitch/target 与 PID 输出/电流扫描曲线, 30fps; 任意核可调用
+void displaySetChartMode(bool on);
+bool displayChartMode();
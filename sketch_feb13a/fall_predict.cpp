@@ -0,0 +1,137 @@
+/**
+ * fall_predict.cpp — 相平面跌倒预测
+ *
+ * 线性化倒立摆, 以电流 (mA) 表示轮上力矩: θ'' = ω0²·(θ - I/G), G = PEND_GRAVITY_MA_PER_DEG
+ * (1° 倾角的重力矩折合电流)。电流饱和在 ±Imax 时, 平衡点移到 θs = Imax/G, 此时系统为
+ * 以 θs 为中心的鞍点, 能被拉回的充要条件是发散分量 (capture point)
+ *
+ *     x = θ + ω·(1/ω0 + τ)         τ = 指令→力矩时延 FP_LATENCY_S
+ *
+ * 满足 |x| < θs。裕度 margin = θs - |x| (°)。Imax 每拍取热限流 / 电源预算 / 硬上限的
+ * 最小值, 电池电压低或电机发热时捕获区随之缩小。
+ *
+ * 判定 (同时满足才算不可恢复, 避免大幅驾驶或冲击时误判):
+ *   margin < -FP_MARGIN_SOFT_DEG 连续 FP_CONFIRM_TICKS 拍, 且近期电流饱和比例 ≥ FP_SAT_MIN
+ *   或 margin < -FP_MARGIN_HARD_DEG 连续 FP_CONFIRM_TICKS 拍 (深度越界, 不看饱和)
+ * 判定后输出先限到判定时的 Imax, 再在 FP_RAMP_MS 内线性降到 0 后进入跌倒,
+ * 不再以 1A 对抗到 FALL_ANGLE; 斜坡期间旧判据仍有效, 先成立者断电。
+ *
+ * 判定后继续观察旧判据 (|pitch| > FALL_ANGLE 连续 FALL_CONFIRM_COUNT 拍) 何时成立,
+ * 在 FP 事件中报告提前量; FP_OBSERVE_MS 内未成立报 -1 (可能误判, 或停在支架上未越过)。
+ */
+
+#include "fall_predict.h"
+#include "config.h"
+#include "power_mgmt.h"
+#include "thermal_model.h"
+#include "web_control.h"
+
+static float    satFrac      = 0;    // 电流饱和比例 (指数平均)
+static float    margin       = 0;
+static int      outsideTicks = 0;
+static int      deepTicks    = 0;
+static bool     ramping      = false;
+static uint32_t rampStartMs  = 0;
+
+// ---- 判定事件 (控制拍写, loop 上报) ----
+struct FallEvent {
+    uint32_t ms;
+    float    pitch, rate, margin, sat, limitMa;
+    int32_t  leadMs;   // 旧判据成立时刻 - 判定时刻, -1 = 观察窗内未成立
+};
+static FallEvent         ev;
+static bool              observing    = false;
+static int               oldConfirm   = 0;
+static volatile uint32_t readySeq     = 0;
+static uint32_t          sentSeq      = 0;
+
+static float captureLimitMa() {
+    float lim = (float)min(thermalLimitMa(THERMAL_R), thermalLimitMa(THERMAL_L));
+    lim = min(lim, powerStatus().budgetMa * 0.5f);
+    return min(lim, (float)CURRENT_MODE_LIMIT_MA);
+}
+
+void fallPredictReset() {
+    satFrac = 0;
+    margin = 0;
+    outsideTicks = deepTicks = 0;
+    ramping = false;
+}
+
+bool fallPredictActive() {
+    return ramping;
+}
+
+float fallPredictMargin() {
+    return margin;
+}
+
+float fallPredictLimitMa() {
+    return ev.limitMa;
+}
+
+float fallPredictUpdate(float pitchDeg, float rateDps, float cmdMa, float dt) {
+    if (ramping) {
+        float k = 1.0f - (float)(millis() - rampStartMs) / (float)FP_RAMP_MS;
+        if (k <= 0.0f) {
+            ramping = false;
+            return 0.0f;
+        }
+        return k;
+    }
+
+    const float limitMa = captureLimitMa();
+    satFrac += ((cmdMa >= limitMa * FP_SAT_LEVEL ? 1.0f : 0.0f) - satFrac) * FP_SAT_ALPHA;
+
+    const float thetaS = limitMa / PEND_GRAVITY_MA_PER_DEG;
+    const float x = pitchDeg + rateDps * (1.0f / PEND_OMEGA0 + FP_LATENCY_S);
+    margin = thetaS - fabsf(x);
+
+    outsideTicks = (margin < -FP_MARGIN_SOFT_DEG) ? outsideTicks + 1 : 0;
+    deepTicks    = (margin < -FP_MARGIN_HARD_DEG) ? deepTicks + 1 : 0;
+
+    const bool soft = outsideTicks >= FP_CONFIRM_TICKS && satFrac >= FP_SAT_MIN;
+    const bool hard = deepTicks >= FP_CONFIRM_TICKS;
+    if (!FP_ENABLE || !(soft || hard)) return 1.0f;
+
+    ramping     = true;
+    rampStartMs = millis();
+
+    // 上一事件尚未观察完时直接覆盖 (两次判定间隔 < FP_OBSERVE_MS 只可能是重新站起后又倒)
+    ev.ms      = rampStartMs;
+    ev.pitch   = pitchDeg;
+    ev.rate    = rateDps;
+    ev.margin  = margin;
+    ev.sat     = satFrac;
+    ev.limitMa = limitMa;
+    ev.leadMs  = -1;
+    observing  = true;
+    oldConfirm = 0;
+    return 1.0f;
+}
+
+void fallPredictObserve(float pitchDeg) {
+    if (!observing) return;
+    const uint32_t now = millis();
+    oldConfirm = (fabsf(pitchDeg) > FALL_ANGLE) ? oldConfirm + 1 : 0;
+    if (oldConfirm >= FALL_CONFIRM_COUNT) {
+        ev.leadMs = (int32_t)(now - ev.ms);
+    } else if (now - ev.ms < FP_OBSERVE_MS) {
+        return;
+    }
+    observing = false;
+    __atomic_store_n(&readySeq, readySeq + 1, __ATOMIC_RELEASE);
+}
+
+void fallPredictPump() {
+    const uint32_t seq = __atomic_load_n(&readySeq, __ATOMIC_ACQUIRE);
+    if (seq == sentSeq) return;
+    sentSeq = seq;
+
+    // FP,seq,pitch,rate,margin,satFrac,limitMa,leadMs
+    char msg[96];
+    snprintf(msg, sizeof(msg), "FP,%lu,%.2f,%.1f,%.2f,%.2f,%.0f,%ld", (unsigned long)seq, ev.pitch,
+             ev.rate, ev.margin, ev.sat, ev.limitMa, (long)ev.leadMs);
+    webBroadcastText(msg);
+    Serial.printf("[FP] %s\n", msg);
+}
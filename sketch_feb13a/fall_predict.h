@@ -0,0 +1,29 @@
+#pragma once
+/**
+ * fall_predict.h — 相平面跌倒预测: pitch/角速度越出电流上限可捕获区域 + 电流饱和历史
+ *                  → 提前判定不可恢复, 力矩斜坡降到 0, 记录预测裕度与提前量 (FP)
+ */
+
+#include <Arduino.h>
+
+// 启动平衡 / 进入跌倒时清零 (activateBalance / enterFallen); 不影响进行中的提前量观察
+void fallPredictReset();
+
+// 平衡中每拍调用 (恢复保护期除外): pitch °, 角速度 °/s, 本拍电流指令幅值 mA。
+// 返回输出缩放: 1 = 正常; 判定后按 FP_RAMP_MS 从 1 斜坡降到 0; 返回 0 时应进入跌倒状态
+float fallPredictUpdate(float pitchDeg, float rateDps, float cmdMa, float dt);
+
+// 已判定不可恢复, 正在斜坡降力矩
+bool fallPredictActive();
+
+// 每拍调用 (含跌倒后): 判定后继续观察旧判据 (|pitch| > FALL_ANGLE 确认) 何时成立, 得出提前量
+void fallPredictObserve(float pitchDeg);
+
+// 当前捕获裕度 (°, 负值 = 在捕获区外)
+float fallPredictMargin();
+
+// 判定时刻的电流上限 (mA): 斜坡以此为起点缩放
+float fallPredictLimitMa();
+
+// loop 中调用: 观察结束后广播 FP 事件
+void fallPredictPump();
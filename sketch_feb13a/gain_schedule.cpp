@@ -0,0 +1,127 @@
+/**
+ * gain_schedule.cpp — 增益调度表
+ *
+ * 表格 [Vin][speed][pitch] 存 Kp/Kd 倍率, 共 36 个单元 (288 字节), 常驻 DRAM。
+ * 查表只做 clamp + 取整 + 8 角点加权, 无分支查找, 每拍约百余周期。
+ *
+ * 默认表复现原先的恢复模式: 格点 |pitch| ≥ RECOVERY_ENTER_ANGLE (即 10°/15°) 用
+ * RECOVERY_KP/DEFAULT_KP 与 RECOVERY_KD/DEFAULT_KD, 0°/5° 用 1.0 倍, 中间线性过渡
+ * (代替旧的 RECOVERY_EXIT_ANGLE=5° / RECOVERY_ENTER_ANGLE=8° 二值切换)。
+ */
+
+#include "gain_schedule.h"
+#include "config.h"
+#include <Preferences.h>
+
+static const char *NVS_NS  = "gsched";
+static const char *NVS_KEY = "tbl";
+static const uint16_t TABLE_VERSION = 1;
+
+static struct {
+    uint16_t  version;
+    uint8_t   dims[3];   // pitch, speed, vin 点数 (尺寸变化后旧记录作废)
+    uint8_t   pad;
+    GainScale cell[GS_VIN_N][GS_SPEED_N][GS_PITCH_N];
+} table;
+
+static const float PITCH_INV = 1.0f / GS_PITCH_STEP;
+static const float SPEED_INV = 1.0f / GS_SPEED_STEP;
+static const float VIN_INV   = 1.0f / GS_VIN_STEP;
+
+// 轴坐标 → 下标 + 小数部分; 超出范围时钳到最后一个区间末端
+static inline int axisIndex(float u, int n, float *frac) {
+    u = fminf(fmaxf(u, 0.0f), (float)(n - 1) - 1e-4f);
+    int i = (int)u;
+    *frac = u - (float)i;
+    return i;
+}
+
+static inline GainScale lerpCell(const GainScale &a, const GainScale &b, float t) {
+    GainScale r;
+    r.kp = a.kp + (b.kp - a.kp) * t;
+    r.kd = a.kd + (b.kd - a.kd) * t;
+    return r;
+}
+
+void gainScheduleReset() {
+    const float kpRec = RECOVERY_KP / DEFAULT_KP;
+    const float kdRec = RECOVERY_KD / DEFAULT_KD;
+    table.version = TABLE_VERSION;
+    table.dims[0] = GS_PITCH_N;
+    table.dims[1] = GS_SPEED_N;
+    table.dims[2] = GS_VIN_N;
+    table.pad = 0;
+    for (int iv = 0; iv < GS_VIN_N; iv++) {
+        for (int is = 0; is < GS_SPEED_N; is++) {
+            for (int ip = 0; ip < GS_PITCH_N; ip++) {
+                bool recovery = (ip * GS_PITCH_STEP) >= RECOVERY_ENTER_ANGLE;
+                table.cell[iv][is][ip].kp = recovery ? kpRec : 1.0f;
+                table.cell[iv][is][ip].kd = recovery ? kdRec : 1.0f;
+            }
+        }
+    }
+}
+
+void gainScheduleInit() {
+    gainScheduleReset();
+
+    Preferences prefs;
+    if (!prefs.begin(NVS_NS, true)) return;
+    if (prefs.getBytesLength(NVS_KEY) == sizeof(table)) {
+        uint8_t buf[sizeof(table)];
+        prefs.getBytes(NVS_KEY, buf, sizeof(buf));
+        uint16_t ver;
+        memcpy(&ver, buf, sizeof(ver));
+        if (ver == TABLE_VERSION && buf[2] == GS_PITCH_N &&
+            buf[3] == GS_SPEED_N && buf[4] == GS_VIN_N) {
+            memcpy(&table, buf, sizeof(table));
+        }
+    }
+    prefs.end();
+}
+
+bool gainScheduleSave() {
+    Preferences prefs;
+    if (!prefs.begin(NVS_NS, false)) return false;
+    size_t n = prefs.putBytes(NVS_KEY, &table, sizeof(table));
+    prefs.end();
+    return n == sizeof(table);
+}
+
+bool gainScheduleSetCell(int ip, int is, int iv, float kpMul, float kdMul) {
+    if (ip < 0 || ip >= GS_PITCH_N) return false;
+    if (is < 0 || is >= GS_SPEED_N) return false;
+    if (iv < 0 || iv >= GS_VIN_N) return false;
+    if (!(kpMul >= 0.0f && kpMul <= GS_MUL_MAX)) return false;
+    if (!(kdMul >= 0.0f && kdMul <= GS_MUL_MAX)) return false;
+    table.cell[iv][is][ip].kp = kpMul;
+    table.cell[iv][is][ip].kd = kdMul;
+    return true;
+}
+
+GainScale gainScheduleGetCell(int ip, int is, int iv) {
+    ip = constrain(ip, 0, GS_PITCH_N - 1);
+    is = constrain(is, 0, GS_SPEED_N - 1);
+    iv = constrain(iv, 0, GS_VIN_N - 1);
+    return table.cell[iv][is][ip];
+}
+
+// ============ 三线性插值 ============
+GainScale gainScheduleLookup(float absPitchDeg, float absSpeedMMs, float vin) {
+    // 尚无电压读数 (0) 时按标称电压查表
+    vin = (vin > 1.0f) ? vin : GS_VIN_NOMINAL;
+
+    float fp, fs, fv;
+    int ip = axisIndex(absPitchDeg * PITCH_INV, GS_PITCH_N, &fp);
+    int is = axisIndex(absSpeedMMs * SPEED_INV, GS_SPEED_N, &fs);
+    int iv = axisIndex((vin - GS_VIN_MIN) * VIN_INV, GS_VIN_N, &fv);
+
+    const GainScale (*v0)[GS_PITCH_N] = table.cell[iv];
+    const GainScale (*v1)[GS_PITCH_N] = table.cell[iv + 1];
+
+    GainScale a = lerpCell(lerpCell(v0[is][ip], v0[is][ip + 1], fp),
+                           lerpCell(v0[is + 1][ip], v0[is + 1][ip + 1], fp), fs);
+    GainScale b = lerpCell(lerpCell(v1[is][ip], v1[is][ip + 1], fp),
+                           lerpCell(v1[is + 1][ip], v1[is + 1][ip + 1], fp), fs);
+    return lerpCell(a, b, fv);
+}
@@ -0,0 +1,26 @@
+#pragma once
+/**
+ * gain_schedule.h — 增益调度: |pitch| × |线速度| × Vin 三维查表 + 三线性插值
+ */
+
+#include <Arduino.h>
+
+// Kp/Kd 倍率 (相对当前 Kp/Kd)
+struct GainScale {
+    float kp;
+    float kd;
+};
+
+// 加载 NVS 中保存的表 (无记录或尺寸不符时使用默认表)
+void gainScheduleInit();
+
+// 每个控制周期调用: 查表插值, 轴外取边界值
+GainScale gainScheduleLookup(float absPitchDeg, float absSpeedMMs, float vin);
+
+// 单元读写 (ip: pitch 轴, is: 速度轴, iv: 电压轴); 越界或倍率非法返回 false
+bool gainScheduleSetCell(int ip, int is, int iv, float kpMul, float kdMul);
+GainScale gainScheduleGetCell(int ip, int is, int iv);
+
+// 恢复默认表 (不写 NVS) / 写入 NVS
+void gainScheduleReset();
+bool gainScheduleSave();
@@ -12,7 +12,7 @@ extern float lastError;
 extern float pidOutput;
 
 // ============ 控制链路调试 ============
-extern float ctrlDtMs;           // 本控制周期时长(ms)
+extern float ctrlDtMs;           // 相邻两拍实际间隔(ms, 补拍时小于 2ms)
 extern float dbgPidRaw;          // PID原始输出(未限幅)
 extern float dbgPidClamped;      // PID限幅后
 extern float dbgAfterDeadzone;   // 死区/静摩擦补偿后(基准输出)
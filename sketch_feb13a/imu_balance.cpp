@@ -12,6 +12,16 @@
 #include "config.h"
 #include "globals.h"
 #include "can_motor.h"
+#include "fall_predict.h"
+#include "gain_schedule.h"
+#include "joystick_input.h"
+#include "motion_control.h"
+#include "motor_charact.h"
+#include "power_mgmt.h"
+#include "profiler.h"
+#include "standup.h"
+#include "supervisor.h"
+#include "thermal_model.h"
 #include <M5Unified.h>
 
 static float         filteredGyro  = 0;
@@ -70,9 +80,9 @@ static int applySlewLimit(int target, int previous) {
 }
 
 static void stopBenchStepInternal() {
+    // benchStartRpm 保留到下次启动, 供遥测上报
     benchMode = false;
     benchCmdRpm = 0;
-    benchStartRpm = -1;
     clearControlOutputState();
     stopMotors();
 }
@@ -108,8 +118,12 @@ static void runBenchStepTest() {
 
 // ============ 姿态更新 (互补滤波, 无需校准) ============
 void updateIMU(float dt) {
+    PROF_BEGIN(PROF_IMU_READ);
     M5.Imu.update();
     auto d = M5.Imu.getImuData();
+    PROF_END(PROF_IMU_READ);
+
+    PROF_BEGIN(PROF_FILTER);
 
     // 原始加速度 Pitch (调试/屏幕显示)
     rawAccelPitchDeg = atan2f(d.accel.z, d.accel.y) * RAD_TO_DEG;
@@ -141,12 +155,50 @@ void updateIMU(float dt) {
     filteredGyro = GYRO_LPF_ALPHA * filteredGyro + (1.0f - GYRO_LPF_ALPHA) * rawGyroX;
     
     gyroRate = rawGyroX;
+    PROF_END(PROF_FILTER);
+}
+
+float filteredGyroRate() {
+    return filteredGyro;
+}
+
+static void enterFallen() {
+    stopMotors();
+    fallen              = true;
+    softStartActive     = false;
+    startupGraceActive  = false;
+    positionLockActive  = false;
+    stableCount         = 0;
+    fallConfirmCount    = 0;
+    pidIntegral         = 0;
+    smoothPhoneX        = 0;
+    smoothPhoneY        = 0;
+    clearControlOutputState();
+    motionAbortFallen();
+    fallPredictReset();
 }
 
 // ============ PID 平衡控制 ============
 void balanceControl(float dt) {
+    PROF_BEGIN(PROF_PID);
     float controlPitch = currentPitch + PITCH_MOUNT_OFFSET;
-    ctrlDtMs = dt * 1000.0f;
+
+    // 实际拍间隔 (补拍时小于 dt, WiFi 阻塞后大于 dt); 控制计算仍用固定 dt
+    static unsigned long lastTickUs = 0;
+    unsigned long tickUs = micros();
+    ctrlDtMs = lastTickUs ? (tickUs - lastTickUs) / 1000.0f : dt * 1000.0f;
+    lastTickUs = tickUs;
+
+    // 电源估计 + 电机热模型每拍更新 (平衡期数据来自 0x02 反馈帧)
+    powerUpdate(dt);
+    thermalUpdate(dt);
+    fallPredictObserve(controlPitch);
+    standupObserve(controlPitch, filteredGyro);
+
+    if (charactActive()) {
+        charactTick(dt);
+        return;
+    }
 
     if (benchMode) {
         runBenchStepTest();
@@ -174,8 +226,14 @@ void balanceControl(float dt) {
         return;
     }
 
-    // ---- 恢复模式管理: 角度回到安全区 或 超时后结束 ----
-    if (startupGraceActive) {
+    // 安全监督已切断输出 (心跳/反馈/过流/过角): 按跌倒处理, Stand 解锁
+    if (supervisorTripped()) {
+        enterFallen();
+        return;
+    }
+
+    // ---- 恢复模式管理: 角度回到安全区 或 超时后结束 (自立曲线回放期间保持) ----
+    if (startupGraceActive && !standupActive()) {
         if (fabs(controlPitch) < RECOVERY_EXIT_ANGLE) {
             startupGraceActive = false;
         } else if ((millis() - startupGraceMs) >= STANDUP_GRACE_MS) {
@@ -183,20 +241,11 @@ void balanceControl(float dt) {
         }
     }
 
+    // 跌倒预测的斜坡期间旧判据仍有效: 两者谁先成立谁断电
     if (!startupGraceActive && fabs(controlPitch) > FALL_ANGLE) {
         fallConfirmCount++;
         if (fallConfirmCount >= FALL_CONFIRM_COUNT) {
-            stopMotors();
-            fallen              = true;
-            softStartActive     = false;
-            startupGraceActive  = false;
-            positionLockActive  = false;
-            stableCount         = 0;
-            fallConfirmCount    = 0;
-            pidIntegral         = 0;
-            smoothPhoneX        = 0;
-            smoothPhoneY        = 0;
-            clearControlOutputState();
+            enterFallen();
             return;
         }
     } else {
@@ -207,6 +256,10 @@ void balanceControl(float dt) {
     targetAngleFilt = TARGET_LPF_ALPHA * targetAngleFilt
                     + (1.0f - TARGET_LPF_ALPHA) * targetAngle;
 
+    // ---- 轨迹跟踪: 参考路程/速度作为位置+速度环的锚点与零点, 另给转向设定 ----
+    MotionSetpoint motion;
+    bool tracking = !startupGraceActive && motionTick(dt, &motion);
+
     // ---- 位置+速度环: 修正目标角度 (而非 PID 输出) ----
     float adjustedTarget = targetAngleFilt;
     if (!startupGraceActive) {
@@ -218,20 +271,25 @@ void balanceControl(float dt) {
         }
         if (fabs(phoneY) > 1.0f)
             anchorDistanceMM = distanceMM;
+        if (tracking)
+            anchorDistanceMM = motion.anchorMM;  // 结束后锚点停在参考终点
 
         float posCorr = (distanceMM - anchorDistanceMM) * POSITION_K;
-        float velCorr = filteredLinSpeed * VELOCITY_K;
+        float velCorr = (filteredLinSpeed - (tracking ? motion.speedMMs : 0.0f)) * VELOCITY_K;
         float totalCorr = constrain(posCorr + velCorr,
                                     -POS_VEL_CORR_LIMIT, POS_VEL_CORR_LIMIT);
-        adjustedTarget += totalCorr;
+        adjustedTarget += totalCorr + (tracking ? motion.leanDeg : 0.0f);
     } else {
         filteredLinSpeed = 0;
         positionLockActive = false;
     }
 
+    // ---- 增益调度: |pitch| × |线速度| × Vin 插值 (取代恢复模式 Kp/Kd 二值切换) ----
+    GainScale gs = gainScheduleLookup(fabs(controlPitch), fabs(linearSpeed), powerStatus().vbus);
+
     // ---- 角度 PID (内环: 输出 RPM) ----
-    float useKp = startupGraceActive ? RECOVERY_KP : Kp;
-    float useKd = startupGraceActive ? RECOVERY_KD : Kd;
+    float useKp = Kp * gs.kp;
+    float useKd = Kd * gs.kd;
 
     float error = controlPitch - adjustedTarget;
     if (fabs(error) < INTEGRAL_DECAY_THRESHOLD) {
@@ -261,25 +319,45 @@ void balanceControl(float dt) {
     }
     pidOutput = clampedOutput * softGain;
 
-    // ---- 温度保护降额 ----
-    float tempMax = max(motorTempR, motorTempL);
-    if (tempMax > TEMP_THROTTLE_DEG) {
-        // 超温 20°C 时降到 30%，线性插值
-        float throttle = constrain(1.0f - (tempMax - TEMP_THROTTLE_DEG) / 20.0f, 0.3f, 1.0f);
-        pidOutput *= throttle;
+    // ---- 支架自立: 回放规划电流曲线; 到交接点或跟踪失败后由 PID 接管, 保护期重新计时 ----
+    if (standupActive()) {
+        float standupMa;
+        if (standupTick(controlPitch, filteredGyro, &standupMa)) {
+            pidOutput = standupMa / (CURRENT_MODE_GAIN_MA_PER_RPM * powerCompGain()) * BALANCE_DIR;
+        } else {
+            startupGraceMs = millis();
+        }
+    }
+
+    // ---- 跌倒预测: 相平面越出捕获区且电流已饱和 → 力矩斜坡降到 0 后进入跌倒 ----
+    float fallScale = 1.0f;   // 平衡输出与转向/偏航修正同比例缩放, 左右轮指令一起降到 0
+    if (!startupGraceActive && getMotorMode() == MODE_CURRENT) {
+        float maPerOut = CURRENT_MODE_GAIN_MA_PER_RPM * powerCompGain();
+        fallScale = fallPredictUpdate(controlPitch, filteredGyro, fabs(pidOutput) * maPerOut, dt);
+        if (fallScale <= 0.0f) {
+            enterFallen();
+            return;
+        }
+        if (fallScale < 1.0f) {
+            // 先限到实际可输出的电流再缩放, 否则深度饱和时斜坡前段不起作用
+            float outLim = fallPredictLimitMa() / maPerOut;
+            pidOutput = constrain(pidOutput, -outLim, outLim) * fallScale;
+        }
     }
 
     // ---- 偏航修正: 轮速和 = 旋转分量, 反馈抑制原地自旋 ----
     float yawRate = ((float)actualSpeedR + (float)actualSpeedL) * 0.5f;
-    float yawCorr = yawRate * YAW_K;
+    float yawCorr = (yawRate - (tracking ? motion.yawRpm : 0.0f)) * YAW_K;
 
     // ---- 移动输入平滑 + 转向 (手机 X 输入, 增益 0.15 → max +-15 RPM) ----
     smoothPhoneY = MOVE_INPUT_LPF * smoothPhoneY + (1.0f - MOVE_INPUT_LPF) * phoneY;
     smoothPhoneX = STEER_INPUT_LPF * smoothPhoneX + (1.0f - STEER_INPUT_LPF) * phoneX;
-    float steer = smoothPhoneX * STEER_GAIN;
+    float steer = smoothPhoneX * STEER_GAIN + (tracking ? motion.steerRpm : 0.0f);
     int baseOut = constrain((int)pidOutput, -OUTPUT_LIMIT, OUTPUT_LIMIT);
     dbgAfterDeadzone = (float)baseOut;
 
+    steer   *= fallScale;
+    yawCorr *= fallScale;
     int targetR = constrain((int)(pidOutput + steer - yawCorr), -OUTPUT_LIMIT, OUTPUT_LIMIT);
     int targetL = constrain((int)(pidOutput - steer + yawCorr), -OUTPUT_LIMIT, OUTPUT_LIMIT);
     int slewR = applySlewLimit(targetR, lastCmdRpmR);
@@ -294,6 +372,7 @@ void balanceControl(float dt) {
 
     cmdSpdR = outR;
     cmdSpdL = outL;
+    PROF_END(PROF_PID);
     driveMotors(outR, outL);
 
     distanceMM += linearSpeed * dt;
@@ -302,7 +381,7 @@ void balanceControl(float dt) {
 
 // ============ 安全启动: 角度 + 角速度 + 连续稳定窗口三重门限 ============
 bool activateBalance() {
-    if (benchMode) {
+    if (benchMode || supervisorTripped()) {
         return false;
     }
 
@@ -314,8 +393,7 @@ bool activateBalance() {
     if (angleOk && gyroOk && stableOk) {
         diagMode        = false;
         fallen          = false;
-        phoneX          = 0;
-        phoneY          = 0;
+        joystickReset();
         smoothPhoneX    = 0;
         smoothPhoneY    = 0;
         pidIntegral        = 0;
@@ -329,11 +407,14 @@ bool activateBalance() {
         anchorDistanceMM   = 0;
         positionLockActive = false;
         clearControlOutputState();
+        fallPredictReset();
+        motionReset();
         if (fabs(controlPitch) >= RECOVERY_ENTER_ANGLE) {
-            // 大角度启动(>8°): 恢复模式, 跳过软启动, 立即全力回正
+            // 大角度启动(>8°): 恢复模式, 跳过软启动; 从支架起身优先回放规划曲线
             startupGraceActive = true;
             startupGraceMs     = millis();
             softStartActive    = false;
+            standupBegin(controlPitch);
         } else {
             // 小角度启动: 软启动斜坡
             startupGraceActive = false;
@@ -346,6 +427,10 @@ bool activateBalance() {
     return false;
 }
 
+int benchStepStartRpm() {
+    return benchStartRpm;
+}
+
 void setBenchStepTest(bool on) {
     if (on) {
         benchMode = true;
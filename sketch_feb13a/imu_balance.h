@@ -6,6 +6,9 @@
 // 姿态更新 (互补滤波, 每个控制周期调用)
 void updateIMU(float dt);
 
+// D 项使用的低通后 pitch 角速度 (°/s)
+float filteredGyroRate();
+
 // PID 平衡控制 (计算电机输出并驱动)
 void balanceControl(float dt);
 
@@ -15,3 +18,6 @@ bool activateBalance();
 
 // 架空轮静态阶跃实验: true=启动 0~30RPM 阶跃扫描, false=停止并清零
 void setBenchStepTest(bool on);
+
+// 最近一次阶跃扫描中轮子开始转动的指令 RPM (-1 = 未起转/未运行)
+int benchStepStartRpm();
@@ -0,0 +1,149 @@
+/**
+ * joystick_input.cpp — 摇杆输入通道
+ *
+ * 页面按键期间以 20Hz 发送 (序号, 客户端毫秒时间戳, x, y)。序号按 16 位回绕比较,
+ * 不比同一来源上一包新的直接丢弃; 该来源超时后 (或断线) 接受任意序号, 兼容页面刷新后
+ * 序号归零。WebSocket 与 UDP 各有序号/时钟偏移状态, 两路同时在发时互不判旧。
+ * 新样本到达时, 输出从当前值线性过渡到新值, 过渡时长取实测到达间隔
+ * (上限 JOY_INTERP_MAX_MS), 使 500Hz 控制环看到连续输入而不是 20Hz 阶梯。
+ * 超过 JOY_TIMEOUT_MS 未收到新包, 输出按 JOY_DECAY_TAU_S 指数衰减到 0。
+ */
+
+#include "joystick_input.h"
+#include "config.h"
+#include "globals.h"
+
+static float fromX = 0, fromY = 0;     // 插值起点 (页面坐标)
+static float toX = 0, toY = 0;         // 插值终点
+static float outX = 0, outY = 0;
+static float interpT = 1.0f;           // 0..1
+static float interpS = 0.05f;          // 本段插值时长 (s)
+
+// 每来源的序号状态
+struct SeqState {
+    bool          have;
+    uint16_t      seq;
+    unsigned long rxMs;
+    int32_t       minOffset;   // 到达时刻 - 客户端时间 的最小值 (时钟差 + 最小单程延迟)
+};
+static SeqState srcSeq[JOY_SRC_N] = {};
+
+static uint16_t lastSeq   = 0;     // 最近受理包 (任一来源), 遥测回传
+static uint32_t lastEcho  = 0;
+static unsigned long lastRxMs = 0;
+static bool     timedOut  = true;
+static uint16_t timeoutMs = JOY_TIMEOUT_MS;
+
+// 统计
+static uint32_t rxCount = 0, rejectCount = 0, timeoutCount = 0;
+static uint32_t winIntervalSum = 0, winIntervalN = 0, winIntervalMax = 0;
+static uint32_t winJitterMax = 0;
+
+static void writeOutputs() {
+    phoneX = -outX;
+    phoneY = -outY;
+    targetAngle = phoneY * MOVE_ANGLE_GAIN;
+}
+
+bool joystickInput(JoySource src, bool hasSeq, uint16_t seq, uint32_t clientMs, int x, int y) {
+    unsigned long nowMs = millis();
+
+    if (hasSeq && src < JOY_SRC_N) {
+        SeqState &st = srcSeq[src];
+        bool fresh = !st.have || timedOut || (nowMs - st.rxMs) > timeoutMs;
+        if (!fresh && (int16_t)(seq - st.seq) <= 0) {
+            rejectCount++;
+            return false;
+        }
+        int32_t offset = (int32_t)(nowMs - clientMs);
+        if (fresh || offset < st.minOffset) st.minOffset = offset;
+        st.have = true;
+        st.seq  = seq;
+        st.rxMs = nowMs;
+        lastSeq  = seq;
+        lastEcho = clientMs;
+
+        uint32_t jitter = (uint32_t)(offset - st.minOffset);
+        if (jitter > winJitterMax) winJitterMax = jitter;
+    }
+
+    if (rxCount > 0 && !timedOut) {
+        uint32_t gap = nowMs - lastRxMs;
+        winIntervalSum += gap;
+        winIntervalN++;
+        if (gap > winIntervalMax) winIntervalMax = gap;
+        interpS = min(gap, (uint32_t)JOY_INTERP_MAX_MS) / 1000.0f;
+    } else {
+        interpS = JOY_INTERP_MAX_MS / 1000.0f;
+    }
+
+    rxCount++;
+    lastRxMs = nowMs;
+    timedOut = false;
+
+    fromX = outX;
+    fromY = outY;
+    toX = constrain(x, -100, 100);
+    toY = constrain(y, -100, 100);
+    interpT = 0.0f;
+    return true;
+}
+
+void joystickUpdate(float dt) {
+    if (!timedOut && (millis() - lastRxMs) > timeoutMs) {
+        timedOut = true;
+        timeoutCount++;
+    }
+
+    if (timedOut) {
+        float k = expf(-dt / JOY_DECAY_TAU_S);
+        outX *= k;
+        outY *= k;
+        if (fabs(outX) < 0.5f) outX = 0;
+        if (fabs(outY) < 0.5f) outY = 0;
+    } else if (interpT < 1.0f) {
+        interpT = fminf(1.0f, interpT + dt / interpS);
+        outX = fromX + (toX - fromX) * interpT;
+        outY = fromY + (toY - fromY) * interpT;
+    }
+    writeOutputs();
+}
+
+void joystickReset() {
+    outX = outY = fromX = fromY = toX = toY = 0;
+    interpT = 1.0f;
+    timedOut = true;
+    writeOutputs();
+}
+
+bool joystickSetTimeout(uint32_t ms) {
+    if (ms < JOY_TIMEOUT_MIN_MS || ms > JOY_TIMEOUT_MAX_MS) return false;
+    timeoutMs = (uint16_t)ms;
+    return true;
+}
+
+uint32_t joystickTimeout() {
+    return timeoutMs;
+}
+
+void joystickLastSample(uint16_t *seq, uint32_t *clientMs) {
+    *seq = lastSeq;
+    *clientMs = lastEcho;
+}
+
+JoystickStats joystickLatchStats() {
+    JoystickStats s;
+    s.rx = rxCount;
+    s.rejected = rejectCount;
+    s.timeouts = timeoutCount;
+    s.lastSeq = lastSeq;
+    s.echoTs = lastEcho;
+    s.holdMs = millis() - lastRxMs;
+    s.intervalMeanMs = winIntervalN ? (float)winIntervalSum / winIntervalN : 0.0f;
+    s.intervalMaxMs = winIntervalMax;
+    s.jitterMaxMs = winJitterMax;
+    s.timeoutMs = timeoutMs;
+    winIntervalSum = winIntervalN = winIntervalMax = 0;
+    winJitterMax = 0;
+    return s;
+}
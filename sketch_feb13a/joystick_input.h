@@ -0,0 +1,40 @@
+#pragma once
+/**
+ * joystick_input.h — 摇杆输入通道: 序号 + 客户端时间戳, 乱序丢弃, 样本间插值, 超时衰减
+ */
+
+#include <Arduino.h>
+
+struct JoystickStats {
+    uint32_t rx;            // 受理的包
+    uint32_t rejected;      // 乱序/重复丢弃
+    uint32_t timeouts;      // 超时衰减次数
+    uint16_t lastSeq;
+    uint32_t echoTs;        // 最近受理包的客户端时间戳 (原样回传, 页面据此算往返)
+    uint32_t holdMs;        // 该包到达至今 (ms)
+    float    intervalMeanMs;  // 本窗口平均到达间隔
+    uint32_t intervalMaxMs;   // 本窗口最大到达间隔
+    uint32_t jitterMaxMs;     // 本窗口 (到达 - 客户端时间) 相对最小值的最大偏差
+    uint16_t timeoutMs;
+};
+
+// 摇杆来源: 各自独立的序号空间 (页面 WebSocket 与主机 UDP 工具可能同时在发)
+enum JoySource : uint8_t { JOY_SRC_WS, JOY_SRC_UDP, JOY_SRC_N };
+
+// 收到一个摇杆样本 (x/y: 页面坐标 -100..100); hasSeq=false 为旧格式, 不做乱序检查
+bool joystickInput(JoySource src, bool hasSeq, uint16_t seq, uint32_t clientMs, int x, int y);
+
+// 每个控制周期调用: 插值 / 超时衰减, 写 phoneX/phoneY/targetAngle
+void joystickUpdate(float dt);
+
+// 断线 / 启动平衡时清零
+void joystickReset();
+
+bool joystickSetTimeout(uint32_t ms);
+uint32_t joystickTimeout();
+
+// 最近受理包的序号与客户端时间戳 (遥测回传, 不影响统计窗口)
+void joystickLastSample(uint16_t *seq, uint32_t *clientMs);
+
+// 读取统计并开始新窗口
+JoystickStats joystickLatchStats();
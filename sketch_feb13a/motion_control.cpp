@@ -0,0 +1,324 @@
+/**
+ * motion_control.cpp — 轨迹跟踪
+ *
+ * 参考生成 (每拍): 队首条目给出指令 (v, ω), 经加速度/角加速度限幅得到参考 vRef/ωRef,
+ * 积分成参考位姿 (xr, yr, ψr) 与参考路程 sRef。
+ *   TV 定时点  同一段连续的 TV 以首点时间为零点, 段内按时间线性插值; 队列取空后指令
+ *              归零减速, 参考停稳即结束 (流式追加需保持队列领先)
+ *   TW 航点    参考位姿朝航点行驶: ω = K·方位误差, v = 巡航速度·cos(方位误差),
+ *              并按 sqrt(2·a·距离) 限速以便在航点前减速; 参考位姿进入 MC_WP_TOL_MM 后出队
+ *
+ * 跟踪 (叠加在平衡之上, 不改内环):
+ *   速度/位置  位置+速度环的锚点取 sBase + sRef, 速度零点取低通后的 vRef; 加速度前馈
+ *              目标角 -atan(a/g) (与速度阻尼同号约定: 目标角减小 → 线速度增大)
+ *   航向       偏航阻尼 YAW_K 的零点移到 ωRef 对应的轮速和 (角速度前馈), 转向只加航向反馈
+ *              MC_YAW_KP·(ψr - ψ - 横向修正); 电流模式下转向量是差动力矩, 二者合成
+ *              角速度跟踪 + 航向 PD
+ *
+ * 位姿由差速里程计积分: v = linearSpeed, ω = (R + L)·周长/60/轮距 (与转向同号,
+ * 转向为正的一侧为 +y)。TG 时以当前位姿为原点, x 沿 linearSpeed 正方向。
+ */
+
+#include "motion_control.h"
+#include "config.h"
+#include "globals.h"
+#include "web_control.h"
+
+enum MotionKind : uint8_t { MC_TIMED, MC_WAYPOINT };
+
+struct MotionEntry {
+    uint8_t  kind;
+    uint32_t tMs;        // TV: 段内时间
+    float    x, y;       // TW: 目标点 mm
+    float    speed;      // mm/s
+    float    yawDps;     // TV: °/s
+};
+
+static MotionEntry queue[MC_QUEUE_LEN];
+static int         qHead  = 0;
+static int         qCount = 0;
+
+// ---- 里程计 (平衡中持续积分) ----
+static float poseX = 0, poseY = 0, posePsi = 0;   // mm, mm, rad
+
+// ---- 参考 ----
+static bool     active    = false;
+static uint32_t startMs   = 0;
+static float    sBase     = 0;                     // TG 时的 distanceMM
+static float    sRef      = 0;
+static float    refX = 0, refY = 0, refPsi = 0;    // mm, mm, rad
+static float    vRef = 0, vRefFilt = 0, wRefDps = 0;
+static bool     blockActive = false;           // 正在执行 TV 段
+static float    blockT      = 0;               // 段内已用时间 (s)
+static uint32_t blockT0Ms   = 0;               // 段首点时间戳
+static MotionEntry prevPoint;                  // 段内插值起点
+
+// ---- 统计 ----
+static uint32_t statN = 0;
+static float    sumAlong2 = 0, sumCross2 = 0, sumPsi2 = 0, sumV2 = 0, maxCross = 0;
+static uint32_t lastReportMs = 0;
+
+// ---- 上报 (控制拍写, loop 广播) ----
+struct TrackSample {
+    uint32_t tMs;
+    float    x, y, psi, xr, yr, psir;
+    float    along, cross, ePsi, vRef, v;
+    int      queued;
+};
+struct TrackSummary {
+    const char *reason;
+    uint32_t    durMs, n;
+    float       rmsAlong, rmsCross, rmsPsi, maxCross, rmsV;
+};
+static TrackSample       sample;
+static TrackSummary      summary;
+static volatile uint32_t sampleSeq = 0;
+static volatile uint32_t endSeq    = 0;
+static uint32_t          sentSample = 0, sentEnd = 0;
+
+static float wrapPi(float a) {
+    while (a > PI) a -= TWO_PI;
+    while (a < -PI) a += TWO_PI;
+    return a;
+}
+
+static void clearQueue() {
+    qHead = qCount = 0;
+    blockActive = false;
+}
+
+static bool push(const MotionEntry &e) {
+    if (qCount >= MC_QUEUE_LEN) return false;
+    queue[(qHead + qCount) % MC_QUEUE_LEN] = e;
+    qCount++;
+    return true;
+}
+
+static void pop() {
+    qHead = (qHead + 1) % MC_QUEUE_LEN;
+    qCount--;
+}
+
+bool motionQueueTimed(uint32_t tMs, float speedMMs, float yawDps) {
+    MotionEntry e = {MC_TIMED, tMs, 0, 0, speedMMs, yawDps};
+    return push(e);
+}
+
+bool motionQueueWaypoint(float xMM, float yMM, float speedMMs) {
+    MotionEntry e = {MC_WAYPOINT, 0, xMM, yMM, speedMMs, 0};
+    return push(e);
+}
+
+int motionQueued() {
+    return qCount;
+}
+
+bool motionActive() {
+    return active;
+}
+
+bool motionStart() {
+    if (fallen || diagMode || benchMode || qCount == 0) return false;
+    poseX = poseY = posePsi = 0;
+    refX = refY = refPsi = 0;
+    sBase = distanceMM;
+    sRef = 0;
+    vRef = vRefFilt = wRefDps = 0;
+    blockActive = false;
+    statN = 0;
+    sumAlong2 = sumCross2 = sumPsi2 = sumV2 = maxCross = 0;
+    startMs = lastReportMs = millis();
+    active = true;
+    return true;
+}
+
+// 按当前误差写一条 TE 采样
+static void snapshot(float along, float cross, float ePsiDeg) {
+    sample.tMs    = millis() - startMs;
+    sample.x      = poseX;
+    sample.y      = poseY;
+    sample.psi    = posePsi * RAD_TO_DEG;
+    sample.xr     = refX;
+    sample.yr     = refY;
+    sample.psir   = refPsi * RAD_TO_DEG;
+    sample.along  = along;
+    sample.cross  = cross;
+    sample.ePsi   = ePsiDeg;
+    sample.vRef   = vRef;
+    sample.v      = linearSpeed;
+    sample.queued = qCount;
+    __atomic_store_n(&sampleSeq, sampleSeq + 1, __ATOMIC_RELEASE);
+}
+
+static void finish(const char *reason) {
+    if (!active) return;
+    active = false;
+    clearQueue();
+    const float n = statN ? (float)statN : 1.0f;
+    summary.reason   = reason;
+    summary.durMs    = millis() - startMs;
+    summary.n        = statN;
+    summary.rmsAlong = sqrtf(sumAlong2 / n);
+    summary.rmsCross = sqrtf(sumCross2 / n);
+    summary.rmsPsi   = sqrtf(sumPsi2 / n);
+    summary.maxCross = maxCross;
+    summary.rmsV     = sqrtf(sumV2 / n);
+    __atomic_store_n(&endSeq, endSeq + 1, __ATOMIC_RELEASE);
+}
+
+void motionStop() {
+    if (active) finish("STOP");
+    clearQueue();
+}
+
+void motionReset() {
+    finish("STOP");   // 急停 (E) 不经 enterFallen, 在重新站立时补报结束
+    clearQueue();
+    poseX = poseY = posePsi = 0;
+}
+
+void motionAbortFallen() {
+    finish("FALL");
+}
+
+// 队首条目 → 本拍指令 (v mm/s, ω °/s); 队列空返回 false
+static bool headCommand(float dt, float *vCmd, float *wCmd) {
+    if (blockActive) blockT += dt;
+    while (qCount > 0) {
+        const MotionEntry &e = queue[qHead];
+        if (e.kind == MC_TIMED) {
+            if (!blockActive) {
+                blockActive = true;
+                blockT      = 0;
+                blockT0Ms   = e.tMs;
+                prevPoint   = e;
+            }
+            const float tMs = blockT0Ms + blockT * 1000.0f;
+            if (tMs >= (float)e.tMs) {
+                prevPoint = e;
+                pop();
+                continue;
+            }
+            const float span = (float)e.tMs - (float)prevPoint.tMs;
+            const float k = span > 0 ? (tMs - (float)prevPoint.tMs) / span : 1.0f;
+            *vCmd = prevPoint.speed + (e.speed - prevPoint.speed) * k;
+            *wCmd = prevPoint.yawDps + (e.yawDps - prevPoint.yawDps) * k;
+            return true;
+        }
+
+        blockActive = false;
+        const float dx = e.x - refX, dy = e.y - refY;
+        const float dist = sqrtf(dx * dx + dy * dy);
+        const float err = wrapPi(atan2f(dy, dx) - refPsi);
+        // 到达, 或已在容差两倍内但航点落在身后 (最小转弯半径大于容差时避免绕圈)
+        if (dist < MC_WP_TOL_MM || (dist < 2.0f * MC_WP_TOL_MM && fabsf(err) > HALF_PI)) {
+            pop();
+            continue;
+        }
+        *vCmd = min(e.speed * max(0.0f, cosf(err)), sqrtf(2.0f * MC_MAX_ACCEL_MMS2 * dist));
+        *wCmd = MC_WP_TURN_K * err * RAD_TO_DEG;
+        return true;
+    }
+    // 队列已空: 指令归零 (定时段计时继续, 流式追加的点按原时间轴接上)
+    return false;
+}
+
+bool motionTick(float dt, MotionSetpoint *sp) {
+    // 差速里程计
+    const float w = ((float)actualSpeedR + (float)actualSpeedL) * WHEEL_CIRCUMFERENCE_MM / 60.0f / MC_TRACK_MM;
+    posePsi = wrapPi(posePsi + w * dt);
+    poseX += linearSpeed * cosf(posePsi) * dt;
+    poseY += linearSpeed * sinf(posePsi) * dt;
+
+    if (!active) return false;
+
+    // 摇杆接管
+    if (fabsf(phoneX) > 1.0f || fabsf(phoneY) > 1.0f) {
+        finish("JOY");
+        return false;
+    }
+
+    float vCmd = 0, wCmd = 0;
+    const bool running = headCommand(dt, &vCmd, &wCmd);
+    vCmd = constrain(vCmd, -MC_MAX_SPEED_MMS, MC_MAX_SPEED_MMS);
+    wCmd = constrain(wCmd, -MC_MAX_YAW_DPS, MC_MAX_YAW_DPS);
+
+    const float prevV = vRef;
+    vRef += constrain(vCmd - vRef, -MC_MAX_ACCEL_MMS2 * dt, MC_MAX_ACCEL_MMS2 * dt);
+    wRefDps += constrain(wCmd - wRefDps, -MC_MAX_YAW_ACCEL_DPS2 * dt, MC_MAX_YAW_ACCEL_DPS2 * dt);
+    const float aRef = (vRef - prevV) / dt;
+    vRefFilt = VELOCITY_LPF_ALPHA * vRefFilt + (1.0f - VELOCITY_LPF_ALPHA) * vRef;
+
+    sRef += vRef * dt;
+    refPsi = wrapPi(refPsi + wRefDps * DEG_TO_RAD * dt);
+    refX += vRef * cosf(refPsi) * dt;
+    refY += vRef * sinf(refPsi) * dt;
+
+    // 误差 (参考坐标系: along 前为正, cross 左为正; ePsi = 参考 - 实际)
+    const float dx = poseX - refX, dy = poseY - refY;
+    const float c = cosf(refPsi), s = sinf(refPsi);
+    const float along = dx * c + dy * s;
+    const float cross = -dx * s + dy * c;
+    const float ePsiDeg = wrapPi(refPsi - posePsi) * RAD_TO_DEG;
+
+    statN++;
+    sumAlong2 += along * along;
+    sumCross2 += cross * cross;
+    sumPsi2   += ePsiDeg * ePsiDeg;
+    sumV2     += (linearSpeed - vRef) * (linearSpeed - vRef);
+    maxCross   = max(maxCross, fabsf(cross));
+
+    const uint32_t now = millis();
+    if (now - lastReportMs >= MC_REPORT_MS) {
+        lastReportMs = now;
+        snapshot(along, cross, ePsiDeg);
+    }
+
+    if (fabsf(along) > MC_ABORT_MM || fabsf(cross) > MC_ABORT_MM) {
+        snapshot(along, cross, ePsiDeg);
+        finish("ERR");
+        return false;
+    }
+    // 队列执行完且参考已停稳: 结束, 位置环锚点停在终点
+    if (!running && fabsf(vRef) < 1.0f && fabsf(wRefDps) < 1.0f) {
+        snapshot(along, cross, ePsiDeg);
+        finish("DONE");
+        return false;
+    }
+
+    // 倒车时横向修正方向相反
+    float xCorr = constrain(MC_XTRACK_K * cross, -MC_XTRACK_MAX_DEG, MC_XTRACK_MAX_DEG);
+    if (vRef < 0) xCorr = -xCorr;
+    const float ffRpm = wRefDps * DEG_TO_RAD * MC_TRACK_MM * 0.5f / WHEEL_CIRCUMFERENCE_MM * 60.0f;
+
+    sp->anchorMM = sBase + sRef;
+    sp->speedMMs = vRefFilt;
+    sp->leanDeg  = -atanf(aRef / 9806.65f) * RAD_TO_DEG * MC_ACCEL_FF_GAIN;
+    sp->steerRpm = constrain(MC_YAW_KP * (ePsiDeg - xCorr), -MC_STEER_LIMIT, MC_STEER_LIMIT);
+    sp->yawRpm   = ffRpm;
+    return true;
+}
+
+void motionPump() {
+    char msg[160];
+    const uint32_t seq = __atomic_load_n(&sampleSeq, __ATOMIC_ACQUIRE);
+    if (seq != sentSample) {
+        sentSample = seq;
+        // TE,seq,tMs,x,y,psi,xr,yr,psir,along,cross,ePsi,vRef,v,queued
+        snprintf(msg, sizeof(msg), "TE,%lu,%lu,%.0f,%.0f,%.1f,%.0f,%.0f,%.1f,%.1f,%.1f,%.2f,%.0f,%.0f,%d",
+                 (unsigned long)seq, (unsigned long)sample.tMs, sample.x, sample.y, sample.psi, sample.xr,
+                 sample.yr, sample.psir, sample.along, sample.cross, sample.ePsi, sample.vRef, sample.v,
+                 sample.queued);
+        webBroadcastText(msg);
+    }
+
+    const uint32_t end = __atomic_load_n(&endSeq, __ATOMIC_ACQUIRE);
+    if (end == sentEnd) return;
+    sentEnd = end;
+    // TE,END,reason,durMs,n,rmsAlong,rmsCross,rmsPsi,maxCross,rmsV
+    snprintf(msg, sizeof(msg), "TE,END,%s,%lu,%lu,%.1f,%.1f,%.2f,%.1f,%.1f", summary.reason,
+             (unsigned long)summary.durMs, (unsigned long)summary.n, summary.rmsAlong, summary.rmsCross,
+             summary.rmsPsi, summary.maxCross, summary.rmsV);
+    webBroadcastText(msg);
+    Serial.printf("[TE] %s\n", msg);
+}
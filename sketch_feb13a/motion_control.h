@@ -0,0 +1,40 @@
+#pragma once
+/**
+ * motion_control.h — 轨迹跟踪: 网络下发定时 (v, ω) 点或航点, 在平衡之上闭环速度与航向,
+ *                    差速里程计估计位姿, 周期上报跟踪误差 (TE) 与结束统计
+ */
+
+#include <Arduino.h>
+
+// 本拍跟踪设定 (motionTick 返回 true 时有效)
+struct MotionSetpoint {
+    float anchorMM;   // 位置环锚点 (distanceMM 坐标): 参考路程
+    float speedMMs;   // 速度环零点: 参考线速度 (与 filteredLinSpeed 同样低通)
+    float leanDeg;    // 加速度前馈 (°, 叠加到目标角)
+    float steerRpm;   // 转向 (RPM): 航向/横向反馈
+    float yawRpm;     // 偏航阻尼零点 (轮速和/2, RPM): ω 前馈
+};
+
+// ---- 队列 (loop 中由命令调用, 与控制拍同一任务) ----
+// 定时点: 相对本段首点的时间 ms, 线速度 mm/s, 角速度 °/s; 段内按时间线性插值
+bool motionQueueTimed(uint32_t tMs, float speedMMs, float yawDps);
+// 航点: 起点坐标系 (x 沿 linearSpeed 正方向, y 在转向正方向一侧) mm, 巡航速度 mm/s
+bool motionQueueWaypoint(float xMM, float yMM, float speedMMs);
+// 开始执行队列 (以当前位姿为原点); 未平衡或队列为空返回 false
+bool motionStart();
+// 中止并清空队列
+void motionStop();
+
+// 平衡启动时清零里程计 (activateBalance)
+void motionReset();
+// 跌倒 / 监督切断时中止 (enterFallen)
+void motionAbortFallen();
+
+// 平衡中每拍调用 (恢复保护期除外): 更新里程计与参考, 返回是否处于跟踪
+bool motionTick(float dt, MotionSetpoint *sp);
+
+bool motionActive();
+int  motionQueued();
+
+// loop 中调用: 广播 TE 采样与结束统计
+void motionPump();
@@ -0,0 +1,258 @@
+/**
+ * motor_charact.cpp — 架空轮电机特性辨识 (推广原 0~30RPM 阶跃扫描)
+ *
+ * 激励序列 (两轮同指令, 每段前静置 CHARACT_REST_S, 合计约 45s):
+ *   0 CUR_RAMP   电流三角斜坡 0→+300→0→-300→0 mA   起转电流 / 静摩擦
+ *   1 CUR_CHIRP  电流对数扫频 ±150mA, 0.5→15Hz       力矩常数/惯量比, 粘滞摩擦
+ *   2 CUR_PRBS   电流伪随机二进制 ±150mA, 码元 20ms   宽带辨识 + 指令→响应时延
+ *   3 SPD_STEP   速度模式 0/+60/-60/0 RPM 阶跃        内部速度环阶跃响应
+ *   4 SPD_CHIRP  速度模式扫频 ±40RPM, 0.5→8Hz         内部速度环带宽 + 时延
+ *
+ * 每拍记录一条 16 字节采样 (时间戳/段/指令/实测电流/实测转速/新反馈标志),
+ * 由 loop() 中的 charactPump() 每 64 条打包为一个 WebSocket 二进制帧:
+ *   [0]='C' [1]=版本 [2..3]=条数 [4..7]=首条序号 [8..]=采样
+ * 主机端 tools/motor_charact.py 接收并拟合, 输出每台机器的参数文件。
+ */
+
+#include "motor_charact.h"
+#include "can_motor.h"
+#include "config.h"
+#include "globals.h"
+#include "web_control.h"
+
+enum SegKind : uint8_t { SEG_CUR_RAMP, SEG_CUR_CHIRP, SEG_CUR_PRBS, SEG_SPD_STEP, SEG_SPD_CHIRP };
+
+struct Segment {
+    SegKind     kind;
+    int         mode;
+    const char *name;
+    float       durS;
+    float       amp;   // mA 或 RPM
+    float       f0, f1;
+};
+
+static const Segment SEGMENTS[] = {
+    {SEG_CUR_RAMP,  MODE_CURRENT, "CUR_RAMP",   8.0f, 300.0f, 0.0f,  0.0f},
+    {SEG_CUR_CHIRP, MODE_CURRENT, "CUR_CHIRP", 10.0f, 150.0f, 0.5f, 15.0f},
+    {SEG_CUR_PRBS,  MODE_CURRENT, "CUR_PRBS",   8.0f, 150.0f, 0.0f,  0.0f},
+    {SEG_SPD_STEP,  MODE_SPEED,   "SPD_STEP",   6.0f,  60.0f, 0.0f,  0.0f},
+    {SEG_SPD_CHIRP, MODE_SPEED,   "SPD_CHIRP",  8.0f,  40.0f, 0.5f,  8.0f},
+};
+static const int SEG_N = sizeof(SEGMENTS) / sizeof(SEGMENTS[0]);
+
+struct __attribute__((packed)) CharactSample {
+    uint32_t tUs;         // 相对辨识开始 (µs)
+    uint8_t  seg;         // 段号, bit7=静置
+    uint8_t  flags;       // bit0/1: 本拍 R/L 有新反馈帧, bit2: 超速保护, bit3: 速度模式
+    int16_t  cmd;         // 指令 (电流段 mA / 速度段 RPM, 机器人坐标)
+    int16_t  curR, curL;  // 实测电流 mA (已乘 DIR 转回机器人坐标)
+    int16_t  spdR, spdL;  // 实测转速 RPM (同上)
+};
+
+static const int RING_N        = 1024;
+static const int FRAME_SAMPLES = 64;
+static const int FRAME_HDR     = 8;
+
+static CharactSample ring[RING_N];
+static uint32_t ringHead = 0;   // 已写入总条数 (控制周期写)
+static uint32_t ringTail = 0;   // 已发送总条数 (loop 读)
+static uint32_t dropped  = 0;
+static uint32_t guardTicks = 0;
+
+static bool          active   = false;
+static bool          finished = false;   // 结束后待 pump 排空并发送 DONE
+static bool          aborted  = false;
+static int           segIdx   = 0;
+static int           segSent  = -1;      // 已通知主机的段号
+static uint32_t      segTick  = 0;
+static unsigned long startUs  = 0;
+static uint16_t      lfsr     = 0x1FF;
+static uint32_t      lastFramesR = 0, lastFramesL = 0;
+
+static float segmentCommand(const Segment &s, float t) {
+    float u = t / s.durS;
+    switch (s.kind) {
+    case SEG_CUR_RAMP:
+        if (u < 0.25f) return s.amp * (u / 0.25f);
+        if (u < 0.50f) return s.amp * (1.0f - (u - 0.25f) / 0.25f);
+        if (u < 0.75f) return -s.amp * ((u - 0.50f) / 0.25f);
+        return -s.amp * (1.0f - (u - 0.75f) / 0.25f);
+    case SEG_CUR_CHIRP:
+    case SEG_SPD_CHIRP: {
+        // 对数扫频: 瞬时频率 f0·(f1/f0)^(t/T)
+        float k = logf(s.f1 / s.f0);
+        float phase = TWO_PI * s.f0 * s.durS / k * (expf(k * u) - 1.0f);
+        return s.amp * sinf(phase);
+    }
+    case SEG_CUR_PRBS:
+        return (lfsr & 1) ? s.amp : -s.amp;
+    case SEG_SPD_STEP:
+        if (u < 0.25f) return 0.0f;
+        if (u < 0.50f) return s.amp;
+        if (u < 0.75f) return -s.amp;
+        return 0.0f;
+    }
+    return 0.0f;
+}
+
+static void beginSegment(int idx) {
+    segIdx = idx;
+    segTick = 0;
+    lfsr = 0x1FF;
+    if (getMotorMode() != SEGMENTS[idx].mode) {
+        // 模式切换会阻塞约 80ms, 仅在架空轮辨识的段边界发生
+        driveMotorsRaw(0, 0);
+        setMotorModeAll(SEGMENTS[idx].mode);
+    }
+}
+
+static void finish(bool abort) {
+    driveMotorsRaw(0, 0);
+    stopMotors();
+    if (getMotorMode() != MODE_CURRENT)
+        setMotorModeAll(MODE_CURRENT);
+    active    = false;
+    finished  = true;
+    aborted   = abort;
+    benchMode = false;
+    cmdSpdR = cmdSpdL = 0;
+    dbgSentR = dbgSentL = 0;
+}
+
+bool charactStart() {
+    if (active || !diagMode) return false;
+    benchMode  = true;
+    fallen     = false;
+    pidIntegral = 0;
+    ringHead = ringTail = 0;
+    dropped = guardTicks = 0;
+    finished = aborted = false;
+    segSent = -1;
+    lastFramesR = motorFeedbackFrames(MOTOR_R);
+    lastFramesL = motorFeedbackFrames(MOTOR_L);
+
+    char msg[96];
+    uint64_t mac = ESP.getEfuseMac();
+    // CH,START,unitId,ctrlHz,sampleBytes,segments
+    snprintf(msg, sizeof(msg), "CH,START,%04X%08X,%d,%d,%d",
+             (unsigned)(mac >> 32), (unsigned)(mac & 0xFFFFFFFF),
+             CTRL_HZ, (int)sizeof(CharactSample), SEG_N);
+    webBroadcastText(msg);
+
+    active  = true;
+    startUs = micros();
+    beginSegment(0);
+    return true;
+}
+
+void charactStop() {
+    if (!active) return;
+    finish(true);
+}
+
+bool charactActive() {
+    return active;
+}
+
+void charactTick(float dt) {
+    if (!active) return;
+
+    const Segment &s = SEGMENTS[segIdx];
+    const uint32_t restTicks = (uint32_t)(CHARACT_REST_S / dt + 0.5f);
+    const uint32_t segTicks  = restTicks + (uint32_t)(s.durS / dt + 0.5f);
+    bool resting = segTick < restTicks;
+
+    float cmd = 0.0f;
+    if (!resting) {
+        uint32_t k = segTick - restTicks;
+        if (s.kind == SEG_CUR_PRBS && k > 0 && (k % CHARACT_PRBS_TICKS) == 0) {
+            // 9 位 LFSR, x^9 + x^5 + 1, 周期 511 码元
+            uint16_t bit = ((lfsr >> 0) ^ (lfsr >> 4)) & 1;
+            lfsr = (lfsr >> 1) | (bit << 8);
+        }
+        cmd = segmentCommand(s, k * dt);
+    }
+
+    uint8_t flags = (s.mode == MODE_SPEED) ? 0x08 : 0;
+    float spdMax = max(fabs(actualSpeedR), fabs(actualSpeedL));
+    if (s.mode == MODE_CURRENT && spdMax > CHARACT_MAX_RPM) {
+        cmd = 0.0f;
+        flags |= 0x04;
+        guardTicks++;
+    }
+
+    int c = (int)cmd;
+    driveMotorsRaw(c, c);
+    cmdSpdR = cmdSpdL = c;
+    dbgSentR = dbgSentL = c;
+
+    uint32_t fr = motorFeedbackFrames(MOTOR_R);
+    uint32_t fl = motorFeedbackFrames(MOTOR_L);
+    if (fr != lastFramesR) flags |= 0x01;
+    if (fl != lastFramesL) flags |= 0x02;
+    lastFramesR = fr;
+    lastFramesL = fl;
+
+    if (ringHead - ringTail < (uint32_t)RING_N) {
+        CharactSample &o = ring[ringHead % RING_N];
+        o.tUs   = micros() - startUs;
+        o.seg   = (uint8_t)segIdx | (resting ? 0x80 : 0);
+        o.flags = flags;
+        o.cmd   = (int16_t)c;
+        o.curR  = (int16_t)(actualCurrentR * DIR_R);
+        o.curL  = (int16_t)(actualCurrentL * DIR_L);
+        o.spdR  = (int16_t)(actualSpeedR * DIR_R);
+        o.spdL  = (int16_t)(actualSpeedL * DIR_L);
+        ringHead++;
+    } else {
+        dropped++;
+    }
+
+    if (++segTick >= segTicks) {
+        if (segIdx + 1 >= SEG_N) {
+            finish(false);
+        } else {
+            beginSegment(segIdx + 1);
+        }
+    }
+}
+
+void charactPump() {
+    if (!active && !finished) return;
+
+    char msg[96];
+    if (segSent != segIdx) {
+        segSent = segIdx;
+        const Segment &s = SEGMENTS[segIdx];
+        // CH,SEG,idx,name,mode,durS,amp,f0,f1
+        snprintf(msg, sizeof(msg), "CH,SEG,%d,%s,%d,%.1f,%.0f,%.2f,%.2f",
+                 segIdx, s.name, s.mode, s.durS, s.amp, s.f0, s.f1);
+        webBroadcastText(msg);
+    }
+
+    // 每次最多发两帧, 追赶 WiFi 阻塞造成的积压
+    static uint8_t frame[FRAME_HDR + FRAME_SAMPLES * sizeof(CharactSample)];
+    for (int f = 0; f < 2; f++) {
+        uint32_t avail = ringHead - ringTail;
+        if (avail == 0 || (avail < (uint32_t)FRAME_SAMPLES && active)) break;
+        uint16_t n = (uint16_t)min(avail, (uint32_t)FRAME_SAMPLES);
+        frame[0] = 'C';
+        frame[1] = 1;
+        memcpy(frame + 2, &n, 2);
+        memcpy(frame + 4, &ringTail, 4);
+        for (uint16_t i = 0; i < n; i++) {
+            memcpy(frame + FRAME_HDR + i * sizeof(CharactSample),
+                   &ring[(ringTail + i) % RING_N], sizeof(CharactSample));
+        }
+        webBroadcastBinary(frame, FRAME_HDR + n * sizeof(CharactSample));
+        ringTail += n;
+    }
+
+    if (finished && ringHead == ringTail) {
+        finished = false;
+        // CH,DONE|ABORT,samples,dropped,guardTicks
+        snprintf(msg, sizeof(msg), "CH,%s,%lu,%lu,%lu", aborted ? "ABORT" : "DONE",
+                 (unsigned long)ringHead, (unsigned long)dropped, (unsigned long)guardTicks);
+        webBroadcastText(msg);
+    }
+}
@@ -0,0 +1,20 @@
+#pragma once
+/**
+ * motor_charact.h — 架空轮电机特性辨识: 扫频/PRBS/斜坡激励 + 全速率指令/响应记录
+ */
+
+#include <Arduino.h>
+
+// 启动辨识 (仅诊断模式下允许), 成功返回 true
+bool charactStart();
+
+// 中止辨识, 清零输出并恢复电流模式
+void charactStop();
+
+bool charactActive();
+
+// 控制周期调用 (balanceControl 在辨识期间转交)
+void charactTick(float dt);
+
+// loop() 中调用: 把采样块打包成 WebSocket 二进制帧, 并发送段切换/结束消息
+void charactPump();
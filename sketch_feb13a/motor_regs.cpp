@@ -0,0 +1,99 @@
+/**
+ * motor_regs.cpp — 寄存器快照缓存
+ *
+ * 写者只有控制核 (readParam/writeParam/motorRegsPoll), 读者为网络任务的 HTTP 接口。
+ * seqlock: 写前序号变奇数, 写完变偶数; 读者复制整表后序号不变且为偶数才算一致。
+ * 平衡期不补读 (readParam 阻塞最长 15ms), 此时快照只随指令写入更新, ageMs 如实反映新旧。
+ */
+
+#include "motor_regs.h"
+#include "can_motor.h"
+#include "config.h"
+#include "globals.h"
+
+static const MotorRegDef REGS[MREG_COUNT] = {
+  {REG_MODE,          "mode",        1,        ""},
+  {REG_POS_MAX_CUR,   "posMaxCur",   100,      "mA"},
+  {REG_SPEED_MAX_CUR, "speedMaxCur", 100,      "mA"},
+  {REG_SPEED_KP,      "speedKp",     100000,   ""},
+  {REG_SPEED_KI,      "speedKi",     10000000, ""},
+  {REG_SPEED_KD,      "speedKd",     100000,   ""},
+  {REG_SPEED_ACTUAL,  "speed",       100,      "rpm"},
+  {REG_POS_READBACK,  "position",    100,      "deg"},
+  {REG_CUR_READBACK,  "current",     100,      "mA"},
+  {REG_ENCODER,       "encoder",     1,        "count"},
+  {REG_VIN,           "vin",         100,      "V"},
+  {REG_TEMP,          "temp",        1,        "C"},
+};
+
+static int32_t  cacheRaw[2][MREG_COUNT];
+static uint32_t cacheMs[2][MREG_COUNT];
+static volatile uint32_t seq = 0;
+static int      pollIdx = 0;
+static unsigned long lastPollMs = 0;
+
+static int motorSlot(uint8_t id) {
+  return id == MOTOR_R ? 0 : (id == MOTOR_L ? 1 : -1);
+}
+
+static int regIndex(uint16_t reg) {
+  for (int i = 0; i < MREG_COUNT; i++) {
+    if (REGS[i].reg == reg) return i;
+  }
+  return -1;
+}
+
+void motorRegsNote(uint8_t id, uint16_t reg, int32_t raw) {
+  int m = motorSlot(id);
+  int i = regIndex(reg);
+  if (m < 0 || i < 0) return;
+  __atomic_store_n(&seq, seq + 1, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+  cacheRaw[m][i] = raw;
+  cacheMs[m][i] = millis() | 1;   // 保证非 0
+  __atomic_store_n(&seq, seq + 1, __ATOMIC_RELEASE);
+}
+
+void motorRegsPoll() {
+  // 平衡期与架空轮实验 (辨识/阶跃) 期间不做阻塞读
+  if ((!diagMode && !fallen) || benchMode) return;
+  unsigned long now = millis();
+  if (now - lastPollMs < MREG_POLL_MS) return;
+  lastPollMs = now;
+
+  // 轮转找一个超过 MREG_REFRESH_MS 未更新的寄存器, 每次最多读一个
+  for (int k = 0; k < 2 * MREG_COUNT; k++) {
+    int slot = pollIdx;
+    pollIdx = (pollIdx + 1) % (2 * MREG_COUNT);
+    int m = slot / MREG_COUNT, i = slot % MREG_COUNT;
+    if (cacheMs[m][i] && now - cacheMs[m][i] < MREG_REFRESH_MS) continue;
+    // 成功时 readParam 内部调用 motorRegsNote
+    readParam(m == 0 ? MOTOR_R : MOTOR_L, REGS[i].reg);
+    return;
+  }
+}
+
+const MotorRegDef &motorRegsDef(int idx) {
+  return REGS[constrain(idx, 0, MREG_COUNT - 1)];
+}
+
+int motorRegsFind(const char *nameOrHex) {
+  if (nameOrHex[0] == '0' && (nameOrHex[1] == 'x' || nameOrHex[1] == 'X'))
+    return regIndex((uint16_t)strtoul(nameOrHex, nullptr, 16));
+  for (int i = 0; i < MREG_COUNT; i++) {
+    if (strcmp(REGS[i].name, nameOrHex) == 0) return i;
+  }
+  return -1;
+}
+
+void motorRegsSnapshot(MotorRegSnapshot *out) {
+  for (;;) {
+    uint32_t s0 = __atomic_load_n(&seq, __ATOMIC_ACQUIRE);
+    if (s0 & 1) continue;
+    memcpy(out->raw, cacheRaw, sizeof(cacheRaw));
+    memcpy(out->atMs, cacheMs, sizeof(cacheMs));
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    if (__atomic_load_n(&seq, __ATOMIC_RELAXED) == s0) break;
+  }
+  out->ms = millis();
+}
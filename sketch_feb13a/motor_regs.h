@@ -0,0 +1,34 @@
+#pragma once
+/**
+ * motor_regs.h — RollerCAN 寄存器快照缓存: readParam/writeParam 顺带更新, 非平衡期低频补读,
+ *                网络任务通过 seqlock 一次性取得一致快照 (不触发 CAN 读)
+ */
+
+#include <Arduino.h>
+
+#define MREG_COUNT 12
+
+struct MotorRegDef {
+  uint16_t    reg;
+  const char *name;
+  int32_t     scale;   // 原始值 / scale = 物理量
+  const char *unit;
+};
+
+struct MotorRegSnapshot {
+  uint32_t ms;                       // 取快照时刻
+  int32_t  raw[2][MREG_COUNT];       // [0]=R, [1]=L
+  uint32_t atMs[2][MREG_COUNT];      // 最近读/写时刻, 0 = 从未获取
+};
+
+// can_motor.cpp 钩子: 读回成功 / 写入发出后记录 (仅控制核调用)
+void motorRegsNote(uint8_t id, uint16_t reg, int32_t raw);
+
+// 主循环低频调用: 非平衡期每次补读一个最久未更新的寄存器
+void motorRegsPoll();
+
+const MotorRegDef &motorRegsDef(int idx);
+int motorRegsFind(const char *nameOrHex);   // 名称或 0x7020 形式, 未找到返回 -1
+
+// 任一核可调用 (seqlock 读, 写者为控制核)
+void motorRegsSnapshot(MotorRegSnapshot *out);
@@ -0,0 +1,63 @@
+/**
+ * net_queue.cpp — SPSC 消息环
+ *
+ * 记录可跨越环尾, 拷贝时按两段处理。索引为自由递增的 32 位计数,
+ * 占用 = head - tail, 回绕由无符号减法自然处理。
+ */
+
+#include "net_queue.h"
+
+static void copyIn(NetQueue &q, uint32_t pos, const void *src, size_t len) {
+  uint32_t off = pos & (q.size - 1);
+  size_t first = min(len, (size_t)(q.size - off));
+  memcpy(q.buf + off, src, first);
+  if (len > first) memcpy(q.buf, (const uint8_t *)src + first, len - first);
+}
+
+static void copyOut(const NetQueue &q, uint32_t pos, void *dst, size_t len) {
+  uint32_t off = pos & (q.size - 1);
+  size_t first = min(len, (size_t)(q.size - off));
+  memcpy(dst, q.buf + off, first);
+  if (len > first) memcpy((uint8_t *)dst + first, q.buf, len - first);
+}
+
+void netQueueInit(NetQueue &q, uint8_t *storage, uint32_t size) {
+  q.buf = storage;
+  q.size = size;
+  q.head = q.tail = 0;
+  q.drops = q.highWater = 0;
+}
+
+bool netQueuePush(NetQueue &q, uint8_t kind, uint8_t client, const void *data, size_t len) {
+  uint32_t head = q.head;
+  uint32_t tail = __atomic_load_n(&q.tail, __ATOMIC_ACQUIRE);
+  uint32_t need = sizeof(NetMsgHdr) + len;
+  if (len > 0xFFFF || need > q.size - (head - tail)) {
+    q.drops++;
+    return false;
+  }
+  NetMsgHdr h = {(uint16_t)len, client, kind};
+  copyIn(q, head, &h, sizeof(h));
+  if (len) copyIn(q, head + sizeof(h), data, len);
+  uint32_t used = head + need - tail;
+  if (used > q.highWater) q.highWater = used;
+  __atomic_store_n(&q.head, head + need, __ATOMIC_RELEASE);
+  return true;
+}
+
+bool netQueuePop(NetQueue &q, NetMsgHdr *hdr, uint8_t *data, size_t maxLen) {
+  uint32_t tail = q.tail;
+  uint32_t head = __atomic_load_n(&q.head, __ATOMIC_ACQUIRE);
+  if (head == tail) return false;
+  copyOut(q, tail, hdr, sizeof(*hdr));
+  uint32_t next = tail + sizeof(*hdr) + hdr->len;
+  size_t n = min((size_t)hdr->len, maxLen);
+  if (n) copyOut(q, tail + sizeof(*hdr), data, n);
+  hdr->len = (uint16_t)n;
+  __atomic_store_n(&q.tail, next, __ATOMIC_RELEASE);
+  return true;
+}
+
+uint32_t netQueueUsed(const NetQueue &q) {
+  return __atomic_load_n(&q.head, __ATOMIC_ACQUIRE) - __atomic_load_n(&q.tail, __ATOMIC_ACQUIRE);
+}
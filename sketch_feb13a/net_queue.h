@@ -0,0 +1,44 @@
+#pragma once
+/**
+ * net_queue.h — 单生产者/单消费者无锁消息环 (控制核 ↔ 网络任务)
+ *
+ * 变长记录 [hdr 4B][data], 生产者只写 head, 消费者只写 tail; 跨核可见性由
+ * head/tail 的 release 存储 + acquire 读取保证, 两端都不加锁、不阻塞。
+ */
+
+#include <Arduino.h>
+
+enum NetMsgKind : uint8_t {
+  NET_TEXT,        // WebSocket 文本帧
+  NET_BINARY,      // WebSocket 二进制帧
+  NET_CONNECT,     // 客户端连接 (入站)
+  NET_DISCONNECT,  // 客户端断开 (入站)
+  NET_HTTP_STAT,   // 页面传输统计 HT (入站, 由控制侧广播并缓存)
+};
+
+struct NetMsgHdr {
+  uint16_t len;
+  uint8_t  client;
+  uint8_t  kind;
+};
+
+struct NetQueue {
+  uint8_t *buf;
+  uint32_t size;        // 2 的幂
+  uint32_t head;        // 生产者写
+  uint32_t tail;        // 消费者写
+  uint32_t drops;       // 空间不足被拒的记录 (生产者侧计数)
+  uint32_t highWater;   // 最大占用字节 (生产者侧采样)
+};
+
+// storage 长度须为 2 的幂
+void netQueueInit(NetQueue &q, uint8_t *storage, uint32_t size);
+
+// 生产者: 空间不足返回 false (不阻塞, 记 drops)
+bool netQueuePush(NetQueue &q, uint8_t kind, uint8_t client, const void *data, size_t len);
+
+// 消费者: 取出一条到 data (最多 maxLen 字节, 超长记录截断); 队空返回 false
+bool netQueuePop(NetQueue &q, NetMsgHdr *hdr, uint8_t *data, size_t maxLen);
+
+// 当前占用字节 (任一端可读, 近似值)
+uint32_t netQueueUsed(const NetQueue &q);
@@ -0,0 +1,69 @@
+/**
+ * param_registry.cpp — 运行时可调参数表
+ *
+ * 只收录可以单独修改的标量; 成组写入的寄存器 (速度环 Kp/Ki/Kd) 仍走 G 命令,
+ * 其读回见 motor_regs 快照。
+ */
+
+#include "param_registry.h"
+#include "can_motor.h"
+#include "config.h"
+#include "globals.h"
+#include "joystick_input.h"
+#include "motor_regs.h"
+
+static float getKp() { return Kp; }
+static float getKi() { return Ki; }
+static float getKd() { return Kd; }
+static void setKp(float v) { Kp = v; pidIntegral = 0; }
+static void setKi(float v) { Ki = v; pidIntegral = 0; }
+static void setKd(float v) { Kd = v; }
+
+static float getJoyTimeout() { return (float)joystickTimeout(); }
+static void  setJoyTimeout(float v) { joystickSetTimeout((uint32_t)v); }
+
+// 速度模式限流: 读回取 R 电机寄存器快照 (两电机总是同时写入)
+static float getSpeedLimit() {
+    MotorRegSnapshot snap;
+    motorRegsSnapshot(&snap);
+    int i = motorRegsFind("speedMaxCur");
+    return snap.atMs[0][i] ? snap.raw[0][i] / (float)motorRegsDef(i).scale : NAN;
+}
+static void setSpeedLimit(float v) { setMotorSpeedCurrentLimit((int32_t)v); }
+
+static const ParamDef PARAMS[] = {
+    {"Kp",           "rpm/deg",     0, KP_MAX, false, false, getKp, setKp},
+    {"Ki",           "rpm/(deg*s)", 0, KI_MAX, false, false, getKi, setKi},
+    {"Kd",           "rpm/(deg/s)", 0, KD_MAX, false, false, getKd, setKd},
+    {"joyTimeoutMs", "ms", JOY_TIMEOUT_MIN_MS, JOY_TIMEOUT_MAX_MS, true, false, getJoyTimeout, setJoyTimeout},
+    {"speedCurLimitMa", "mA", SPEED_IL_MIN_MA, SPEED_IL_MAX_MA, true, true, getSpeedLimit, setSpeedLimit},
+};
+static const int PARAM_N = sizeof(PARAMS) / sizeof(PARAMS[0]);
+
+int paramCount() {
+    return PARAM_N;
+}
+
+const ParamDef &paramDef(int idx) {
+    return PARAMS[constrain(idx, 0, PARAM_N - 1)];
+}
+
+int paramFind(const char *name) {
+    for (int i = 0; i < PARAM_N; i++) {
+        if (strcmp(PARAMS[i].name, name) == 0) return i;
+    }
+    return -1;
+}
+
+float paramGet(int idx) {
+    if (idx < 0 || idx >= PARAM_N) return NAN;
+    return PARAMS[idx].get();
+}
+
+bool paramSet(int idx, float v) {
+    if (idx < 0 || idx >= PARAM_N) return false;
+    const ParamDef &p = PARAMS[idx];
+    if (!(v >= p.minV && v <= p.maxV)) return false;
+    p.set(p.integer ? roundf(v) : v);
+    return true;
+}
@@ -0,0 +1,27 @@
+#pragma once
+/**
+ * param_registry.h — 运行时可调参数表: 名称/单位/范围 + 读写函数 (HTTP 接口与 PS 命令共用)
+ */
+
+#include <Arduino.h>
+
+struct ParamDef {
+    const char *name;
+    const char *unit;
+    float       minV;
+    float       maxV;
+    bool        integer;      // 整数参数 (写入时取整)
+    bool        blocking;     // 写入走阻塞 CAN 寄存器操作: 平衡中拒绝 (PS 回 busy)
+    float (*get)();
+    void  (*set)(float v);    // 已通过范围检查
+};
+
+int paramCount();
+const ParamDef &paramDef(int idx);
+int paramFind(const char *name);   // 未找到返回 -1
+
+// 任一核可读 (单个 float, 不保证多参数之间一致)
+float paramGet(int idx);
+
+// 仅控制核调用: 越界 / NaN 返回 false
+bool paramSet(int idx, float v);
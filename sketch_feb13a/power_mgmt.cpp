@@ -0,0 +1,115 @@
+/**
+ * power_mgmt.cpp — 电源管理
+ *
+ * 电压: 电流模式下每个 0x02 反馈帧都带母线电压, 平衡期也能连续跟踪;
+ *       倒地/诊断时由 motorsPollParams() 的 REG_VIN 读数补充。
+ * 内阻: 对 (I, V) 做指数遗忘线性回归, R = -cov(I,V)/var(I), 电流激励不足时不更新。
+ *       I 取两电机相电流绝对值之和, 高于真实母线电流, 因此估计偏保守。
+ * SOC:  由开路电压 Voc = V + R·I 在 BATT_EMPTY_V..BATT_FULL_V 间线性映射。
+ * 预算: 预测满载电压 Voc − R·I 不得低于 BROWNOUT_V + BROWNOUT_MARGIN_V。
+ */
+
+#include "power_mgmt.h"
+#include "config.h"
+#include "globals.h"
+
+static PowerStatus ps = {
+    0, 0, 0, RINT_DEFAULT_OHM, 100.0f, 0,
+    POWER_TOTAL_BUDGET_MA, 1.0f, 0, 0
+};
+
+// V-I 回归的指数加权矩
+static float mI = 0, mV = 0, mII = 0, mIV = 0;
+static bool  statsInit = false;
+static int   lastWarn = 0;
+static bool  warnRaised = false;
+
+// 最低电压: 两个相邻窗口的最小值, 与读取者无关 (多个订阅者/接口读到同一值)
+static float    winMin = 0, prevWinMin = 0;
+static uint32_t winStartMs = 0;
+
+static const float MIN_CURRENT_VAR = 0.05f * 0.05f;  // 激励门限: 电流标准差 > 50mA
+static const float VOC_ALPHA = 0.999f;               // 开路电压平滑 (~1s τ)
+static const float SOC_ALPHA = 0.9998f;              // SOC 平滑 (~5s τ)
+
+void powerUpdate(float dt) {
+    (void)dt;
+    float v = (vinR > 0 && vinL > 0) ? (vinR + vinL) * 0.5f : max(vinR, vinL);
+    if (v <= 1.0f) return;  // 尚无电压读数
+
+    float i = (fabs(actualCurrentR) + fabs(actualCurrentL)) / 1000.0f;
+    ps.vbus = v;
+    ps.ibus = i;
+    uint32_t now = millis();
+    if (winMin <= 0 || now - winStartMs >= VBUS_MIN_WINDOW_MS) {
+        prevWinMin = winMin > 0 ? winMin : v;
+        winMin     = v;
+        winStartMs = now;
+    }
+    if (v < winMin) winMin = v;
+    ps.vbusMin = min(winMin, prevWinMin);
+
+    if (!statsInit) {
+        mI = i; mV = v; mII = i * i; mIV = i * v;
+        ps.voc = v + ps.rint * i;
+        ps.soc = constrain((ps.voc - BATT_EMPTY_V) / (BATT_FULL_V - BATT_EMPTY_V) * 100.0f, 0.0f, 100.0f);
+        statsInit = true;
+    }
+
+    // ---- 内阻: 指数遗忘回归 ----
+    const float a = RINT_EST_ALPHA, b = 1.0f - RINT_EST_ALPHA;
+    mI  = a * mI  + b * i;
+    mV  = a * mV  + b * v;
+    mII = a * mII + b * i * i;
+    mIV = a * mIV + b * i * v;
+    float varI = mII - mI * mI;
+    if (varI > MIN_CURRENT_VAR) {
+        float r = constrain(-(mIV - mI * mV) / varI, 0.02f, 2.0f);
+        ps.rint += 0.01f * (r - ps.rint);
+    }
+
+    // ---- 开路电压 + SOC ----
+    ps.voc = VOC_ALPHA * ps.voc + (1.0f - VOC_ALPHA) * (v + ps.rint * i);
+    float socNow = constrain((ps.voc - BATT_EMPTY_V) / (BATT_FULL_V - BATT_EMPTY_V) * 100.0f, 0.0f, 100.0f);
+    ps.soc = SOC_ALPHA * ps.soc + (1.0f - SOC_ALPHA) * socNow;
+
+    // ---- 电压补偿: 母线低于标称时放大电流指令 ----
+    ps.comp = constrain(BUS_NOMINAL_V / v, 1.0f, POWER_COMP_MAX);
+
+    // ---- 总电流预算: 预测满载压降不得跌破欠压线 + 余量 ----
+    float headroom = ps.voc - BROWNOUT_V - BROWNOUT_MARGIN_V;
+    float budget = headroom / ps.rint * 1000.0f;
+    ps.budgetMa = (int)constrain(budget, (float)POWER_MIN_BUDGET_MA, (float)POWER_TOTAL_BUDGET_MA);
+
+    // ---- 告警等级 ----
+    float sagAtCap = ps.voc - ps.rint * (POWER_TOTAL_BUDGET_MA / 1000.0f);
+    int warn = 0;
+    if (ps.soc < SOC_LOW_PCT || sagAtCap < BROWNOUT_V + BROWNOUT_MARGIN_V) warn = 1;
+    if (v < BROWNOUT_V + BROWNOUT_MARGIN_V * 0.5f || sagAtCap < BROWNOUT_V) warn = 2;
+    if (warn > lastWarn) warnRaised = true;
+    lastWarn = warn;
+    ps.warn = warn;
+}
+
+float powerCompGain() {
+    return ps.comp;
+}
+
+void powerApplyBudget(int *curR, int *curL) {
+    int total = abs(*curR) + abs(*curL);
+    if (total <= ps.budgetMa) return;
+    float k = (float)ps.budgetMa / (float)total;
+    *curR = (int)(*curR * k);
+    *curL = (int)(*curL * k);
+    ps.limitCount++;
+}
+
+const PowerStatus &powerStatus() {
+    return ps;
+}
+
+bool powerWarnRaised() {
+    bool r = warnRaised;
+    warnRaised = false;
+    return r;
+}
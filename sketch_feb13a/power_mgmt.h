@@ -0,0 +1,33 @@
+#pragma once
+/**
+ * power_mgmt.h — 电源管理: 母线电压跟踪、内阻/SOC 估计、电压补偿与总电流预算
+ */
+
+#include <Arduino.h>
+
+struct PowerStatus {
+    float vbus;       // 母线电压 (V, 两电机 0x02 反馈平均)
+    float vbusMin;    // 最近 1~2 个 VBUS_MIN_WINDOW_MS 窗口内的最低母线电压 (V)
+    float voc;        // 开路电压估计 (V)
+    float rint;       // 内阻估计 (Ω)
+    float soc;        // 剩余电量估计 (%)
+    float ibus;       // 两电机电流绝对值之和 (A)
+    int   budgetMa;   // 当前两电机合计电流预算 (mA)
+    float comp;       // 电压补偿倍率
+    int   warn;       // 0=正常 1=低电量/余量不足 2=欠压风险
+    uint32_t limitCount; // 预算限流触发次数
+};
+
+// 每个控制周期调用: 用最新 vinR/vinL 与电流反馈更新估计
+void powerUpdate(float dt);
+
+// 电压补偿倍率 (乘在电流指令上, 单电机限幅之前)
+float powerCompGain();
+
+// 两电机合计电流预算 (超出时等比例缩放, 保留转向差)
+void powerApplyBudget(int *curR, int *curL);
+
+const PowerStatus &powerStatus();
+
+// 告警等级自上次调用以来升高 (调用后清除)
+bool powerWarnRaised();
@@ -0,0 +1,99 @@
+/**
+ * profiler.cpp — 控制循环分段耗时统计
+ *
+ * 每段维护 min/max/累计周期数 + 1/4 倍频程直方图 (64 周期起), p99 取所在桶上沿,
+ * 相对误差约 19%, 足够区分"几十 µs"与"毫秒级"阻塞。统计按窗口清零 (PROFILER_REPORT_MS)。
+ */
+
+#include "profiler.h"
+
+static const int HIST_BINS = 96;
+static const int HIST_MIN_OCTAVE = 6;   // 2^6 = 64 周期
+
+static const char *const STAGE_NAMES[PROF_STAGE_N] = {
+    "imu", "filter", "pid", "canTx", "canRx", "tick", "web", "autotune", "poll",
+};
+
+struct StageAcc {
+    uint32_t count;
+    uint32_t minCyc;
+    uint32_t maxCyc;
+    uint64_t sumCyc;
+    uint32_t bin[HIST_BINS];
+};
+
+static StageAcc  acc[PROF_STAGE_N];
+static ProfStats latched[PROF_STAGE_N];
+static uint32_t  windowStartMs = 0;
+static uint32_t  latchedWindowMs = 0;
+
+static int binOf(uint32_t cyc) {
+    if (cyc < (1u << HIST_MIN_OCTAVE))
+        return 0;
+    int o = 31 - __builtin_clz(cyc);
+    int sub = (cyc >> (o - 2)) & 3;
+    int b = (o - HIST_MIN_OCTAVE) * 4 + sub + 1;
+    return b < HIST_BINS ? b : HIST_BINS - 1;
+}
+
+static uint32_t binUpper(int b) {
+    if (b == 0)
+        return 1u << HIST_MIN_OCTAVE;
+    int o = (b - 1) / 4 + HIST_MIN_OCTAVE;
+    int sub = (b - 1) % 4;
+    return (uint32_t)(5 + sub) << (o - 2);
+}
+
+void profRecord(ProfStage stage, uint32_t cycles) {
+    StageAcc &a = acc[stage];
+    if (a.count == 0 || cycles < a.minCyc) a.minCyc = cycles;
+    if (cycles > a.maxCyc) a.maxCyc = cycles;
+    a.sumCyc += cycles;
+    a.count++;
+    a.bin[binOf(cycles)]++;
+}
+
+uint32_t profLatch() {
+    const float usPerCyc = 1.0f / (float)ESP.getCpuFreqMHz();
+    for (int s = 0; s < PROF_STAGE_N; s++) {
+        StageAcc &a = acc[s];
+        ProfStats &o = latched[s];
+        o.count = a.count;
+        if (a.count == 0) {
+            o.minUs = o.meanUs = o.p99Us = o.maxUs = 0;
+        } else {
+            uint32_t rank = a.count - a.count / 100;
+            uint32_t seen = 0;
+            uint32_t p99 = a.maxCyc;
+            for (int b = 0; b < HIST_BINS; b++) {
+                seen += a.bin[b];
+                if (seen >= rank) {
+                    p99 = min(binUpper(b), a.maxCyc);
+                    break;
+                }
+            }
+            o.minUs  = a.minCyc * usPerCyc;
+            o.meanUs = (float)(a.sumCyc / a.count) * usPerCyc;
+            o.p99Us  = p99 * usPerCyc;
+            o.maxUs  = a.maxCyc * usPerCyc;
+        }
+    }
+    memset(acc, 0, sizeof(acc));
+
+    uint32_t now = millis();
+    latchedWindowMs = now - windowStartMs;
+    windowStartMs = now;
+    return latchedWindowMs;
+}
+
+uint32_t profWindowMs() {
+    return latchedWindowMs;
+}
+
+const ProfStats &profStats(ProfStage stage) {
+    return latched[stage];
+}
+
+const char *profStageName(ProfStage stage) {
+    return STAGE_NAMES[stage];
+}
@@ -0,0 +1,49 @@
+#pragma once
+/**
+ * profiler.h — 控制循环分段耗时统计 (CPU 周期计数器)
+ *
+ * PROF_BEGIN(stage) / PROF_END(stage) 成对放在同一作用域内, 每段只读两次
+ * 周期计数器 + 一次 profRecord()。config.h 中 PROFILER_ENABLE=0 时宏展开为空。
+ */
+
+#include <Arduino.h>
+#include "config.h"
+
+enum ProfStage : uint8_t {
+    PROF_IMU_READ,   // M5.Imu.update() + getImuData()
+    PROF_FILTER,     // 互补滤波
+    PROF_PID,        // 平衡控制计算 (不含 CAN)
+    PROF_CAN_TX,     // driveMotors 发送
+    PROF_CAN_RX,     // processAllFeedback 接收队列排空
+    PROF_TICK,       // 整个控制拍 (updateIMU + balanceControl)
+    PROF_WEB,        // webLoop()
+    PROF_AUTOTUNE,   // autoTuneUpdate()
+    PROF_POLL,       // motorsPollParams()
+    PROF_STAGE_N
+};
+
+struct ProfStats {
+    uint32_t count;
+    float    minUs;
+    float    meanUs;
+    float    p99Us;
+    float    maxUs;
+};
+
+#if PROFILER_ENABLE
+#define PROF_BEGIN(stage) const uint32_t _prof_##stage = ESP.getCycleCount()
+#define PROF_END(stage)   profRecord(stage, ESP.getCycleCount() - _prof_##stage)
+#else
+#define PROF_BEGIN(stage)
+#define PROF_END(stage)
+#endif
+
+void profRecord(ProfStage stage, uint32_t cycles);
+
+// 锁存当前统计窗口供上报并开始新窗口, 返回窗口长度 (ms)
+uint32_t profLatch();
+
+// 最近一次锁存的窗口统计
+const ProfStats &profStats(ProfStage stage);
+uint32_t profWindowMs();
+const char *profStageName(ProfStage stage);
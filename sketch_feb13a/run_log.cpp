@@ -0,0 +1,192 @@
+/**
+ * run_log.cpp — 设备端闭环日志
+ *
+ * 写者只有控制核 (runLogTick), 读者为网络任务。采样按全局序号 seq 写入 ring[seq % cap],
+ * head 以 release 存储发布; 读者复制后重读 head, 复制期间被覆盖 (seq + cap ≤ head)
+ * 则整段作废。run 表项为若干独立字段, 进行中 run 的统计量允许读到略旧的值。
+ */
+
+#include "run_log.h"
+#include "config.h"
+#include "fall_predict.h"
+#include "globals.h"
+#include "motion_control.h"
+#include "power_mgmt.h"
+#include "web_control.h"
+
+static RunLogSample *ring = nullptr;
+static uint32_t cap = 0;
+static volatile uint32_t head = 0;   // 下一条的全局序号
+
+static RunInfo  runs[RUNLOG_MAX_RUNS];
+static uint32_t runTotal = 0;        // 已开始的 run 数 (id 从 1 起)
+static RunInfo *cur = nullptr;
+static unsigned long curStartUs = 0;
+static uint32_t decimCount = 0;
+static volatile uint32_t boundaryEvents = 0;
+static uint32_t pumpedEvents = 0;
+
+void runLogInit() {
+    size_t bytes = psramFound() ? RUNLOG_PSRAM_BYTES : RUNLOG_DRAM_BYTES;
+    ring = (RunLogSample *)(psramFound() ? ps_malloc(bytes) : malloc(bytes));
+    cap = ring ? bytes / sizeof(RunLogSample) : 0;
+    Serial.printf("[RUNLOG] %lu samples (%s, %.0fs @ %dHz)\n", (unsigned long)cap,
+                  psramFound() ? "PSRAM" : "DRAM", cap / (float)(CTRL_HZ / RUNLOG_DECIM),
+                  CTRL_HZ / RUNLOG_DECIM);
+}
+
+static void openRun(RunKind kind) {
+    runTotal++;
+    RunInfo &r = runs[(runTotal - 1) % RUNLOG_MAX_RUNS];
+    r.id        = 0;   // 填写期间读者视为空槽
+    r.kind      = kind;
+    r.active    = true;
+    r.reason    = "";
+    r.startSeq  = r.endSeq = head;
+    r.startMs   = r.endMs = millis();
+    r.startDist = r.endDist = distanceMM;
+    r.maxPitch  = r.maxPid = r.maxSpeed = 0;
+    __atomic_store_n(&r.id, runTotal, __ATOMIC_RELEASE);
+    cur = &r;
+    curStartUs = micros();
+    decimCount = 0;
+    boundaryEvents++;
+}
+
+static void closeRun(const char *reason) {
+    cur->reason = reason;
+    cur->endMs  = millis();
+    cur->active = false;
+    cur = nullptr;
+    boundaryEvents++;
+}
+
+static void record() {
+    if (!ring || ++decimCount < RUNLOG_DECIM) return;
+    decimCount = 0;
+
+    const float pitch = currentPitch + PITCH_MOUNT_OFFSET;
+    RunLogSample &s = ring[head % cap];
+    s.tUs      = micros() - curStartUs;
+    s.pitch    = pitch;
+    s.target   = targetAngleFilt;
+    s.gyro     = gyroRate;
+    s.pid      = pidOutput;
+    s.speed    = linearSpeed;
+    s.dist     = distanceMM;
+    s.sendR    = (int16_t)dbgSentR;
+    s.sendL    = (int16_t)dbgSentL;
+    s.curR     = (int16_t)actualCurrentR;
+    s.curL     = (int16_t)actualCurrentL;
+    s.rpmR10   = (int16_t)constrain(actualSpeedR * 10.0f, -32767.0f, 32767.0f);
+    s.rpmL10   = (int16_t)constrain(actualSpeedL * 10.0f, -32767.0f, 32767.0f);
+    s.vin100   = (int16_t)(powerStatus().vbus * 100.0f);
+    s.ctrlDtUs = (uint16_t)constrain(ctrlDtMs * 1000.0f, 0.0f, 65535.0f);
+    s.tempR    = (uint8_t)constrain(motorTempR, 0.0f, 255.0f);
+    s.tempL    = (uint8_t)constrain(motorTempL, 0.0f, 255.0f);
+    s.state    = (fallen ? 1 : 0) | (diagMode ? 2 : 0) | (benchMode ? 4 : 0) | (fallPredictActive() ? 8 : 0)
+               | (motionActive() ? 16 : 0);
+    s.pad      = 0;
+    __atomic_store_n(&head, head + 1, __ATOMIC_RELEASE);
+
+    cur->endSeq = head;
+    cur->endMs  = millis();
+    cur->endDist = distanceMM;
+    cur->maxPitch = max(cur->maxPitch, fabsf(pitch));
+    cur->maxPid   = max(cur->maxPid, fabsf(pidOutput));
+    cur->maxSpeed = max(cur->maxSpeed, fabsf(linearSpeed));
+}
+
+void runLogTick() {
+    const bool balancing = !diagMode && !fallen && !benchMode;
+
+    // 开始: 进入架空轮实验, 或从诊断/倒地进入平衡
+    if (!cur) {
+        if (benchMode)      openRun(RUN_BENCH);
+        else if (balancing) openRun(RUN_BALANCE);
+        else                return;
+    }
+
+    // 先记录本拍 (含终点样本), 再判断结束
+    record();
+    if (cur->kind == RUN_BENCH && !benchMode) {
+        closeRun("BENCH_STOP");
+    } else if (cur->kind == RUN_BALANCE && !balancing) {
+        closeRun(fallen ? "FALLEN" : "STOP");
+    }
+}
+
+void runLogPump() {
+    uint32_t ev = boundaryEvents;
+    if (ev == pumpedEvents || runTotal == 0) return;
+    pumpedEvents = ev;
+    char msg[160];
+    buildWebRunMessage(msg, sizeof(msg), runs[(runTotal - 1) % RUNLOG_MAX_RUNS]);
+    webBroadcastText(msg);
+}
+
+uint32_t runLogCapacity() {
+    return cap;
+}
+
+uint32_t runLogOldestSeq() {
+    uint32_t h = __atomic_load_n(&head, __ATOMIC_ACQUIRE);
+    return h > cap ? h - cap + 1 : 0;   // h - cap 的槽位即将被下一条覆盖
+}
+
+int runLogRunCount() {
+    return (int)min(runTotal, (uint32_t)RUNLOG_MAX_RUNS);
+}
+
+bool runLogRun(int idx, RunInfo *out) {
+    uint32_t total = runTotal;
+    if (idx < 0 || (uint32_t)idx >= min(total, (uint32_t)RUNLOG_MAX_RUNS)) return false;
+    const RunInfo &r = runs[(total - 1 - idx) % RUNLOG_MAX_RUNS];
+    if (__atomic_load_n(&r.id, __ATOMIC_ACQUIRE) == 0) return false;
+    *out = r;
+    return true;
+}
+
+bool runLogFind(uint32_t id, RunInfo *out) {
+    for (int i = 0; i < runLogRunCount(); i++) {
+        if (runLogRun(i, out) && out->id == id) return true;
+    }
+    return false;
+}
+
+uint32_t runLogRead(uint32_t seq, RunLogSample *out, uint32_t n) {
+    if (!ring) return 0;
+    uint32_t h = __atomic_load_n(&head, __ATOMIC_ACQUIRE);
+    if (seq < runLogOldestSeq() || seq >= h) return 0;
+    n = min(n, h - seq);
+    for (uint32_t i = 0; i < n; i++) {
+        out[i] = ring[(seq + i) % cap];
+    }
+    // 复制期间写者追上来覆盖了起点 → 作废
+    return seq >= runLogOldestSeq() ? n : 0;
+}
+
+const char *runLogCsvHeader() {
+    return "t_ms,pitch,target,gyro,pid,speed_mm_s,dist_mm,sendR,sendL,curR_mA,curL_mA,"
+           "rpmR,rpmL,vbus,ctrlDt_ms,tempR,tempL,state\n";
+}
+
+size_t runLogFormatCsv(const RunLogSample &s, char *buf, size_t size) {
+    int n = snprintf(buf, size,
+                     "%.3f,%.3f,%.3f,%.2f,%.1f,%.1f,%.1f,%d,%d,%d,%d,%.1f,%.1f,%.2f,%.3f,%u,%u,%u\n",
+                     s.tUs / 1000.0f, s.pitch, s.target, s.gyro, s.pid, s.speed, s.dist,
+                     s.sendR, s.sendL, s.curR, s.curL, s.rpmR10 / 10.0f, s.rpmL10 / 10.0f,
+                     s.vin100 / 100.0f, s.ctrlDtUs / 1000.0f, s.tempR, s.tempL, s.state);
+    return (n > 0 && (size_t)n < size) ? (size_t)n : 0;
+}
+
+void buildWebRunMessage(char *msg, size_t size, const RunInfo &r) {
+    uint32_t oldest = runLogOldestSeq();
+    uint32_t avail = r.endSeq > oldest ? r.endSeq - max(r.startSeq, oldest) : 0;
+    // RL,id,kind,active,reason,startMs,durMs,samples,available,maxPitch,maxPid,maxSpeed,distMm
+    snprintf(msg, size, "RL,%lu,%s,%d,%s,%lu,%lu,%lu,%lu,%.2f,%.1f,%.0f,%.0f",
+             (unsigned long)r.id, r.kind == RUN_BENCH ? "BENCH" : "BAL", r.active ? 1 : 0,
+             r.reason, (unsigned long)r.startMs, (unsigned long)(r.endMs - r.startMs),
+             (unsigned long)(r.endSeq - r.startSeq), (unsigned long)avail,
+             r.maxPitch, r.maxPid, r.maxSpeed, r.endDist - r.startDist);
+}
@@ -0,0 +1,66 @@
+#pragma once
+/**
+ * run_log.h — 设备端闭环日志: 每个控制拍一条采样写入 PSRAM 环, 记录 run 边界 (站立→跌倒/停止)
+ *
+ * 采样只在 run 期间记录 (平衡或架空轮实验), 与页面原先的 startRun()/closeRun() 规则一致。
+ * 网络任务通过 /api/runs 与 /api/log 下载, 环被覆盖的部分如实报告为不可用。
+ */
+
+#include <Arduino.h>
+
+struct __attribute__((packed)) RunLogSample {
+    uint32_t tUs;            // 相对 run 开始 (µs)
+    float    pitch;          // 控制用 pitch (含安装偏置, °)
+    float    target;         // 目标倾角 (低通后, °)
+    float    gyro;           // °/s
+    float    pid;            // PID 输出
+    float    speed;          // 线速度 mm/s
+    float    dist;           // 累计距离 mm
+    int16_t  sendR, sendL;   // 实际下发指令
+    int16_t  curR, curL;     // 反馈电流 mA (电机坐标)
+    int16_t  rpmR10, rpmL10; // 反馈转速 RPM×10
+    int16_t  vin100;         // 母线电压 V×100
+    uint16_t ctrlDtUs;       // 实际拍间隔 (µs)
+    uint8_t  tempR, tempL;   // 芯片温度 °C
+    uint8_t  state;          // bit0 fallen, bit1 diag, bit2 bench, bit3 跌倒预测斜坡, bit4 轨迹跟踪
+    uint8_t  pad;
+};
+
+enum RunKind : uint8_t { RUN_BALANCE, RUN_BENCH };
+
+struct RunInfo {
+    uint32_t id;             // 0 = 空槽
+    uint8_t  kind;
+    bool     active;
+    const char *reason;      // 结束原因 FALLEN / STOP / BENCH_STOP; 进行中为 ""
+    uint32_t startSeq;       // 首条采样的全局序号
+    uint32_t endSeq;         // 末条之后的序号 (进行中随写入推进)
+    uint32_t startMs, endMs;
+    float    startDist, endDist;
+    float    maxPitch, maxPid, maxSpeed;   // 绝对值最大
+};
+
+// 分配环形缓冲区 (优先 PSRAM)
+void runLogInit();
+
+// 每个控制拍调用 (balanceControl 之后): 检测 run 边界并记录采样
+void runLogTick();
+
+// 主循环调用: run 开始/结束时广播 RL 消息
+void runLogPump();
+
+// ---- 读取 (网络任务) ----
+uint32_t runLogCapacity();               // 环容量 (条)
+uint32_t runLogOldestSeq();              // 仍可读的最早序号
+int      runLogRunCount();               // 已记录 run 槽位数 (最多 RUNLOG_MAX_RUNS)
+bool     runLogRun(int idx, RunInfo *out);   // idx 0 = 最新
+bool     runLogFind(uint32_t id, RunInfo *out);
+
+// 读 n 条 (从全局序号 seq 起); 返回实际读到且在复制期间未被覆盖的条数
+uint32_t runLogRead(uint32_t seq, RunLogSample *out, uint32_t n);
+
+// CSV 表头 / 单行 (行首为 run 内时间 ms)
+const char *runLogCsvHeader();
+size_t runLogFormatCsv(const RunLogSample &s, char *buf, size_t size);
+
+void buildWebRunMessage(char *msg, size_t size, const RunInfo &r);
@@ -6,8 +6,33 @@
  *   globals.h/cpp   — 跨模块共享变量
  *   can_motor.h/cpp — CAN 总线 + 电机驱动
  *   imu_balance.h/cpp — IMU 姿态 + PID 平衡
- *   web_control.h/cpp — WiFi + WebSocket + 手机控制页
- *   display.h/cpp   — LCD 屏幕显示
+ *   web_control.h/cpp — WiFi + WebSocket + 手机控制页 (网络任务在核 0)
+ *   net_queue.h/cpp — 控制核 ↔ 网络任务的 SPSC 无锁消息环
+ *   web_api.h/cpp   — HTTP JSON 接口 /api/status|params|registers|diag (+ /api/cmd)
+ *   param_registry.h/cpp — 运行时可调参数表 (PS 命令 / 参数接口)
+ *   motor_regs.h/cpp — RollerCAN 寄存器快照缓存 (seqlock, 批量读不触发 CAN)
+ *   run_log.h/cpp   — 设备端闭环日志 (PSRAM 环 + run 边界, /api/runs /api/log 下载)
+ *   display.h/cpp   — LCD 屏幕显示 (核 0 低优先级任务, sprite 脏块 DMA 推送, 平衡期也刷新)
+ *   gain_schedule.h/cpp — 增益调度表 (pitch × 速度 × Vin)
+ *   power_mgmt.h/cpp — 母线电压/内阻/SOC 估计 + 电流预算
+ *   thermal_model.h/cpp — 电机 I²t + 绕组温升模型, 每电机电流上限
+ *   motor_charact.h/cpp — 架空轮电机特性辨识 (主机拟合见 tools/motor_charact.py)
+ *   can_latency.h/cpp — CAN 往返时延探针 (LP,1 开启, LT 统计)
+ *   profiler.h/cpp  — 控制拍/主循环分段周期计数 (PF 上报)
+ *   deadline_monitor.h/cpp — 控制拍迟到/跳拍统计 + 肇事活动事件日志 (DL)
+ *   joystick_input.h/cpp — 摇杆通道: 序号/时间戳, 插值, 超时衰减 (JS 统计)
+ *   udp_transport.h/cpp — UDP 摇杆 + 高速遥测通道 (主机端 tools/mbot_udp.py)
+ *   telemetry_hub.h/cpp — WebSocket 遥测按客户端订阅分发 + 慢客户端丢帧
+ *   tel_stream.h/cpp — 逐拍遥测采样环 (K 二进制流, 页面图表 500Hz 数据源)
+ *   spectrum.h/cpp  — pitch/gyro/电流 Welch PSD (核 0 低优先级任务, SP,1 开启, FS 上报)
+ *   touch_ui.h/cpp  — 触屏菜单 (loop 只入队触摸事件, 菜单在显示任务内, 动作经命令表执行)
+ *   supervisor.h/cpp — 安全监督 (核 0 高优先级任务: 心跳/反馈/过流/过角 → CAN 保留路径断电并锁存;
+ *                      任务看门狗复位 + canInit 上电 CMD_OFF 模拟电机侧通信超时)
+ *   fall_predict.h/cpp — 相平面跌倒预测 (捕获区 + 电流饱和历史, 提前判定后斜坡降力矩, FP 上报)
+ *   standup.h/cpp   — 支架自立 (回放离线规划电流曲线, 匹配状态交给 PID, SU 上报自立时间/峰值电流)
+ *   standup_profile.h/cpp — 自立曲线表 (由 tools/standup_planner.py 生成)
+ *   motion_control.h/cpp — 轨迹跟踪 (TV 定时 v/ω / TW 航点队列, 速度+航向闭环, TE 上报跟踪误差)
+ *   web_ui_page.h/cpp — 内置页面 gzip 数组 (源文件 web_ui/index.html, 由 tools/gen_web_ui.py 生成)
  */
 
 #include <M5Unified.h>
@@ -18,19 +43,38 @@
 #include "web_control.h"
 #include "display.h"
 #include "auto_tune.h"
+#include "gain_schedule.h"
+#include "power_mgmt.h"
+#include "motor_charact.h"
+#include "profiler.h"
+#include "deadline_monitor.h"
+#include "joystick_input.h"
+#include "udp_transport.h"
+#include "telemetry_hub.h"
+#include "motor_regs.h"
+#include "run_log.h"
+#include "tel_stream.h"
+#include "spectrum.h"
+#include "touch_ui.h"
+#include "supervisor.h"
+#include "fall_predict.h"
+#include "standup.h"
+#include "motion_control.h"
+#include "web_protocol.h"
 
 // ============ 时间管理 ============
 static unsigned long lastCtrlUs  = 0;
-static unsigned long lastDispMs  = 0;
-static unsigned long lastWsMs    = 0;
-static unsigned long lastMotorWsMs   = 0;
 static unsigned long lastMotorPollMs = 0;
+static unsigned long lastProfMs      = 0;
 // (diagMode 由 Stand 按钮手动控制)
 
 // ============ Setup ============
 void setup() {
     auto cfg = M5.config();
     M5.begin(cfg);
+
+    // CAN 最先初始化: 若是崩溃/看门狗复位, 电机仍保持复位前的电流, 立即 CMD_OFF
+    canInit();
     delay(300);
 
     // 屏幕
@@ -49,21 +93,31 @@ void setup() {
         M5.Lcd.println("IMU not found!");
     }
 
-    // CAN
-    canInit();
-
     // 电机
     M5.Lcd.setTextColor(GREEN);
     M5.Lcd.println("Scanning motors...");
     bool ok = motorsInit();
     M5.Lcd.printf("Motors: %s\n", ok ? "ALL OK" : "PARTIAL");
 
+    // 增益调度表 (NVS)
+    gainScheduleInit();
+
+    // 闭环日志缓冲区 (PSRAM)
+    runLogInit();
+
+    // 频谱分析任务 (核 0, SP,1 后才采样)
+    spectrumInit();
 
     // WiFi + Web
     webInit();
+    udpInit();
 
     delay(1000);
-    drawMainUI();
+    touchUiInit();
+    displayInit();
+
+    // 安全监督任务 + 任务看门狗 (放在最后: 之前的 WiFi 连接等步骤会阻塞数秒)
+    supervisorInit();
     lastCtrlUs = micros();
 
     // 进入诊断模式 (不驱动电机, 等待用户扶直)
@@ -71,90 +125,122 @@ void setup() {
 
 }
 
-// ============ Loop ============
-void loop() {
-    M5.update();
-
-    // --- 高频控制循环 (固定步长 500Hz / 2ms) ---
-    // 固定 dt 可避免网络/串口偶发阻塞造成的等效参数漂移与控制突变。
+// ============ 控制拍追赶 ============
+// 固定 dt 可避免网络/串口偶发阻塞造成的等效参数漂移与控制突变。
+// 落后时最多连续补 maxCatchup 拍, 其余丢弃 (计入 deadline_monitor 的跳拍统计)。
+static void runControlTicks(int maxCatchup) {
     unsigned long nowUs = micros();
     int catchup = 0;
-    while ((nowUs - lastCtrlUs) >= CTRL_US && catchup < 6) {
+    while ((nowUs - lastCtrlUs) >= CTRL_US && catchup < maxCatchup) {
         lastCtrlUs += CTRL_US;
+        deadlineTick(micros() - lastCtrlUs);
         const float dt = CTRL_US / 1000000.0f;
+        deadlineBegin(DL_CTRL);
+        PROF_BEGIN(PROF_TICK);
+        joystickUpdate(dt);
         updateIMU(dt);
         balanceControl(dt);
+        runLogTick();
+        telStreamTick();
+        spectrumTick();
+        supervisorBeat(!diagMode && !fallen);
+        PROF_END(PROF_TICK);
+        deadlineEnd(DL_CTRL);
         catchup++;
     }
     if ((nowUs - lastCtrlUs) >= CTRL_US) {
+        deadlineSkip((nowUs - lastCtrlUs) / CTRL_US, nowUs - lastCtrlUs);
         lastCtrlUs = nowUs;
     }
+    deadlineBurstEnd();
+}
+
+// ============ Loop ============
+void loop() {
+    supervisorFeed();
+
+    deadlineBegin(DL_M5);
+    M5.update();
+    deadlineEnd(DL_M5);
 
-    // --- 网络任务 (平衡时减少处理，降低阻塞) ---
+    // --- 高频控制循环 (固定步长 500Hz / 2ms) ---
+    runControlTicks(6);
+
+    // --- 网络: 取出核 0 网络任务转来的命令 (无 socket 操作) + UDP ---
+    PROF_BEGIN(PROF_WEB);
     webLoop();
+    udpLoop();
+    touchUiCommands();
+    PROF_END(PROF_WEB);
 
-    // --- 网络任务后再补一轮控制 (减少 WiFi 引起的控制空白) ---
-    nowUs = micros();
-    catchup = 0;
-    while ((nowUs - lastCtrlUs) >= CTRL_US && catchup < 4) {
-        lastCtrlUs += CTRL_US;
-        const float dt = CTRL_US / 1000000.0f;
-        updateIMU(dt);
-        balanceControl(dt);
-        catchup++;
-    }
-    if ((nowUs - lastCtrlUs) >= CTRL_US) {
-        lastCtrlUs = nowUs;
-    }
+    // --- 命令处理/UDP 后再补一轮控制 (减少控制空白) ---
+    runControlTicks(4);
 
-    // --- 触屏: 左=Kp-, 右=Kp+, 中=站立 (自动调参时屏蔽) ---
-    auto tc = M5.Touch.getDetail();
-    if (tc.wasPressed() && !isAutoTuning()) {
-        int third = screenW / 3;
-        if (tc.x < third) {
-            Kp = max(0.0f, Kp - 1.0f);
-        } else if (tc.x > third * 2) {
-            Kp = min(40.0f, Kp + 1.0f);
-        } else {
-            if (fallen) {
-                diagMode = true;
-                fallen   = false;
-                stableCount = STABLE_HOLD_COUNT;
-            }
-            if (diagMode) {
-                activateBalance();
-            }
-        }
-    }
+    // --- 触屏: 只把按下/按住事件放入队列, 菜单逻辑与绘制在核 0 显示任务 ---
+    touchUiPoll();
 
     // --- 自动调参状态机 ---
+    deadlineBegin(DL_AUTOTUNE);
+    PROF_BEGIN(PROF_AUTOTUNE);
     autoTuneUpdate();
+    PROF_END(PROF_AUTOTUNE);
+    deadlineEnd(DL_AUTOTUNE);
 
-    // --- 低频任务 ---
-    unsigned long nowMs = millis();
+    // --- 电机辨识采样上传 ---
+    charactPump();
 
-    // 屏幕刷新 — 平衡期完全跳过 (SPI操作约30-40ms，严重阻塞控制环)
-    bool balancing = !diagMode && !fallen && !benchMode;
-    if (!balancing && (nowMs - lastDispMs > 500)) {
-        lastDispMs = nowMs;
-        updateDisplay();
-    }
+    // --- 闭环日志 run 边界通知 (RL) ---
+    runLogPump();
 
-    // WebSocket 姿态广播 (50ms → 20Hz, 从20ms提高到50ms减少WiFi阻塞)
-    if (nowMs - lastWsMs > 50) {
-        lastWsMs = nowMs;
-        webBroadcastAngle();
-    }
+    // --- 频谱上报 (FS, 文本已在核 0 格式化) ---
+    spectrumPump();
 
-    // 电机状态广播 (500ms)
-    if (nowMs - lastMotorWsMs > 500) {
-        lastMotorWsMs = nowMs;
-        webBroadcastMotor();
-    }
+    // --- 安全监督触发上报 ---
+    supervisorPump();
+
+    // --- 跌倒预测事件上报 (FP) ---
+    fallPredictPump();
+
+    // --- 支架自立记录上报 (SU) ---
+    standupPump();
+
+    // --- 轨迹跟踪误差上报 (TE) ---
+    motionPump();
+
+    // --- 超时事件日志上传 ---
+    deadlinePump();
+
+    // --- 低频任务 ---
+    unsigned long nowMs = millis();
+
+    // 遥测分发: 每客户端按订阅周期编码入队 (默认 A/T 20ms, M/PW/TH/DL/JS 500ms);
+    // 电源告警升级时立即推送
+    if (powerWarnRaised()) telemetryHubKick(TEL_POWER);
+    telemetryHubPump();
 
     // 电机参数轮询 (仅诊断/倒地时，避免平衡期阻塞)
     if (nowMs - lastMotorPollMs > 1000) {
         lastMotorPollMs = nowMs;
+        deadlineBegin(DL_CAN_READ);
+        PROF_BEGIN(PROF_POLL);
         motorsPollParams();
+        PROF_END(PROF_POLL);
+        deadlineEnd(DL_CAN_READ);
+    }
+
+    // 寄存器快照补读 (HTTP /api/registers 只读缓存; 同样仅诊断/倒地时)
+    deadlineBegin(DL_CAN_READ);
+    motorRegsPoll();
+    deadlineEnd(DL_CAN_READ);
+
+#if PROFILER_ENABLE
+    // 分段耗时窗口统计 → 串口 (WebSocket 由遥测分发按 PF 订阅发送)
+    if (nowMs - lastProfMs >= PROFILER_REPORT_MS) {
+        lastProfMs = nowMs;
+        profLatch();
+        char msg[512];
+        buildWebProfileMessage(msg, sizeof(msg));
+        Serial.println(msg);
     }
+#endif
 }
@@ -0,0 +1,185 @@
+/**
+ * spectrum.cpp — 控制信号频谱分析
+ *
+ * 控制拍只把 4 个 float 写入采样环 (head 以 release 发布), 其余全部在核 0 的分析任务中完成:
+ *   1. 取最近 SPEC_WINDOW 条 (复制后重读 head, 复制期间被覆盖则放弃本轮);
+ *   2. 去均值, 分 SPEC_SEGMENTS 段 (50% 重叠) 加 Hann 窗, SPEC_FFT_N 点 FFT, |X|² 平均;
+ *   3. 换算单边 PSD (单位²/Hz) 取 dB, 连同峰值频率/RMS 格式化为 FS 文本。
+ * 分析任务优先级低于网络任务, 只占核 0 空闲时间; 结果与 loop 之间用 ready/sent 序号交接,
+ * loop 侧只把现成文本放入出站队列。
+ *
+ * FFT 为基 2 复数 FFT + 预计算旋转因子表, ESP32-S3 有单精度 FPU, 512 点约 0.3ms。
+ */
+
+#include "spectrum.h"
+#include "config.h"
+#include "globals.h"
+#include "imu_balance.h"
+#include "web_control.h"
+
+static const int SIG_N   = 4;
+static const int BINS    = SPEC_FFT_N / 2 + 1;
+static const char *const SIG_NAMES[SIG_N] = {"pitch", "gyro", "gyroF", "cur"};
+
+// ---- 控制核写, 分析任务读 ----
+static float ring[SIG_N][SPEC_RING];
+static volatile uint32_t head = 0;
+static volatile bool enabled = false;
+static uint32_t enableHead = 0;
+
+// ---- 分析任务私有 ----
+static float win[SPEC_WINDOW];
+static float re[SPEC_FFT_N], im[SPEC_FFT_N];
+static float psd[BINS];
+static float hann[SPEC_FFT_N];
+static float twCos[SPEC_FFT_N / 2], twSin[SPEC_FFT_N / 2];
+static float hannPower = 0;   // Σw²
+
+// ---- 交接: 分析任务写 msgs 后发布 ready, loop 发送后写回 sent ----
+static char msgs[SIG_N][NET_MSG_MAX];
+static volatile uint32_t readySeq = 0;
+static volatile uint32_t sentSeq  = 0;
+
+void spectrumTick() {
+    if (!enabled) return;
+    uint32_t i = head % SPEC_RING;
+    ring[0][i] = currentPitch + PITCH_MOUNT_OFFSET;
+    ring[1][i] = gyroRate;
+    ring[2][i] = filteredGyroRate();
+    ring[3][i] = 0.5f * (actualCurrentR * DIR_R + actualCurrentL * DIR_L);
+    __atomic_store_n(&head, head + 1, __ATOMIC_RELEASE);
+}
+
+void spectrumEnable(bool on) {
+    if (on && !enabled) enableHead = head;
+    enabled = on;
+}
+
+bool spectrumEnabled() {
+    return enabled;
+}
+
+// ============ FFT ============
+static void fftInit() {
+    for (int i = 0; i < SPEC_FFT_N; i++) {
+        hann[i] = 0.5f - 0.5f * cosf(TWO_PI * i / SPEC_FFT_N);
+        hannPower += hann[i] * hann[i];
+    }
+    for (int i = 0; i < SPEC_FFT_N / 2; i++) {
+        twCos[i] = cosf(TWO_PI * i / SPEC_FFT_N);
+        twSin[i] = -sinf(TWO_PI * i / SPEC_FFT_N);
+    }
+}
+
+static void fft() {
+    // 位反转重排
+    for (int i = 1, j = 0; i < SPEC_FFT_N; i++) {
+        int bit = SPEC_FFT_N >> 1;
+        for (; j & bit; bit >>= 1) j ^= bit;
+        j ^= bit;
+        if (i < j) {
+            float t = re[i]; re[i] = re[j]; re[j] = t;
+            t = im[i]; im[i] = im[j]; im[j] = t;
+        }
+    }
+    for (int len = 2; len <= SPEC_FFT_N; len <<= 1) {
+        const int half = len >> 1;
+        const int step = SPEC_FFT_N / len;
+        for (int i = 0; i < SPEC_FFT_N; i += len) {
+            for (int k = 0; k < half; k++) {
+                const float wr = twCos[k * step], wi = twSin[k * step];
+                const int a = i + k, b = a + half;
+                const float xr = re[b] * wr - im[b] * wi;
+                const float xi = re[b] * wi + im[b] * wr;
+                re[b] = re[a] - xr;
+                im[b] = im[a] - xi;
+                re[a] += xr;
+                im[a] += xi;
+            }
+        }
+    }
+}
+
+// ============ 分析任务 ============
+// 复制一个信号的最近窗口; 复制期间被控制拍覆盖返回 false
+static bool snapshot(int sig, uint32_t end) {
+    const uint32_t start = end - SPEC_WINDOW;
+    for (int i = 0; i < SPEC_WINDOW; i++) win[i] = ring[sig][(start + i) % SPEC_RING];
+    uint32_t h = __atomic_load_n(&head, __ATOMIC_ACQUIRE);
+    return h - start <= (uint32_t)SPEC_RING;
+}
+
+static void welch() {
+    float mean = 0;
+    for (int i = 0; i < SPEC_WINDOW; i++) mean += win[i];
+    mean /= SPEC_WINDOW;
+
+    memset(psd, 0, sizeof(psd));
+    for (int s = 0; s < SPEC_SEGMENTS; s++) {
+        const float *x = win + s * (SPEC_FFT_N / 2);
+        for (int i = 0; i < SPEC_FFT_N; i++) {
+            re[i] = (x[i] - mean) * hann[i];
+            im[i] = 0;
+        }
+        fft();
+        for (int k = 0; k < BINS; k++) psd[k] += re[k] * re[k] + im[k] * im[k];
+    }
+    // 单边 PSD: 2|X|² / (fs·Σw²), 直流与奈奎斯特频点不翻倍
+    const float norm = 1.0f / (SPEC_SEGMENTS * (float)CTRL_HZ * hannPower);
+    for (int k = 0; k < BINS; k++) {
+        psd[k] *= (k == 0 || k == BINS - 1) ? norm : 2.0f * norm;
+    }
+}
+
+// FS,name,seq,binHz,peakHz,peakDb,rms,db0,db1,...  (dB 取整并钳位到 ±99, 全部 257 点约 1.1KB)
+static void format(int sig, uint32_t seq, char *out, size_t size) {
+    const float binHz = (float)CTRL_HZ / SPEC_FFT_N;
+    int peak = 1;
+    float power = 0;
+    for (int k = 1; k < BINS; k++) {
+        if (psd[k] > psd[peak]) peak = k;
+        power += psd[k] * binHz;
+    }
+    int n = snprintf(out, size, "FS,%s,%lu,%.4f,%.2f,%.1f,%.4g", SIG_NAMES[sig],
+                     (unsigned long)seq, binHz, peak * binHz,
+                     10.0f * log10f(psd[peak] + 1e-12f), sqrtf(power));
+    for (int k = 0; k < BINS && n > 0 && (size_t)n + 8 < size; k++) {
+        int db = (int)lroundf(10.0f * log10f(psd[k] + 1e-12f));
+        n += snprintf(out + n, size - n, ",%d", constrain(db, -99, 99));
+    }
+}
+
+static void spectrumTask(void *) {
+    uint32_t seq = 0;
+    for (;;) {
+        vTaskDelay(pdMS_TO_TICKS(SPEC_PUBLISH_MS));
+        uint32_t end = __atomic_load_n(&head, __ATOMIC_ACQUIRE);
+        if (!enabled || end - enableHead < (uint32_t)SPEC_WINDOW) continue;
+        if (__atomic_load_n(&sentSeq, __ATOMIC_ACQUIRE) != readySeq) continue;   // 上一轮未发出
+
+        bool ok = true;
+        for (int sig = 0; sig < SIG_N && ok; sig++) {
+            ok = snapshot(sig, end);
+            if (!ok) break;
+            welch();
+            format(sig, seq, msgs[sig], sizeof(msgs[sig]));
+            vTaskDelay(1);   // 各信号之间让出, 不连续占用核 0
+        }
+        if (ok) __atomic_store_n(&readySeq, ++seq, __ATOMIC_RELEASE);
+    }
+}
+
+void spectrumInit() {
+    fftInit();
+    xTaskCreatePinnedToCore(spectrumTask, "spectrum", SPEC_TASK_STACK, nullptr, SPEC_TASK_PRIO,
+                            nullptr, SPEC_TASK_CORE);
+}
+
+void spectrumPump() {
+    uint32_t ready = __atomic_load_n(&readySeq, __ATOMIC_ACQUIRE);
+    if (ready == sentSeq) return;
+    if (enabled) {
+        for (int sig = 0; sig < SIG_N; sig++) webBroadcastText(msgs[sig]);
+    }
+    __atomic_store_n(&sentSeq, ready, __ATOMIC_RELEASE);
+}
@@ -0,0 +1,21 @@
+#pragma once
+/**
+ * spectrum.h — 控制信号频谱分析: 控制拍全速采样, 核 0 低优先级任务做 Welch PSD, FS 上报
+ *
+ * 信号: pitch (°), gyro 原始 (°/s), gyroF 即 D 项输入 (GYRO_LPF_ALPHA 低通后, °/s), cur 两轮平均电流 (mA)。
+ * 对比 gyro 与 gyroF 可直接看出低通滤波的衰减, 电流谱上的窄峰多为机械/电机共振。
+ */
+
+#include <Arduino.h>
+
+// 创建核 0 分析任务 (默认不采样, SP,1 开启)
+void spectrumInit();
+
+// 每个控制拍调用 (balanceControl 之后); 未开启时立即返回
+void spectrumTick();
+
+void spectrumEnable(bool on);
+bool spectrumEnabled();
+
+// 主循环调用: 有新谱时广播 FS 消息 (格式化在分析任务中完成)
+void spectrumPump();
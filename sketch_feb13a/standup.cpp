@@ -0,0 +1,154 @@
+/**
+ * standup.cpp — 支架自立曲线回放
+ *
+ * 表由 tools/standup_planner.py 按轮-车身模型离线规划: 满电流 (SU_PLAN_LIMIT_MA)
+ * 推向竖直, 单次切换后反向制动 (bang-bang, 二阶系统的时间最优解), 在制动段中
+ * PID 指令与表电流相差不超过 SU_MATCH_MA 的一行截断, 作为交接点。
+ *
+ * 回放: I = 前馈 + (Kp·(θ-θref) + Kd·(ω-ωref))·CURRENT_MODE_GAIN_MA_PER_RPM,
+ * 按控制拍计时 (与规划同一时基, 不受 millis 抖动影响)。跟踪误差超过 SU_ABORT_DEG
+ * (模型失配/热限流削掉了前馈) 即中止, 调用方改用恢复增益, 与没有规划表时相同。
+ *
+ * 每次从支架启动 (规划表或恢复增益) 都计时到站稳 (|pitch| < SU_UPRIGHT_DEG 且
+ * |角速度| < SU_UPRIGHT_DPS 持续 SU_UPRIGHT_HOLD_MS), 记录单电机实测电流峰值, 在
+ * SU 事件中上报, 用 SU,0/1 切换即可在实机上对比两种方式。
+ */
+
+#include "standup.h"
+#include "can_motor.h"
+#include "config.h"
+#include "globals.h"
+#include "standup_profile.h"
+#include "web_control.h"
+
+static bool                  enabled = SU_ENABLE;
+static const StandupProfile *prof    = nullptr;
+static uint32_t              tick    = 0;
+
+// ---- 本次自立记录 (控制拍写, loop 上报) ----
+enum SuMode : uint8_t { SU_MODE_PID, SU_MODE_PLAN, SU_MODE_ABORT };
+static const char *const MODE_NAMES[] = {"PID", "PLAN", "ABORT"};
+
+struct StandupEvent {
+    SuMode  mode;
+    float   startPitch;
+    int32_t upMs;          // 站稳用时, -1 = 跌倒或超时
+    int32_t handoverMs;    // 交接/中止时刻, -1 = 未回放
+    float   peakMa;
+    float   maxErr;        // 回放中最大跟踪误差 (°)
+};
+static StandupEvent      ev;
+static bool              observing = false;
+static uint32_t          obsTicks  = 0;
+static uint32_t          holdTicks = 0;
+static volatile uint32_t readySeq  = 0;
+static uint32_t          sentSeq   = 0;
+
+static const float TICK_MS = CTRL_US / 1000.0f;
+
+void standupEnable(bool on) {
+    enabled = on;
+}
+
+bool standupEnabled() {
+    return enabled;
+}
+
+bool standupActive() {
+    return prof != nullptr;
+}
+
+bool standupBegin(float pitchDeg) {
+    ev.mode       = SU_MODE_PID;
+    ev.startPitch = pitchDeg;
+    ev.upMs       = -1;
+    ev.handoverMs = -1;
+    ev.peakMa     = 0;
+    ev.maxErr     = 0;
+    observing     = true;
+    obsTicks      = 0;
+    holdTicks     = 0;
+
+    prof = nullptr;
+    if (!enabled || getMotorMode() != MODE_CURRENT) return false;
+    const StandupProfile *p = pitchDeg < 0 ? &SU_PROFILE_FWD : &SU_PROFILE_BACK;
+    if (fabsf(pitchDeg - p->startCd * 0.01f) > SU_START_TOL_DEG) return false;
+
+    prof    = p;
+    tick    = 0;
+    ev.mode = SU_MODE_PLAN;
+    return true;
+}
+
+static void finishPlayback(SuMode mode) {
+    ev.mode       = mode;
+    ev.handoverMs = (int32_t)(tick * TICK_MS);
+    prof          = nullptr;
+}
+
+bool standupTick(float pitchDeg, float rateDps, float *outMa) {
+    if (!prof) return false;
+
+    // 行号 + 行内插值系数
+    const float u = (float)tick * TICK_MS / (float)SU_ROW_MS;
+    const uint32_t i = (uint32_t)u;
+    if (i + 1 >= prof->rows) {
+        finishPlayback(ev.mode);
+        return false;
+    }
+    const float f = u - (float)i;
+    const StandupRow &a = prof->row[i];
+    const StandupRow &b = prof->row[i + 1];
+    const float ff   = a.ma + (b.ma - a.ma) * f;
+    const float pRef = (a.pitchCd + (b.pitchCd - a.pitchCd) * f) * 0.01f;
+    const float rRef = (a.rateDd + (b.rateDd - a.rateDd) * f) * 0.1f;
+
+    const float err = pitchDeg - pRef;
+    if (fabsf(err) > ev.maxErr) ev.maxErr = fabsf(err);
+    if (fabsf(err) > SU_ABORT_DEG) {
+        finishPlayback(SU_MODE_ABORT);
+        return false;
+    }
+
+    *outMa = ff + (Kp * err + Kd * (rateDps - rRef)) * CURRENT_MODE_GAIN_MA_PER_RPM;
+    tick++;
+    return true;
+}
+
+void standupObserve(float pitchDeg, float rateDps) {
+    if (!observing) return;
+    obsTicks++;
+
+    const float cur = max(fabsf(actualCurrentR), fabsf(actualCurrentL));
+    if (cur > ev.peakMa) ev.peakMa = cur;
+
+    bool done = false;
+    if (fabsf(pitchDeg) < SU_UPRIGHT_DEG && fabsf(rateDps) < SU_UPRIGHT_DPS) {
+        if (++holdTicks * TICK_MS >= SU_UPRIGHT_HOLD_MS) {
+            ev.upMs = (int32_t)((obsTicks - holdTicks) * TICK_MS);
+            done = true;
+        }
+    } else {
+        holdTicks = 0;
+    }
+    if (fallen || diagMode || obsTicks * TICK_MS >= SU_OBSERVE_MS) done = true;
+    if (!done) return;
+
+    prof      = nullptr;
+    observing = false;
+    __atomic_store_n(&readySeq, readySeq + 1, __ATOMIC_RELEASE);
+}
+
+void standupPump() {
+    const uint32_t seq = __atomic_load_n(&readySeq, __ATOMIC_ACQUIRE);
+    if (seq == sentSeq) return;
+    sentSeq = seq;
+
+    // SU,seq,mode,startPitch,upMs,peakMa,handoverMs,maxErr
+    char msg[96];
+    snprintf(msg, sizeof(msg), "SU,%lu,%s,%.1f,%ld,%.0f,%ld,%.2f", (unsigned long)seq,
+             MODE_NAMES[ev.mode], ev.startPitch, (long)ev.upMs, ev.peakMa, (long)ev.handoverMs,
+             ev.maxErr);
+    webBroadcastText(msg);
+    Serial.printf("[SU] %s\n", msg);
+}
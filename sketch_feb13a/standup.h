@@ -0,0 +1,29 @@
+#pragma once
+/**
+ * standup.h — 支架自立: 回放离线规划的电流曲线 (standup_profile.cpp), 跟踪反馈,
+ *             状态匹配后交给平衡 PID; 每次从支架启动记录自立时间/峰值电流 (SU)
+ */
+
+#include <Arduino.h>
+
+// activateBalance 大角度启动时调用: 开始计时, 条件满足 (电流模式/SU 使能/起点在表容差内)
+// 时启动曲线回放并返回 true; 返回 false 时沿用恢复增益
+bool standupBegin(float pitchDeg);
+
+// 曲线回放中 (期间不判跌倒, 由 standupTick 给出电流)
+bool standupActive();
+
+// 回放中每拍调用: pitch °, 滤波角速度 °/s。返回 true 时 *outMa 为本拍电流指令
+// (与 balanceControl 输出同号); 返回 false 表示已到交接点或跟踪误差超限中止,
+// 调用方本拍起改用 PID (恢复保护期重新计时)
+bool standupTick(float pitchDeg, float rateDps, float *outMa);
+
+// 每拍调用 (含跌倒后): 自立计时 — 站稳 / 跌倒 / 超时结束本次记录
+void standupObserve(float pitchDeg, float rateDps);
+
+// 运行时开关 (SU,0/1), 用于与恢复增益对比
+void standupEnable(bool on);
+bool standupEnabled();
+
+// loop 中调用: 记录结束后广播 SU 事件
+void standupPump();
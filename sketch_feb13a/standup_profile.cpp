@@ -0,0 +1,66 @@
+// 由 tools/standup_planner.py 生成, 请勿手改
+// 模型 ω0=15.8rad/s G=24.9mA/°, 规划电流 800mA, 时延 2.0ms + τ 1.0ms
+#include "standup_profile.h"
+
+const uint16_t SU_ROW_MS = 4;
+
+// 起点 -13.0°: 切换 58.9ms, 交接 92ms (PID 717mA)
+static const StandupRow ROWS_FWD[] = {
+  { -800,  -1300,      0},
+  { -800,  -1300,      9},
+  { -800,  -1295,     72},
+  { -800,  -1283,    181},
+  { -800,  -1264,    320},
+  { -800,  -1238,    477},
+  { -800,  -1205,    646},
+  { -800,  -1164,    823},
+  { -800,  -1115,   1009},
+  { -800,  -1058,   1201},
+  { -800,   -993,   1400},
+  { -800,   -920,   1607},
+  { -800,   -837,   1823},
+  { -800,   -745,   2048},
+  { -349,   -643,   2283},
+  {  800,   -533,   2499},
+  {  800,   -422,   2596},
+  {  800,   -322,   2522},
+  {  800,   -236,   2334},
+  {  800,   -164,   2082},
+  {  800,   -104,   1796},
+  {  800,    -59,   1491},
+  {  800,    -26,   1178},
+  {  800,     -6,    860},
+};
+
+// 起点 +15.0°: 切换 67.6ms, 交接 100ms (PID -875mA)
+static const StandupRow ROWS_BACK[] = {
+  {  800,   1500,      0},
+  {  800,   1500,     -7},
+  {  800,   1496,    -59},
+  {  800,   1486,   -153},
+  {  800,   1470,   -273},
+  {  800,   1447,   -409},
+  {  800,   1418,   -556},
+  {  800,   1383,   -710},
+  {  800,   1341,   -872},
+  {  800,   1292,  -1039},
+  {  800,   1235,  -1212},
+  {  800,   1172,  -1393},
+  {  800,   1100,  -1580},
+  {  800,   1020,  -1776},
+  {  800,    931,  -1981},
+  {  800,    834,  -2195},
+  {  633,    727,  -2421},
+  { -800,    611,  -2647},
+  { -800,    492,  -2772},
+  { -800,    383,  -2715},
+  { -800,    289,  -2537},
+  { -800,    208,  -2288},
+  { -800,    140,  -2002},
+  { -800,     86,  -1697},
+  { -800,     45,  -1382},
+  { -800,     17,  -1063},
+};
+
+const StandupProfile SU_PROFILE_FWD = {-1300, 24, ROWS_FWD};
+const StandupProfile SU_PROFILE_BACK = {1500, 26, ROWS_BACK};
@@ -0,0 +1,23 @@
+#pragma once
+/**
+ * standup_profile.h — 支架自立电流曲线表 (由 tools/standup_planner.py 生成 standup_profile.cpp)
+ */
+
+#include <Arduino.h>
+
+// 每行间隔 SU_ROW_MS, 行间线性插值
+struct StandupRow {
+    int16_t ma;        // 电流前馈 (mA, 与 balanceControl 输出同号: 正值使 pitch 减小)
+    int16_t pitchCd;   // 期望 pitch (°×100)
+    int16_t rateDd;    // 期望滤波角速度 (°/s×10, filteredGyroRate 口径)
+};
+
+struct StandupProfile {
+    int16_t           startCd;   // 起点 pitch (°×100, 支架限位)
+    uint16_t          rows;      // 最后一行 = 交接点
+    const StandupRow *row;
+};
+
+extern const uint16_t       SU_ROW_MS;
+extern const StandupProfile SU_PROFILE_FWD;    // 前支架 -13°
+extern const StandupProfile SU_PROFILE_BACK;   // 后支架 +15°
@@ -0,0 +1,226 @@
+/**
+ * supervisor.cpp — 安全监督任务
+ *
+ * 跌倒检测、热限流、反馈镜像都在 balanceControl()/driveMotors() 内部; 若 loop 停顿
+ * (WiFi、阻塞读寄存器、显示), 电机会一直保持最后一次电流指令。本任务固定在核 0,
+ * 优先级高于网络/显示任务, 每 SUP_PERIOD_MS 检查一次 (只在平衡期检查):
+ *
+ *   心跳    控制拍末尾 supervisorBeat() 写入的时间戳超过 SUP_HEARTBEAT_MS 未更新
+ *   反馈    任一电机 0x02 反馈帧计数超过 SUP_FEEDBACK_MS 未增长 (仅心跳新鲜时判定)
+ *   过流    实测电流 > SUP_OVERCURRENT_MA 持续 SUP_OVERCURRENT_MS
+ *   过角    |pitch| > SUP_ANGLE_DEG 持续 SUP_ANGLE_MS
+ *
+ * 触发后调用 motorsEmergencyOff(): 锁定 can_motor 的指令出口 (之后所有指令按 0 发送),
+ * 清空 TWAI 发送队列, 再发零电流与 CMD_OFF。锁存到 Stand (supervisorClear) 为止;
+ * 控制环下一拍看到 supervisorTripped() 后按跌倒处理。
+ *
+ * 任务只读控制环写的 32 位标量与计数器, 不接收 CAN 帧, 不发网络消息 (由 supervisorPump 上报)。
+ *
+ * 整机挂死 (两核都停) 或崩溃时本任务也失效。RollerCAN 没有通信超时寄存器, 电机会保持
+ * 最后的电流指令, 因此用 ESP32 任务看门狗模拟电机侧超时: loop 与本任务都订阅 TWDT,
+ * 超过 SUP_WDT_TIMEOUT_MS 未喂狗即 panic 复位; 复位后 canInit() 第一件事就是 CMD_OFF +
+ * 设定点清零。崩溃到断力矩的上界 = 看门狗超时 (崩溃则为 0) + 启动到 canInit 的时间,
+ * 见 tools/stall_sim.py。
+ */
+
+#include "supervisor.h"
+#include "can_motor.h"
+#include "config.h"
+#include "globals.h"
+#include "web_control.h"
+#include <esp_system.h>
+#include <esp_task_wdt.h>
+
+static volatile uint32_t beatUs  = 0;
+static volatile bool     armed   = false;
+static volatile bool     tripped = false;
+
+// 触发记录 (监督任务写, 在 trips 计数 release 之前写完)
+static SupReason         tripReason = SUP_NONE;
+static float             tripValue  = 0;
+static volatile uint32_t trips      = 0;
+static uint32_t          reported   = 0;
+static uint32_t          maxGapUs   = 0;   // 平衡期观测到的最大心跳间隔
+static const char       *bootReason = "";
+
+static const char *const REASON_NAMES[SUP_REASON_N] = {
+    "NONE", "HEARTBEAT", "FEEDBACK_R", "FEEDBACK_L", "OVERCURRENT", "OVERANGLE",
+};
+
+static const float REASON_LIMITS[SUP_REASON_N] = {
+    0, SUP_HEARTBEAT_MS, SUP_FEEDBACK_MS, SUP_FEEDBACK_MS, SUP_OVERCURRENT_MA, SUP_ANGLE_DEG,
+};
+
+const char *supervisorReasonName(SupReason r) {
+    return r < SUP_REASON_N ? REASON_NAMES[r] : "?";
+}
+
+SupReason supervisorLastReason() {
+    return tripReason;
+}
+
+void supervisorBeat(bool on) {
+    beatUs = micros();
+    armed  = on;
+}
+
+bool supervisorTripped() {
+    return __atomic_load_n(&tripped, __ATOMIC_ACQUIRE);
+}
+
+static void trip(SupReason reason, float value) {
+    motorsEmergencyOff();
+    tripReason = reason;
+    tripValue  = value;
+    __atomic_store_n(&tripped, true, __ATOMIC_RELEASE);
+    __atomic_store_n(&trips, trips + 1, __ATOMIC_RELEASE);
+}
+
+// 条件连续成立 dwellMs 才返回 true; *sinceMs = 0 表示当前不成立
+static bool held(bool cond, uint32_t nowMs, uint32_t *sinceMs, uint32_t dwellMs) {
+    if (!cond) {
+        *sinceMs = 0;
+        return false;
+    }
+    if (*sinceMs == 0) *sinceMs = nowMs ? nowMs : 1;
+    return nowMs - *sinceMs >= dwellMs;
+}
+
+// ============ 监督任务 ============
+static void supervisorTask(void *) {
+    bool     wasArmed = false;
+    uint32_t framesR = 0, framesL = 0;
+    uint32_t freshMsR = 0, freshMsL = 0;
+    uint32_t overCurMs = 0, overAngleMs = 0;
+
+    esp_task_wdt_add(nullptr);
+
+    TickType_t wake = xTaskGetTickCount();
+    for (;;) {
+        vTaskDelayUntil(&wake, pdMS_TO_TICKS(SUP_PERIOD_MS));
+        esp_task_wdt_reset();
+
+        if (supervisorTripped() || !armed) {
+            wasArmed = false;
+            continue;
+        }
+
+        const uint32_t nowMs = millis();
+        const uint32_t fr = motorFeedbackFrames(MOTOR_R);
+        const uint32_t fl = motorFeedbackFrames(MOTOR_L);
+        if (!wasArmed) {
+            // 刚进入平衡: 计时从此刻开始
+            wasArmed = true;
+            framesR = fr;
+            framesL = fl;
+            freshMsR = freshMsL = nowMs;
+            overCurMs = overAngleMs = 0;
+        }
+
+        // ---- 心跳 ----
+        const uint32_t gapUs = micros() - beatUs;
+        if (gapUs > maxGapUs) maxGapUs = gapUs;
+        if (gapUs > SUP_HEARTBEAT_MS * 1000UL) {
+            trip(SUP_HEARTBEAT, gapUs / 1000.0f);
+            continue;
+        }
+
+        // ---- 反馈新鲜度 ----
+        // 反馈帧由 loop 解析: 心跳已滞后时计数停止增长是 loop 卡顿, 交给心跳判定
+        const bool beatFresh = gapUs <= SUP_BEAT_FRESH_MS * 1000UL;
+        if (fr != framesR) {
+            framesR = fr;
+            freshMsR = nowMs;
+        } else if (beatFresh && nowMs - freshMsR > SUP_FEEDBACK_MS) {
+            trip(SUP_FEEDBACK_R, (float)(nowMs - freshMsR));
+            continue;
+        }
+        if (fl != framesL) {
+            framesL = fl;
+            freshMsL = nowMs;
+        } else if (beatFresh && nowMs - freshMsL > SUP_FEEDBACK_MS) {
+            trip(SUP_FEEDBACK_L, (float)(nowMs - freshMsL));
+            continue;
+        }
+
+        // ---- 过流 / 过角 ----
+        const float cur = max(fabsf(actualCurrentR), fabsf(actualCurrentL));
+        if (held(cur > SUP_OVERCURRENT_MA, nowMs, &overCurMs, SUP_OVERCURRENT_MS)) {
+            trip(SUP_OVERCURRENT, cur);
+            continue;
+        }
+        const float pitch = fabsf(currentPitch + PITCH_MOUNT_OFFSET);
+        if (held(pitch > SUP_ANGLE_DEG, nowMs, &overAngleMs, SUP_ANGLE_MS)) {
+            trip(SUP_OVERANGLE, pitch);
+            continue;
+        }
+    }
+}
+
+// ============ 任务看门狗 (模拟电机侧通信超时) ============
+static const char *resetReasonName(esp_reset_reason_t r) {
+    switch (r) {
+    case ESP_RST_POWERON:  return "POWERON";
+    case ESP_RST_SW:       return "SW";
+    case ESP_RST_PANIC:    return "PANIC";
+    case ESP_RST_INT_WDT:  return "INT_WDT";
+    case ESP_RST_TASK_WDT: return "TASK_WDT";
+    case ESP_RST_WDT:      return "WDT";
+    case ESP_RST_BROWNOUT: return "BROWNOUT";
+    default:               return "OTHER";
+    }
+}
+
+static void watchdogStart() {
+#if ESP_ARDUINO_VERSION_MAJOR >= 3
+    // 保持核 0 idle 任务的监视 (Arduino 默认配置)
+    esp_task_wdt_config_t cfg = {SUP_WDT_TIMEOUT_MS, 1 << 0, true};
+    if (esp_task_wdt_reconfigure(&cfg) != ESP_OK) esp_task_wdt_init(&cfg);
+#else
+    // IDF 4.x 以秒为单位, 重复调用即重新配置
+    esp_task_wdt_init((SUP_WDT_TIMEOUT_MS + 999) / 1000, true);
+#endif
+    esp_task_wdt_add(nullptr);   // 调用者 = loopTask (setup 与 loop 同一任务)
+}
+
+void supervisorInit() {
+    esp_reset_reason_t rr = esp_reset_reason();
+    bootReason = resetReasonName(rr);
+    Serial.printf("[SUP] reset reason %s, motors off at %lums\n", bootReason,
+                  (unsigned long)motorsBootOffMs());
+
+    watchdogStart();
+    xTaskCreatePinnedToCore(supervisorTask, "supervisor", SUP_TASK_STACK, nullptr,
+                            SUP_TASK_PRIO, nullptr, SUP_TASK_CORE);
+}
+
+void supervisorFeed() {
+    esp_task_wdt_reset();
+}
+
+const char *supervisorBootReason() {
+    return bootReason;
+}
+
+void supervisorClear() {
+    if (!supervisorTripped()) return;
+    // 先停止监视 (防止解锁瞬间按旧计时再次触发), 再重新使能电机
+    armed = false;
+    motorsUnlockOutput();
+    __atomic_store_n(&tripped, false, __ATOMIC_RELEASE);
+    webBroadcastText("SV,CLR");
+    Serial.println("[SUP] cleared, motors re-enabled");
+}
+
+void supervisorPump() {
+    const uint32_t n = __atomic_load_n(&trips, __ATOMIC_ACQUIRE);
+    if (n == reported) return;
+    reported = n;
+
+    // SV,TRIP,reason,value,limit,trips,maxGapUs
+    char msg[80];
+    snprintf(msg, sizeof(msg), "SV,TRIP,%s,%.1f,%.1f,%lu,%lu", supervisorReasonName(tripReason),
+             tripValue, REASON_LIMITS[tripReason], (unsigned long)n, (unsigned long)maxGapUs);
+    webBroadcastText(msg);
+    Serial.printf("[SUP] %s\n", msg);
+}
@@ -0,0 +1,41 @@
+#pragma once
+/**
+ * supervisor.h — 安全监督: 核 0 独立任务监视控制拍心跳 / 反馈新鲜度 / 过流 / 过角,
+ *                超限时经 CAN 保留路径强制零电流 + CMD_OFF 并锁存, Stand 解锁
+ */
+
+#include <Arduino.h>
+
+enum SupReason : uint8_t {
+    SUP_NONE,
+    SUP_HEARTBEAT,     // 控制拍停顿 (值: 间隔 ms)
+    SUP_FEEDBACK_R,    // 右电机反馈帧超时 (值: ms)
+    SUP_FEEDBACK_L,    // 左电机反馈帧超时
+    SUP_OVERCURRENT,   // 实测电流超限 (值: mA)
+    SUP_OVERANGLE,     // 倾角超限 (值: °)
+    SUP_REASON_N
+};
+
+// 创建监督任务并启动任务看门狗 (setup 末尾调用: 此后 loop 须每轮 supervisorFeed)
+void supervisorInit();
+
+// loop 每轮喂狗; 超过 SUP_WDT_TIMEOUT_MS 未喂则 panic 复位, 复位后 canInit 立即断电机输出
+void supervisorFeed();
+
+// 本次启动的复位原因 (POWERON / PANIC / TASK_WDT ...)
+const char *supervisorBootReason();
+
+// 每个控制拍末尾调用; armed = 本拍由闭环驱动电机 (平衡中)
+void supervisorBeat(bool armed);
+
+// 已触发并锁存 (电机输出已切断)
+bool supervisorTripped();
+
+// 解除锁存并重新 CMD_ON (loop 中调用, 阻塞约 60ms; 仅在 Stand 时)
+void supervisorClear();
+
+// loop 中调用: 上报触发事件 (SV,TRIP,...)
+void supervisorPump();
+
+const char *supervisorReasonName(SupReason r);
+SupReason supervisorLastReason();
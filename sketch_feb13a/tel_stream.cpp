@@ -0,0 +1,69 @@
+/**
+ * tel_stream.cpp — 逐拍遥测流
+ *
+ * 写者 telStreamTick 在控制核; 遥测分发 (同核 loop) 直接读环, 显示任务 (核 0) 经
+ * telStreamRead 复制后重读 head 校验, 与 run_log 相同的无锁方式。
+ * 每条 24 字节, 500Hz 下 20ms 一帧约 250 字节; 环长 TEL_STREAM_RING 条留出 WiFi 卡顿余量。
+ */
+
+#include "tel_stream.h"
+#include "config.h"
+#include "globals.h"
+
+static const int FRAME_HDR = 8;
+
+static TelStreamSample ring[TEL_STREAM_RING];
+static volatile uint32_t head = 0;   // 已写入总条数 (release 发布)
+
+static inline int16_t sat16(float v) {
+  return (int16_t)constrain(v, -32767.0f, 32767.0f);
+}
+
+void telStreamTick() {
+  TelStreamSample &s = ring[head % TEL_STREAM_RING];
+  s.pitch100  = sat16((currentPitch + PITCH_MOUNT_OFFSET) * 100.0f);
+  s.target100 = sat16(targetAngleFilt * 100.0f);
+  s.roll100   = sat16(currentRoll * 100.0f);
+  s.gyro10    = sat16(gyroRate * 10.0f);
+  s.pid10     = sat16(pidOutput * 10.0f);
+  s.speedMMs  = sat16(linearSpeed);
+  s.cmdR      = (int16_t)cmdSpdR;
+  s.cmdL      = (int16_t)cmdSpdL;
+  s.actR      = (int16_t)actualSpdR;
+  s.actL      = (int16_t)actualSpdL;
+  s.curR      = sat16(actualCurrentR);
+  s.curL      = sat16(actualCurrentL);
+  __atomic_store_n(&head, head + 1, __ATOMIC_RELEASE);
+}
+
+uint32_t telStreamHead() {
+  return __atomic_load_n(&head, __ATOMIC_ACQUIRE);
+}
+
+uint32_t telStreamRead(uint32_t seq, TelStreamSample *out, uint32_t n) {
+  uint32_t h = __atomic_load_n(&head, __ATOMIC_ACQUIRE);
+  if (h - seq >= (uint32_t)TEL_STREAM_RING) return 0;   // 最旧一格可能正被改写
+  n = min(n, h - seq);
+  for (uint32_t i = 0; i < n; i++) out[i] = ring[(seq + i) % TEL_STREAM_RING];
+  h = __atomic_load_n(&head, __ATOMIC_ACQUIRE);
+  return (h - seq >= (uint32_t)TEL_STREAM_RING) ? 0 : n;
+}
+
+size_t telStreamBuild(uint32_t *cursor, uint8_t *buf, size_t size) {
+  if (head - *cursor > (uint32_t)TEL_STREAM_RING) *cursor = head - TEL_STREAM_RING;
+  uint32_t avail = head - *cursor;
+  uint32_t room = size > FRAME_HDR ? (size - FRAME_HDR) / sizeof(TelStreamSample) : 0;
+  uint16_t n = (uint16_t)min(avail, min(room, (uint32_t)TEL_STREAM_FRAME_MAX));
+  if (n == 0) return 0;
+
+  buf[0] = 'K';
+  buf[1] = 1;
+  memcpy(buf + 2, &n, 2);
+  memcpy(buf + 4, cursor, 4);
+  for (uint16_t i = 0; i < n; i++) {
+    memcpy(buf + FRAME_HDR + i * sizeof(TelStreamSample),
+           &ring[(*cursor + i) % TEL_STREAM_RING], sizeof(TelStreamSample));
+  }
+  *cursor += n;
+  return FRAME_HDR + n * sizeof(TelStreamSample);
+}
@@ -0,0 +1,32 @@
+#pragma once
+/**
+ * tel_stream.h — 逐拍遥测流: 控制核每拍写一条紧凑采样, 遥测分发按客户端游标打包为二进制 K 帧
+ *
+ * K 帧: [0]='K' [1]=版本 [2..3]=条数 [4..7]=首条序号 [8..]=采样 (小端 int16 × 12)
+ * 序号连续即无丢样; 客户端落后超过环长时游标跳到最旧可用处, 缺口由序号体现。
+ */
+
+#include <Arduino.h>
+
+struct __attribute__((packed)) TelStreamSample {
+  int16_t pitch100, target100, roll100;   // ° ×100
+  int16_t gyro10;                         // °/s ×10
+  int16_t pid10;                          // PID 输出 ×10
+  int16_t speedMMs;                       // 线速度 mm/s
+  int16_t cmdR, cmdL;                     // 指令 RPM
+  int16_t actR, actL;                     // 实际 RPM
+  int16_t curR, curL;                     // 电流 mA
+};
+
+// 每个控制拍调用 (balanceControl 之后)
+void telStreamTick();
+
+// 当前写位置 (新订阅从此处开始, 不回放旧采样)
+uint32_t telStreamHead();
+
+// 其他核读取 (显示任务): 从序号 seq 起复制最多 n 条, 返回条数;
+// 复制期间该段被覆盖 (读者落后超过环长) 返回 0, 调用方应从 telStreamHead() 重新同步
+uint32_t telStreamRead(uint32_t seq, TelStreamSample *out, uint32_t n);
+
+// 从 *cursor 起打包最多 TEL_STREAM_FRAME_MAX 条到 buf, 推进游标; 无新采样返回 0
+size_t telStreamBuild(uint32_t *cursor, uint8_t *buf, size_t size);
@@ -0,0 +1,212 @@
+/**
+ * telemetry_hub.cpp — 多客户端遥测分发
+ *
+ * 每轮 pump 对每个通道找出"到期"的客户端, 有则把消息编码一次到共享缓冲区再逐个发送,
+ * 因此同周期的客户端共享一次编码。
+ * 例外是逐拍采样流 K: 每客户端保存自己的序号游标, 到期时打包游标之后的全部新采样,
+ * 周期不同的客户端都能收到连续序列。
+ *
+ * 发送回调只把消息放入网络任务的出站队列, 实际 TCP 写在核 0 (web_control)。
+ * 流控:
+ *   - 信用窗口: 所有发往客户端的帧 (含事件消息) 都经本模块计数, 客户端定期回
+ *     ACK,累计收到帧数, 未确认帧数 (队列深度) ≥ TEL_CLIENT_WINDOW 时遥测帧对该客户端丢弃;
+ *   - 慢发送退避: 网络任务实测单次发送超过 TEL_SLOW_SEND_US 的客户端跳过随后 TEL_SLOW_BACKOFF 帧;
+ *   - 出站队列满时入队失败, 计为丢帧。
+ * 不回 ACK 的客户端 (脚本工具等) 只受退避约束。
+ */
+
+#include "telemetry_hub.h"
+#include "can_latency.h"
+#include "config.h"
+#include "tel_stream.h"
+#include "web_control.h"
+#include "web_protocol.h"
+
+struct ChannelDef {
+  const char *name;
+  uint16_t    defaultMs;   // 连接时默认订阅周期, 0 = 默认不订阅
+  void (*build)(char *msg, size_t size);
+  bool (*active)();        // 为空 = 总是可发
+  size_t (*stream)(uint32_t *cursor, uint8_t *buf, size_t size);   // 非空 = 按客户端游标的二进制流
+};
+
+static const ChannelDef CHANNELS[TEL_CHANNEL_N] = {
+  {"A",  20,   buildWebAngleMessage,     nullptr},
+  {"T",  20,   buildWebTelemetryMessage, nullptr},
+  {"M",  500,  buildWebMotorMessage,     nullptr},
+  {"PW", 500,  buildWebPowerMessage,     nullptr},
+  {"TH", 500,  buildWebThermalMessage,   nullptr},
+  {"DL", 500,  buildWebDeadlineMessage,  nullptr},
+  {"JS", 500,  buildWebJoystickMessage,  nullptr},
+  {"PF", PROFILER_ENABLE ? PROFILER_REPORT_MS : 0, buildWebProfileMessage, nullptr},
+  {"LT", 500,  buildWebLatencyMessage,   latencyProbeEnabled},
+  {"TS", 1000, buildWebHubMessage,       nullptr},
+  {"K",  0,    nullptr,                  nullptr, telStreamBuild},
+};
+
+struct Client {
+  bool     connected;
+  bool     ackMode;
+  uint16_t periodMs[TEL_CHANNEL_N];
+  uint32_t dueMs[TEL_CHANNEL_N];
+  uint32_t sent;
+  uint32_t acked;
+  uint32_t dropped;
+  uint32_t slowSends;
+  uint32_t maxSendUs;
+  uint8_t  backoff;
+  uint32_t streamSeq;     // K 流游标
+};
+
+static TelSendFn sendFn = nullptr;
+static TelCostFn costFn = nullptr;
+static Client    clients[TEL_MAX_CLIENTS];
+static uint32_t  encodes = 0;
+static char      shared[768];
+static uint8_t   streamBuf[NET_MSG_MAX];
+
+void telemetryHubInit(TelSendFn send, TelCostFn cost) {
+  sendFn = send;
+  costFn = cost;
+  memset(clients, 0, sizeof(clients));
+}
+
+void telemetryHubConnect(uint8_t client) {
+  if (client >= TEL_MAX_CLIENTS) return;
+  Client &c = clients[client];
+  memset(&c, 0, sizeof(c));
+  c.connected = true;
+  uint32_t now = millis();
+  for (int ch = 0; ch < TEL_CHANNEL_N; ch++) {
+    c.periodMs[ch] = CHANNELS[ch].defaultMs;
+    c.dueMs[ch] = now;
+  }
+}
+
+void telemetryHubDisconnect(uint8_t client) {
+  if (client >= TEL_MAX_CLIENTS) return;
+  clients[client].connected = false;
+}
+
+bool telemetryHubSubscribe(uint8_t client, const char *channel, uint32_t periodMs) {
+  if (client >= TEL_MAX_CLIENTS || !clients[client].connected) return false;
+  if (periodMs != 0 && periodMs < TEL_MIN_PERIOD_MS) periodMs = TEL_MIN_PERIOD_MS;
+  if (periodMs > 60000) return false;
+
+  Client &c = clients[client];
+  bool all = strcmp(channel, "ALL") == 0;
+  bool found = false;
+  for (int ch = 0; ch < TEL_CHANNEL_N; ch++) {
+    if (!all && strcmp(channel, CHANNELS[ch].name) != 0) continue;
+    c.periodMs[ch] = (uint16_t)periodMs;
+    c.dueMs[ch] = millis();
+    if (CHANNELS[ch].stream) c.streamSeq = telStreamHead();
+    found = true;
+  }
+  return found;
+}
+
+void telemetryHubAck(uint8_t client, uint32_t count) {
+  if (client >= TEL_MAX_CLIENTS) return;
+  Client &c = clients[client];
+  c.ackMode = true;
+  // 不接受超前于已发送的确认 (客户端计数含非遥测消息时钳位)
+  c.acked = (int32_t)(count - c.sent) > 0 ? c.sent : count;
+}
+
+void telemetryHubSendTo(uint8_t client, const char *msg) {
+  if (!sendFn || client >= TEL_MAX_CLIENTS) return;
+  if (sendFn(client, (const uint8_t *)msg, strlen(msg), false)) clients[client].sent++;
+}
+
+void telemetryHubBroadcast(const uint8_t *data, size_t len, bool binary) {
+  if (!sendFn) return;
+  for (uint8_t i = 0; i < TEL_MAX_CLIENTS; i++) {
+    if (!clients[i].connected) continue;
+    if (sendFn(i, data, len, binary)) clients[i].sent++;
+  }
+}
+
+void telemetryHubKick(TelChannel ch) {
+  uint32_t now = millis();
+  for (int i = 0; i < TEL_MAX_CLIENTS; i++) {
+    clients[i].dueMs[ch] = now;
+  }
+}
+
+// 返回帧是否已进入发送队列
+static bool deliver(uint8_t id, Client &c, const uint8_t *data, size_t len, bool binary) {
+  if (c.ackMode && (c.sent - c.acked) >= TEL_CLIENT_WINDOW) {
+    c.dropped++;
+    return false;
+  }
+  if (c.backoff) {
+    c.backoff--;
+    c.dropped++;
+    return false;
+  }
+  bool ok = sendFn(id, data, len, binary);
+  uint32_t us = costFn ? costFn(id) : 0;
+  if (us > c.maxSendUs) c.maxSendUs = us;
+  if (!ok) {
+    c.dropped++;
+    return false;
+  }
+  c.sent++;
+  if (us > TEL_SLOW_SEND_US) {
+    c.slowSends++;
+    c.backoff = TEL_SLOW_BACKOFF;
+  }
+  return true;
+}
+
+void telemetryHubPump() {
+  if (!sendFn) return;
+  uint32_t now = millis();
+
+  for (int ch = 0; ch < TEL_CHANNEL_N; ch++) {
+    const ChannelDef &def = CHANNELS[ch];
+    if (def.active && !def.active()) continue;
+
+    size_t len = 0;
+    for (uint8_t i = 0; i < TEL_MAX_CLIENTS; i++) {
+      Client &c = clients[i];
+      uint16_t p = c.periodMs[ch];
+      if (!c.connected || p == 0 || (int32_t)(now - c.dueMs[ch]) < 0) continue;
+      // 按周期对齐推进; 落后超过一个周期时重新同步, 不补发
+      c.dueMs[ch] += p;
+      if ((int32_t)(now - c.dueMs[ch]) >= 0) c.dueMs[ch] = now + p;
+
+      if (def.stream) {
+        // 游标只在帧入队后提交; 丢帧时下个周期从原位置重发 (落后超过环长由 stream 截到最旧)
+        uint32_t cursor = c.streamSeq;
+        size_t n = def.stream(&cursor, streamBuf, sizeof(streamBuf));
+        if (n && deliver(i, c, streamBuf, n, true)) c.streamSeq = cursor;
+        continue;
+      }
+      if (len == 0) {
+        def.build(shared, sizeof(shared));
+        len = strlen(shared);
+        encodes++;
+      }
+      deliver(i, c, (const uint8_t *)shared, len, false);
+    }
+  }
+}
+
+void buildWebHubMessage(char *msg, size_t size) {
+  // TS,encodes,outUsed,outHigh,queueDrops,{client,ack,queue,sent,dropped,slow,maxSendUs}...
+  uint32_t outUsed, outHigh, drops;
+  webQueueStats(&outUsed, &outHigh, &drops);
+  int n = snprintf(msg, size, "TS,%lu,%lu,%lu,%lu", (unsigned long)encodes,
+                   (unsigned long)outUsed, (unsigned long)outHigh, (unsigned long)drops);
+  for (int i = 0; i < TEL_MAX_CLIENTS; i++) {
+    const Client &c = clients[i];
+    if (!c.connected) continue;
+    if (n < 0 || (size_t)n >= size) return;
+    n += snprintf(msg + n, size - n, ",%d,%d,%lu,%lu,%lu,%lu,%lu", i, c.ackMode ? 1 : 0,
+                  (unsigned long)(c.sent - c.acked), (unsigned long)c.sent,
+                  (unsigned long)c.dropped, (unsigned long)c.slowSends,
+                  (unsigned long)c.maxSendUs);
+  }
+}
@@ -0,0 +1,52 @@
+#pragma once
+/**
+ * telemetry_hub.h — 多客户端遥测分发: 每客户端按通道订阅周期, 每通道每轮只编码一次,
+ *                    慢客户端丢帧而不阻塞发送路径
+ */
+
+#include <Arduino.h>
+
+enum TelChannel : uint8_t {
+  TEL_ANGLE,     // A   姿态
+  TEL_TELEM,     // T   控制环遥测
+  TEL_MOTOR,     // M   电机状态
+  TEL_POWER,     // PW  电源
+  TEL_THERMAL,   // TH  热模型
+  TEL_DEADLINE,  // DL  控制拍超时统计
+  TEL_JOYSTICK,  // JS  摇杆通道统计
+  TEL_PROFILE,   // PF  分段耗时
+  TEL_LATENCY,   // LT  CAN 时延探针 (仅探针开启时)
+  TEL_HUB,       // TS  本模块的每客户端统计
+  TEL_STREAM,    // K   逐拍采样流 (二进制, 默认不订阅)
+  TEL_CHANNEL_N
+};
+
+// 发送回调: 返回 false 表示发送失败 (出站队列满)
+typedef bool (*TelSendFn)(uint8_t client, const uint8_t *data, size_t len, bool binary);
+// 发送耗时回调: 返回该客户端自上次查询以来网络任务实测的最长发送耗时 (µs)
+typedef uint32_t (*TelCostFn)(uint8_t client);
+
+void telemetryHubInit(TelSendFn send, TelCostFn cost);
+
+// 连接时装入默认订阅 (等同旧的固定广播); 断开时清除
+void telemetryHubConnect(uint8_t client);
+void telemetryHubDisconnect(uint8_t client);
+
+// 订阅: 通道名 (A/T/M/PW/TH/DL/JS/PF/LT/TS/K 或 ALL), periodMs=0 退订; 返回是否有效
+// K 为逐客户端游标的连续采样流, 周期只决定打包间隔
+bool telemetryHubSubscribe(uint8_t client, const char *channel, uint32_t periodMs);
+
+// 事件/配置消息: 不受订阅与流控约束, 但计入每客户端已发送帧数
+void telemetryHubSendTo(uint8_t client, const char *msg);
+void telemetryHubBroadcast(const uint8_t *data, size_t len, bool binary);
+
+// 客户端确认已收到 count 帧 (连接以来累计, 含事件消息); 首次 ACK 后启用信用窗口
+void telemetryHubAck(uint8_t client, uint32_t count);
+
+// 下一轮立即发送该通道 (如电源告警升级)
+void telemetryHubKick(TelChannel ch);
+
+// 主循环中调用
+void telemetryHubPump();
+
+void buildWebHubMessage(char *msg, size_t size);
@@ -0,0 +1,91 @@
+/**
+ * thermal_model.cpp — 电机热模型
+ *
+ * 绕组:  dT/dt = k·I² − (T − Tamb)/τ,  k = THERMAL_RISE_AT_CONT / (τ·Icont²),
+ *        即连续额定电流下稳态温升为 THERMAL_RISE_AT_CONT。
+ * 短时:  E += (I² − Icont²)·dt (E ≥ 0), 预算 Emax = (Ipk² − Icont²)·THERMAL_PEAK_S;
+ *        预算用尽前允许 Ipk, 最后 20% 线性过渡到 Icont。
+ * 温度:  绕组温度进入 THERMAL_TAPER_DEG 区间后, 上限线性收紧到稳态可承受电流
+ *        sqrt((Tmax − Tamb)/(k·τ)), 不低于 THERMAL_MIN_LIMIT_MA。
+ * 校正:  REG_TEMP 是驱动芯片温度, 只在非平衡期可读; 读数时电流接近 0,
+ *        绕组已向外壳温度回落, 故读数同时校正绕组温度与环境温度。
+ */
+
+#include "thermal_model.h"
+#include "config.h"
+#include "globals.h"
+
+static const float I_CONT = MOTOR_CONT_CURRENT_MA / 1000.0f;
+static const float I_PEAK = MOTOR_PEAK_CURRENT_MA / 1000.0f;
+static const float K_HEAT = THERMAL_RISE_AT_CONT / (THERMAL_TAU_S * I_CONT * I_CONT);
+static const float E_MAX  = (I_PEAK * I_PEAK - I_CONT * I_CONT) * THERMAL_PEAK_S;
+
+static ThermalState th[2] = {
+    {THERMAL_AMBIENT_DEG, THERMAL_AMBIENT_DEG, 0, MOTOR_PEAK_CURRENT_MA, 0, 0},
+    {THERMAL_AMBIENT_DEG, THERMAL_AMBIENT_DEG, 0, MOTOR_PEAK_CURRENT_MA, 0, 0},
+};
+static float i2tEnergy[2] = {0, 0};
+static bool  calibrated[2] = {false, false};
+
+static void stepMotor(int m, float currentMa, float dt) {
+    ThermalState &s = th[m];
+    float i = currentMa / 1000.0f;
+    float i2 = i * i;
+
+    // ---- 一阶绕组温升 ----
+    s.windingDeg += dt * (K_HEAT * i2 - (s.windingDeg - s.ambientDeg) / THERMAL_TAU_S);
+
+    // ---- 短时 I²t 预算 ----
+    i2tEnergy[m] = constrain(i2tEnergy[m] + (i2 - I_CONT * I_CONT) * dt, 0.0f, E_MAX);
+    s.i2tUsed = i2tEnergy[m] / E_MAX;
+
+    float headroom = constrain((1.0f - s.i2tUsed) / 0.2f, 0.0f, 1.0f);
+    float limit = MOTOR_CONT_CURRENT_MA + (MOTOR_PEAK_CURRENT_MA - MOTOR_CONT_CURRENT_MA) * headroom;
+
+    // ---- 绕组温度接近上限: 收紧到稳态可承受电流 ----
+    float taper = (THERMAL_MAX_DEG - s.windingDeg) / THERMAL_TAPER_DEG;
+    if (taper < 1.0f) {
+        float rise = max(THERMAL_MAX_DEG - s.ambientDeg, 0.0f);
+        float iSteady = sqrtf(rise / (K_HEAT * THERMAL_TAU_S)) * 1000.0f;
+        float t = constrain(taper, 0.0f, 1.0f);
+        limit = min(limit, iSteady + (limit - iSteady) * t);
+    }
+    s.limitMa = (int)constrain(limit, (float)THERMAL_MIN_LIMIT_MA, (float)MOTOR_PEAK_CURRENT_MA);
+}
+
+void thermalUpdate(float dt) {
+    stepMotor(THERMAL_R, actualCurrentR, dt);
+    stepMotor(THERMAL_L, actualCurrentL, dt);
+}
+
+void thermalCalibrate(int motor, float chipDeg) {
+    if (motor != THERMAL_R && motor != THERMAL_L) return;
+    // 曾出现 720914°C 之类的错帧读数, 超出物理范围直接丢弃
+    if (chipDeg < -20.0f || chipDeg > 150.0f) return;
+
+    ThermalState &s = th[motor];
+    s.lastCalDeg = chipDeg;
+    if (!calibrated[motor]) {
+        s.windingDeg = chipDeg;
+        s.ambientDeg = chipDeg;
+        calibrated[motor] = true;
+        s.calErrDeg = 0;
+        return;
+    }
+    s.calErrDeg = chipDeg - s.windingDeg;
+    // 绕组不会比芯片更凉: 只向上快速校正, 向下按增益校正
+    if (chipDeg > s.windingDeg) {
+        s.windingDeg = chipDeg;
+    } else {
+        s.windingDeg += THERMAL_CAL_GAIN * s.calErrDeg;
+    }
+    s.ambientDeg += THERMAL_CAL_GAIN * (chipDeg - s.ambientDeg);
+}
+
+int thermalLimitMa(int motor) {
+    return th[motor & 1].limitMa;
+}
+
+const ThermalState &thermalState(int motor) {
+    return th[motor & 1];
+}
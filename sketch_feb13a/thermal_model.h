@@ -0,0 +1,29 @@
+#pragma once
+/**
+ * thermal_model.h — RollerCAN 电机热模型: I²t 短时额定 + 一阶绕组温升, 输出每电机电流上限
+ */
+
+#include <Arduino.h>
+
+#define THERMAL_R 0
+#define THERMAL_L 1
+
+struct ThermalState {
+    float windingDeg;   // 预测绕组温度 (°C)
+    float ambientDeg;   // 环境/外壳温度估计 (°C, 由 REG_TEMP 校正)
+    float i2tUsed;      // 短时 I²t 预算占用 (0..1)
+    int   limitMa;      // 当前允许电流 (mA)
+    float lastCalDeg;   // 最近一次 REG_TEMP 读数 (°C)
+    float calErrDeg;    // 最近一次校正前模型误差 (°C)
+};
+
+// 每个控制周期调用: 用 0x02 反馈电流推进模型
+void thermalUpdate(float dt);
+
+// REG_TEMP 读数校正 (异常读数被丢弃)
+void thermalCalibrate(int motor, float chipDeg);
+
+// 当前允许电流 (mA, 正值)
+int thermalLimitMa(int motor);
+
+const ThermalState &thermalState(int motor);
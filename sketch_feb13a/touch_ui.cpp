@@ -0,0 +1,407 @@
+/**
+ * touch_ui.cpp — 触屏菜单
+ *
+ * 数据流:
+ *   loop (核 1)  M5.update() → touchUiPoll(): 按下/按住 → touchQueue (满则丢弃, 不等待)
+ *   显示任务 (核 0) 阻塞在 touchQueue 上, 有事件立即处理并重绘, 菜单响应不受控制环追赶影响
+ *   菜单动作 → cmdQueue (文本命令) → loop 中 touchUiCommands() 经 handleWebCommand 执行,
+ *   回复经 uiReply/uiReplySeq 交给菜单做提示。控制核只做入队/出队, 不做任何 UI 工作。
+ *
+ * 画面: 主视图 (显示模块) / 菜单 3×3 / 参数列表 / 参数编辑 / 诊断。
+ * 主视图下保持原有手势: 顶栏 = 打开菜单, 左 = Kp-1, 右 = Kp+1, 中 = 站立 (自动调参时屏蔽);
+ * 曲线模式下点任意处打开菜单。菜单内点顶栏返回上一级。
+ */
+
+#include "touch_ui.h"
+#include "auto_tune.h"
+#include "config.h"
+#include "deadline_monitor.h"
+#include "display.h"
+#include "globals.h"
+#include "motor_charact.h"
+#include "param_registry.h"
+#include "power_mgmt.h"
+#include "supervisor.h"
+#include "web_control.h"
+#include "web_protocol.h"
+
+static const uint8_t UI_CLIENT  = 0xFD;   // handleWebCommand 的发送方标识 (不回 WebSocket)
+static const int     HEADER_H   = 24;
+static const int     CMD_LEN    = 48;
+static const uint32_t TOAST_MS  = 2000;
+
+struct UiCmd {
+    char text[CMD_LEN];
+};
+
+enum UiScreen : uint8_t { SCR_NONE, SCR_MENU, SCR_PARAMS, SCR_EDIT, SCR_DIAG };
+
+static QueueHandle_t touchQueue = nullptr;
+static QueueHandle_t cmdQueue   = nullptr;
+
+// ---- 控制核写, 显示任务读 ----
+static char              uiReply[64];
+static volatile uint32_t uiReplySeq = 0;
+
+// ---- 显示任务私有 ----
+static UiScreen screen = SCR_NONE;
+static int      editIdx = 0;
+static float    editVal = 0;
+static int      editBtn = -1;     // 按住中的 +/- 按钮
+static char     toast[64];
+static uint32_t toastMs = 0;
+static uint32_t shownReplySeq = 0;
+
+void touchUiInit() {
+    touchQueue = xQueueCreate(TOUCH_QUEUE_LEN, sizeof(TouchEvent));
+    cmdQueue   = xQueueCreate(UI_CMD_QUEUE_LEN, sizeof(UiCmd));
+}
+
+// ============ 控制核 ============
+void touchUiPoll() {
+    static uint32_t lastHoldMs = 0;
+    auto tc = M5.Touch.getDetail();
+    uint32_t now = millis();
+    TouchEvent ev;
+    if (tc.wasPressed()) {
+        ev.type = TOUCH_PRESS;
+        lastHoldMs = now;
+    } else if (tc.isHolding() && now - lastHoldMs >= TOUCH_REPEAT_MS) {
+        ev.type = TOUCH_HOLD;
+        lastHoldMs = now;
+    } else {
+        return;
+    }
+    ev.x  = tc.x;
+    ev.y  = tc.y;
+    ev.ms = now;
+    if (touchQueue) xQueueSend(touchQueue, &ev, 0);
+}
+
+void touchUiCommands() {
+    UiCmd c;
+    for (int i = 0; i < UI_CMD_DRAIN_MAX && cmdQueue && xQueueReceive(cmdQueue, &c, 0) == pdTRUE; i++) {
+        char reply[64];
+        bool hasReply = handleWebCommand(UI_CLIENT, (const uint8_t *)c.text, strlen(c.text), reply, sizeof(reply));
+        snprintf(uiReply, sizeof(uiReply), "%s", (hasReply && reply[0]) ? reply : c.text);
+        __atomic_store_n(&uiReplySeq, uiReplySeq + 1, __ATOMIC_RELEASE);
+    }
+}
+
+// ============ 显示任务: 事件 ============
+bool touchUiWait(TouchEvent *ev, uint32_t timeoutMs) {
+    return touchQueue && xQueueReceive(touchQueue, ev, pdMS_TO_TICKS(timeoutMs)) == pdTRUE;
+}
+
+static void sendCmd(const char *fmt, ...) {
+    UiCmd c;
+    va_list ap;
+    va_start(ap, fmt);
+    vsnprintf(c.text, sizeof(c.text), fmt, ap);
+    va_end(ap);
+    if (!cmdQueue || xQueueSend(cmdQueue, &c, 0) != pdTRUE) {
+        snprintf(toast, sizeof(toast), "busy: %s", c.text);
+        toastMs = millis();
+    }
+}
+
+static inline bool hit(const TouchEvent &e, int x, int y, int w, int h) {
+    return e.x >= x && e.x < x + w && e.y >= y && e.y < y + h;
+}
+
+// ---- 菜单 3×3 ----
+static void actStand()    { sendCmd("S"); }
+static void actStop()     { sendCmd("E"); }
+static void actReset()    { sendCmd("R"); }
+static void actParams()   { screen = SCR_PARAMS; }
+static void actChart()    { displaySetChartMode(!displayChartMode()); screen = SCR_NONE; }
+static void actDiag()     { screen = SCR_DIAG; }
+static void actBench()    { sendCmd(benchMode ? "B,0" : "B,1"); }
+static void actCharact()  { sendCmd(charactActive() ? "CH,0" : "CH,1"); }
+static void actAutoTune() { sendCmd(isAutoTuning() ? "AX" : "AT"); }
+
+static const char *stChart()    { return displayChartMode() ? "ON" : "OFF"; }
+static const char *stBench()    { return benchMode ? "ON" : "OFF"; }
+static const char *stCharact()  { return charactActive() ? "RUNNING" : ""; }
+static const char *stAutoTune() { return isAutoTuning() ? "RUNNING" : ""; }
+
+struct MenuItem {
+    const char *label;
+    uint16_t    color;
+    void (*action)();
+    const char *(*state)();   // 可为空
+};
+
+static const MenuItem MENU[9] = {
+    {"Stand",    GREEN,  actStand,    nullptr},
+    {"E-Stop",   RED,    actStop,     nullptr},
+    {"Reset",    YELLOW, actReset,    nullptr},
+    {"Params",   CYAN,   actParams,   nullptr},
+    {"Chart",    CYAN,   actChart,    stChart},
+    {"Diag",     CYAN,   actDiag,     nullptr},
+    {"Bench",    ORANGE, actBench,    stBench},
+    {"Charact",  ORANGE, actCharact,  stCharact},
+    {"Autotune", ORANGE, actAutoTune, stAutoTune},
+};
+
+static void menuCell(int i, int *x, int *y, int *w, int *h) {
+    *w = screenW / 3;
+    *h = (screenH - HEADER_H) / 3;
+    *x = (i % 3) * *w;
+    *y = HEADER_H + (i / 3) * *h;
+}
+
+// ---- 参数编辑 ----
+static const int EDIT_BTN_Y = 120, EDIT_BTN_H = 52;
+static const int EDIT_ACT_Y = 180, EDIT_ACT_H = 56;
+static const char *const EDIT_LABELS[4] = {"--", "-", "+", "++"};
+
+static float editStep(bool big) {
+    const ParamDef &p = paramDef(editIdx);
+    float step = (p.maxV - p.minV) / (big ? 20.0f : 200.0f);
+    return p.integer ? fmaxf(roundf(step), 1.0f) : step;
+}
+
+static void editNudge(int btn) {
+    const ParamDef &p = paramDef(editIdx);
+    float step = editStep(btn == 0 || btn == 3);
+    editVal += (btn >= 2) ? step : -step;
+    editVal = constrain(editVal, p.minV, p.maxV);
+    if (p.integer) editVal = roundf(editVal);
+}
+
+static void handleHome(const TouchEvent &e) {
+    if (e.type != TOUCH_PRESS) return;
+    if (e.y < HEADER_H || displayChartMode()) {
+        screen = SCR_MENU;
+        return;
+    }
+    if (isAutoTuning()) return;
+    const int third = screenW / 3;
+    if (e.x < third || e.x > third * 2) {
+        int idx = paramFind("Kp");
+        if (idx < 0) return;
+        const ParamDef &p = paramDef(idx);
+        float kp = constrain(paramGet(idx) + (e.x < third ? -1.0f : 1.0f), p.minV, p.maxV);
+        sendCmd("PS,Kp,%.1f", kp);
+    } else if (fallen || diagMode) {
+        sendCmd("S");
+    }
+}
+
+void touchUiHandle(const TouchEvent &e) {
+    if (screen == SCR_NONE) {
+        handleHome(e);
+        return;
+    }
+
+    // 按住只用于参数编辑的 +/- 连调
+    if (e.type == TOUCH_HOLD) {
+        if (screen == SCR_EDIT && editBtn >= 0) editNudge(editBtn);
+        return;
+    }
+    editBtn = -1;
+
+    if (e.y < HEADER_H) {
+        // 顶栏 = 返回上一级
+        screen = (screen == SCR_EDIT) ? SCR_PARAMS : (screen == SCR_MENU ? SCR_NONE : SCR_MENU);
+        return;
+    }
+
+    switch (screen) {
+    case SCR_MENU:
+        for (int i = 0; i < 9; i++) {
+            int x, y, w, h;
+            menuCell(i, &x, &y, &w, &h);
+            if (hit(e, x, y, w, h)) {
+                MENU[i].action();
+                break;
+            }
+        }
+        break;
+    case SCR_PARAMS: {
+        int row = (e.y - HEADER_H) / UI_ROW_H;
+        if (row >= 0 && row < paramCount()) {
+            editIdx = row;
+            editVal = paramGet(row);
+            screen = SCR_EDIT;
+        }
+        break;
+    }
+    case SCR_EDIT:
+        if (hit(e, 0, EDIT_BTN_Y, screenW, EDIT_BTN_H)) {
+            editBtn = e.x * 4 / screenW;
+            editNudge(editBtn);
+        } else if (hit(e, 0, EDIT_ACT_Y, screenW / 2, EDIT_ACT_H)) {
+            sendCmd("PS,%s,%g", paramDef(editIdx).name, editVal);
+            screen = SCR_PARAMS;
+        } else if (hit(e, screenW / 2, EDIT_ACT_Y, screenW / 2, EDIT_ACT_H)) {
+            screen = SCR_PARAMS;
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+// ============ 显示任务: 绘制 ============
+static void drawTitle(M5Canvas &c, const char *title) {
+    c.fillRect(0, 0, screenW, HEADER_H - 2, NAVY);
+    c.setTextSize(2);
+    c.setTextDatum(ML_DATUM);
+    c.setTextColor(WHITE);
+    c.drawString("<", 6, HEADER_H / 2 - 1);
+    c.drawString(title, 24, HEADER_H / 2 - 1);
+}
+
+static void drawButton(M5Canvas &c, int x, int y, int w, int h, const char *label, const char *sub,
+                       uint16_t color) {
+    c.fillRoundRect(x + 3, y + 3, w - 6, h - 6, 6, 0x18E3);
+    c.drawRoundRect(x + 3, y + 3, w - 6, h - 6, 6, color);
+    c.setTextDatum(MC_DATUM);
+    c.setTextColor(color);
+    c.setTextSize(2);
+    c.drawString(label, x + w / 2, y + h / 2 - (sub && sub[0] ? 7 : 0));
+    if (sub && sub[0]) {
+        c.setTextSize(1);
+        c.setTextColor(LIGHTGREY);
+        c.drawString(sub, x + w / 2, y + h / 2 + 12);
+    }
+}
+
+static void drawMenu(M5Canvas &c) {
+    drawTitle(c, "Menu");
+    for (int i = 0; i < 9; i++) {
+        int x, y, w, h;
+        menuCell(i, &x, &y, &w, &h);
+        drawButton(c, x, y, w, h, MENU[i].label, MENU[i].state ? MENU[i].state() : nullptr, MENU[i].color);
+    }
+}
+
+static void formatParam(char *buf, size_t size, const ParamDef &p, float v) {
+    if (p.integer) snprintf(buf, size, "%.0f", v);
+    else           snprintf(buf, size, "%.3g", v);
+}
+
+static void drawParams(M5Canvas &c) {
+    drawTitle(c, "Params");
+    char buf[24];
+    for (int i = 0; i < paramCount(); i++) {
+        const ParamDef &p = paramDef(i);
+        const int y = HEADER_H + i * UI_ROW_H;
+        c.drawFastHLine(0, y + UI_ROW_H - 1, screenW, 0x2945);
+        c.setTextSize(2);
+        c.setTextDatum(ML_DATUM);
+        c.setTextColor(CYAN);
+        c.drawString(p.name, 8, y + UI_ROW_H / 2);
+        formatParam(buf, sizeof(buf), p, paramGet(i));
+        c.setTextDatum(MR_DATUM);
+        c.setTextColor(WHITE);
+        c.drawString(buf, screenW - 70, y + UI_ROW_H / 2);
+        c.setTextSize(1);
+        c.setTextColor(LIGHTGREY);
+        c.setTextDatum(ML_DATUM);
+        c.drawString(p.unit, screenW - 64, y + UI_ROW_H / 2);
+    }
+}
+
+static void drawEdit(M5Canvas &c) {
+    const ParamDef &p = paramDef(editIdx);
+    drawTitle(c, p.name);
+    char buf[48];
+    formatParam(buf, sizeof(buf), p, editVal);
+    c.setTextDatum(MC_DATUM);
+    c.setTextSize(4);
+    c.setTextColor(WHITE);
+    c.drawString(buf, screenW / 2, 62);
+
+    c.setTextSize(1);
+    c.setTextColor(LIGHTGREY);
+    char cur[16];
+    formatParam(cur, sizeof(cur), p, paramGet(editIdx));
+    snprintf(buf, sizeof(buf), "%s  [%g .. %g]  now %s", p.unit, p.minV, p.maxV, cur);
+    c.drawString(buf, screenW / 2, 98);
+
+    const int w = screenW / 4;
+    for (int i = 0; i < 4; i++) {
+        drawButton(c, i * w, EDIT_BTN_Y, w, EDIT_BTN_H, EDIT_LABELS[i], nullptr, CYAN);
+    }
+    drawButton(c, 0, EDIT_ACT_Y, screenW / 2, EDIT_ACT_H, "Apply", nullptr, GREEN);
+    drawButton(c, screenW / 2, EDIT_ACT_Y, screenW / 2, EDIT_ACT_H, "Cancel", nullptr, LIGHTGREY);
+}
+
+static void drawDiag(M5Canvas &c) {
+    drawTitle(c, "Diagnostics");
+    const DeadlineStats &dl = deadlineStats();
+    const PowerStatus &pw = powerStatus();
+    uint32_t outUsed, outHigh, drops;
+    webQueueStats(&outUsed, &outHigh, &drops);
+
+    c.setTextSize(1);
+    c.setTextDatum(TL_DATUM);
+    c.setTextColor(WHITE);
+    int y = HEADER_H + 6;
+    const int dy = 17;
+    c.setCursor(6, y);
+    c.printf("Mode  %s   Kp %.1f  Ki %.1f  Kd %.2f",
+             benchMode ? "BENCH" : (fallen ? "FALLEN" : (diagMode ? "DIAG" : "RUN")), Kp, Ki, Kd);
+    c.setCursor(6, y += dy);
+    c.printf("Up %lus   heap %lu  min %lu", millis() / 1000, (unsigned long)ESP.getFreeHeap(),
+             (unsigned long)ESP.getMinFreeHeap());
+    c.setCursor(6, y += dy);
+    c.printf("Ticks %lu  late %lu  skip %lu  max %luus", (unsigned long)dl.ticks,
+             (unsigned long)dl.late, (unsigned long)dl.skipped, (unsigned long)dl.maxLateUs);
+    c.setCursor(6, y += dy);
+    c.printf("CAN tx fail %lu   ctrl dt %.2fms", (unsigned long)canTxFailCount, ctrlDtMs);
+    c.setCursor(6, y += dy);
+    c.setTextColor(pw.warn >= 2 ? RED : (pw.warn ? YELLOW : WHITE));
+    c.printf("Vbus %.2fV  SOC %.0f%%  I %.2fA  budget %dmA", pw.vbus, pw.soc, pw.ibus, pw.budgetMa);
+    c.setTextColor(WHITE);
+    c.setCursor(6, y += dy);
+    c.printf("Temp R %.0fC  L %.0fC   I R %.0f  L %.0f mA", motorTempR, motorTempL,
+             actualCurrentR, actualCurrentL);
+    c.setCursor(6, y += dy);
+    c.printf("Net out %luB  peak %luB  drops %lu", (unsigned long)outUsed, (unsigned long)outHigh,
+             (unsigned long)drops);
+    c.setCursor(6, y += dy);
+    c.setTextColor(supervisorTripped() ? RED : WHITE);
+    c.printf("Safety %s   boot %s", supervisorTripped() ? supervisorReasonName(supervisorLastReason()) : "OK",
+             supervisorBootReason());
+    c.setTextColor(WHITE);
+    c.setCursor(6, y += dy);
+    c.printf("Pitch %+.2f  target %+.2f  out %+.0f", currentPitch + PITCH_MOUNT_OFFSET,
+             targetAngleFilt, pidOutput);
+}
+
+static void drawToast(M5Canvas &c) {
+    uint32_t seq = __atomic_load_n(&uiReplySeq, __ATOMIC_ACQUIRE);
+    if (seq != shownReplySeq) {
+        shownReplySeq = seq;
+        snprintf(toast, sizeof(toast), "%s", uiReply);
+        toastMs = millis();
+    }
+    if (!toast[0] || millis() - toastMs > TOAST_MS) return;
+    c.fillRect(0, screenH - 16, screenW, 16, 0x2104);
+    c.setTextSize(1);
+    c.setTextDatum(ML_DATUM);
+    c.setTextColor(strncmp(toast, "ERR", 3) == 0 ? RED : GREEN);
+    c.drawString(toast, 6, screenH - 8);
+}
+
+bool touchUiDraw(M5Canvas &c) {
+    if (screen == SCR_NONE) {
+        // 主视图下只消化回复序号, 返回菜单时不弹出旧提示
+        shownReplySeq = __atomic_load_n(&uiReplySeq, __ATOMIC_ACQUIRE);
+        return false;
+    }
+    c.fillScreen(BLACK);
+    switch (screen) {
+    case SCR_MENU:   drawMenu(c);   break;
+    case SCR_PARAMS: drawParams(c); break;
+    case SCR_EDIT:   drawEdit(c);   break;
+    case SCR_DIAG:   drawDiag(c);   break;
+    default: break;
+    }
+    drawToast(c);
+    return true;
+}
@@ -0,0 +1,35 @@
+#pragma once
+/**
+ * touch_ui.h — 触屏菜单: loop 只把触摸事件放入队列, 显示任务 (核 0) 消费事件并绘制菜单;
+ *              菜单动作以文本命令回送控制核, 与 WebSocket 命令共用同一张命令表
+ */
+
+#include <Arduino.h>
+#include <M5Unified.h>
+
+enum TouchEventType : uint8_t {
+    TOUCH_PRESS,     // 按下
+    TOUCH_HOLD,      // 按住 (每 TOUCH_REPEAT_MS 重复一次, 用于参数连调)
+};
+
+struct TouchEvent {
+    uint8_t  type;
+    int16_t  x, y;
+    uint32_t ms;
+};
+
+// 创建事件/命令队列 (displayInit 之前调用)
+void touchUiInit();
+
+// ---- 控制核 (loop) ----
+// M5.update() 之后调用: 只读取触摸状态并入队, 不做任何 UI 逻辑
+void touchUiPoll();
+// 执行菜单发来的命令 (每次最多几条), 回复留给菜单显示
+void touchUiCommands();
+
+// ---- 显示任务 ----
+// 等待触摸事件, 最长 timeoutMs
+bool touchUiWait(TouchEvent *ev, uint32_t timeoutMs);
+void touchUiHandle(const TouchEvent &ev);
+// 菜单打开时画满整屏并返回 true; 否则返回 false 由显示任务画主视图
+bool touchUiDraw(M5Canvas &c);
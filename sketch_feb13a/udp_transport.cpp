@@ -0,0 +1,173 @@
+/**
+ * udp_transport.cpp — UDP 低延迟通道
+ *
+ * 与 WebSocket 相比: 丢一个包不会阻塞后续包 (无队头阻塞), 摇杆/遥测都是"最新值"
+ * 语义, 丢包直接由下一包覆盖; 乱序包由序号丢弃 (摇杆在 joystick_input 内判断,
+ * 遥测由客户端判断)。只支持一个订阅者 (最近一次 SUB 的地址)。
+ */
+
+#include "udp_transport.h"
+#include "config.h"
+#include "deadline_monitor.h"
+#include "globals.h"
+#include "joystick_input.h"
+
+#include <WiFi.h>
+#include <WiFiUdp.h>
+
+enum : uint8_t {
+  UDP_JOY   = 0x01,
+  UDP_SUB   = 0x02,
+  UDP_PING  = 0x03,
+  UDP_TELEM = 0x81,
+  UDP_PONG  = 0x83,
+};
+
+static const uint8_t UDP_VERSION = 1;
+
+struct __attribute__((packed)) UdpHeader {
+  char     magic[2];
+  uint8_t  version;
+  uint8_t  type;
+  uint16_t seq;
+  uint32_t ms;
+};
+
+struct __attribute__((packed)) UdpTelem {
+  float    pitch;
+  float    target;
+  float    gyro;
+  float    pid;
+  int16_t  cmdR, cmdL;
+  int16_t  actR, actL;
+  float    linearSpeed;
+  float    ctrlDtMs;
+  uint16_t joySeq;     // 最近受理的摇杆包序号 + 客户端时间戳 (端到端时延)
+  uint32_t joyEchoMs;
+  uint8_t  flags;      // bit0 fallen, bit1 diag, bit2 bench
+};
+
+static WiFiUDP udp;
+static bool          udpReady   = false;
+static IPAddress     subIP;
+static uint16_t      subPort    = 0;
+static uint16_t      subPeriodMs = 0;
+static unsigned long subRenewMs = 0;
+static unsigned long lastTelemMs = 0;
+static uint16_t      txSeq      = 0;
+
+static void fillHeader(UdpHeader &h, uint8_t type, uint16_t seq, uint32_t ms) {
+  h.magic[0] = 'M';
+  h.magic[1] = 'B';
+  h.version = UDP_VERSION;
+  h.type = type;
+  h.seq = seq;
+  h.ms = ms;
+}
+
+static void sendTo(IPAddress ip, uint16_t port, const uint8_t *data, size_t len) {
+  udp.beginPacket(ip, port);
+  udp.write(data, len);
+  udp.endPacket();
+}
+
+static void handlePacket(const uint8_t *buf, int len) {
+  if (len < (int)sizeof(UdpHeader)) return;
+  UdpHeader h;
+  memcpy(&h, buf, sizeof(h));
+  if (h.magic[0] != 'M' || h.magic[1] != 'B' || h.version != UDP_VERSION) return;
+  const uint8_t *body = buf + sizeof(h);
+  int bodyLen = len - (int)sizeof(h);
+
+  switch (h.type) {
+  case UDP_JOY: {
+    if (bodyLen < 4) return;
+    int16_t x, y;
+    memcpy(&x, body, 2);
+    memcpy(&y, body + 2, 2);
+    if (abs(x) > 100 || abs(y) > 100) return;
+    joystickInput(JOY_SRC_UDP, true, h.seq, h.ms, x, y);
+    break;
+  }
+  case UDP_SUB: {
+    if (bodyLen < 2) return;
+    uint16_t period;
+    memcpy(&period, body, 2);
+    subIP = udp.remoteIP();
+    subPort = udp.remotePort();
+    subPeriodMs = period ? max(period, (uint16_t)UDP_TELEM_MIN_MS) : 0;
+    subRenewMs = millis();
+    break;
+  }
+  case UDP_PING: {
+    uint8_t out[sizeof(UdpHeader) + 4];
+    UdpHeader r;
+    fillHeader(r, UDP_PONG, h.seq, h.ms);
+    uint32_t us = micros();
+    memcpy(out, &r, sizeof(r));
+    memcpy(out + sizeof(r), &us, 4);
+    sendTo(udp.remoteIP(), udp.remotePort(), out, sizeof(out));
+    break;
+  }
+  default:
+    break;
+  }
+}
+
+static void sendTelemetry() {
+  uint8_t out[sizeof(UdpHeader) + sizeof(UdpTelem)];
+  UdpHeader h;
+  fillHeader(h, UDP_TELEM, ++txSeq, millis());
+
+  UdpTelem t;
+  t.pitch = currentPitch + PITCH_MOUNT_OFFSET;
+  t.target = targetAngleFilt;
+  t.gyro = gyroRate;
+  t.pid = pidOutput;
+  t.cmdR = (int16_t)cmdSpdR;
+  t.cmdL = (int16_t)cmdSpdL;
+  t.actR = (int16_t)actualSpdR;
+  t.actL = (int16_t)actualSpdL;
+  t.linearSpeed = linearSpeed;
+  t.ctrlDtMs = ctrlDtMs;
+  uint16_t joySeq;
+  uint32_t joyEchoMs;
+  joystickLastSample(&joySeq, &joyEchoMs);
+  t.joySeq = joySeq;
+  t.joyEchoMs = joyEchoMs;
+  t.flags = (fallen ? 1 : 0) | (diagMode ? 2 : 0) | (benchMode ? 4 : 0);
+
+  memcpy(out, &h, sizeof(h));
+  memcpy(out + sizeof(h), &t, sizeof(t));
+  sendTo(subIP, subPort, out, sizeof(out));
+}
+
+void udpInit() {
+#if UDP_ENABLE
+  udpReady = udp.begin(UDP_PORT) != 0;
+#endif
+}
+
+void udpLoop() {
+  if (!udpReady) return;
+  deadlineBegin(DL_UDP);
+
+  // 每轮最多处理 4 个包, 摇杆包按序号只取最新
+  uint8_t buf[64];
+  for (int i = 0; i < 4; i++) {
+    int n = udp.parsePacket();
+    if (n <= 0) break;
+    int len = udp.read(buf, sizeof(buf));
+    handlePacket(buf, len);
+  }
+
+  unsigned long nowMs = millis();
+  if (subPeriodMs && nowMs - subRenewMs > UDP_SUB_TIMEOUT_MS) {
+    subPeriodMs = 0;
+  }
+  if (subPeriodMs && nowMs - lastTelemMs >= subPeriodMs) {
+    lastTelemMs = nowMs;
+    sendTelemetry();
+  }
+  deadlineEnd(DL_UDP);
+}
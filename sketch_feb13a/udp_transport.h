@@ -0,0 +1,19 @@
+#pragma once
+/**
+ * udp_transport.h — UDP 低延迟通道: 摇杆指令 + 高速遥测 (二进制, 带序号, 只取最新值)
+ *
+ * 包头 (小端, 10 字节): 'M','B', 版本, 类型, seq uint16, ms uint32
+ *   0x01 JOY    客户端→机器人  int16 x, int16 y
+ *   0x02 SUB    客户端→机器人  uint16 periodMs (0 = 退订), 需在 UDP_SUB_TIMEOUT_MS 内续订
+ *   0x03 PING   客户端→机器人  无负载, 立即回 PONG (测传输往返)
+ *   0x83 PONG   机器人→客户端  原样回传 seq/ms + uint32 机器人 µs
+ *   0x81 TELEM  机器人→客户端  见 udp_transport.cpp 中 UdpTelem
+ * 主机端客户端库: tools/mbot_udp.py, 时延测试: tools/udp_latency.py
+ */
+
+#include <Arduino.h>
+
+void udpInit();
+
+// 主循环中调用: 非阻塞收包 + 按订阅周期发送遥测
+void udpLoop();
@@ -0,0 +1,222 @@
+/**
+ * web_api.cpp — HTTP 接口 JSON 编码
+ *
+ * 与 WebSocket 的 CSV 消息一样用 snprintf 直接写入调用方缓冲区, 不分配堆内存。
+ * 数值字段 NaN (如从未读到的寄存器) 输出为 null。
+ */
+
+#include "web_api.h"
+#include "auto_tune.h"
+#include "can_latency.h"
+#include "config.h"
+#include "deadline_monitor.h"
+#include "globals.h"
+#include "motor_regs.h"
+#include "param_registry.h"
+#include "power_mgmt.h"
+#include "run_log.h"
+#include "thermal_model.h"
+#include "web_control.h"
+
+#include <stdarg.h>
+
+struct JsonOut {
+  char  *buf;
+  size_t size;
+  size_t n;
+  bool   overflow;
+};
+
+static void jsonf(JsonOut &o, const char *fmt, ...) {
+  if (o.overflow) return;
+  va_list ap;
+  va_start(ap, fmt);
+  int w = vsnprintf(o.buf + o.n, o.size - o.n, fmt, ap);
+  va_end(ap);
+  if (w < 0 || (size_t)w >= o.size - o.n) {
+    o.overflow = true;
+    return;
+  }
+  o.n += w;
+}
+
+static void jsonNum(JsonOut &o, const char *key, float v, int prec) {
+  if (isnan(v) || isinf(v)) jsonf(o, "\"%s\":null", key);
+  else                      jsonf(o, "\"%s\":%.*f", key, prec, v);
+}
+
+static size_t finish(JsonOut &o) {
+  return o.overflow ? 0 : o.n;
+}
+
+// 逗号分隔列表中是否含 name (list 为空视为全选)
+static bool listHas(const char *list, const char *name) {
+  if (!list || !list[0]) return true;
+  size_t len = strlen(name);
+  for (const char *p = list; *p;) {
+    const char *e = strchr(p, ',');
+    size_t n = e ? (size_t)(e - p) : strlen(p);
+    if (n == len && strncmp(p, name, n) == 0) return true;
+    if (!e) break;
+    p = e + 1;
+  }
+  return false;
+}
+
+static const char *stateName() {
+  if (benchMode) return "bench";
+  if (fallen)    return "fallen";
+  if (diagMode)  return "diag";
+  return "balancing";
+}
+
+size_t buildApiStatus(char *buf, size_t size) {
+  JsonOut o = {buf, size, 0, false};
+  const PowerStatus &pw = powerStatus();
+  jsonf(o, "{\"uptimeMs\":%lu,\"state\":\"%s\",\"autoTuning\":%s,\"ip\":\"%s\",",
+        millis(), stateName(), isAutoTuning() ? "true" : "false", myIP.c_str());
+  jsonNum(o, "pitch", currentPitch, 2);       jsonf(o, ",");
+  jsonNum(o, "roll", currentRoll, 2);         jsonf(o, ",");
+  jsonNum(o, "yaw", currentYaw, 1);           jsonf(o, ",");
+  jsonNum(o, "gyroRate", gyroRate, 1);        jsonf(o, ",");
+  jsonNum(o, "targetAngle", targetAngleFilt, 2); jsonf(o, ",");
+  jsonNum(o, "linearSpeed", linearSpeed, 1);  jsonf(o, ",");
+  jsonNum(o, "distanceMm", distanceMM, 0);    jsonf(o, ",");
+  jsonNum(o, "ctrlDtMs", ctrlDtMs, 3);
+  jsonf(o, ",\"motors\":{");
+  for (int m = 0; m < 2; m++) {
+    bool r = m == 0;
+    jsonf(o, "%s\"%s\":{", m ? "," : "", r ? "R" : "L");
+    jsonNum(o, "rpm", r ? actualSpeedR : actualSpeedL, 1);        jsonf(o, ",");
+    jsonNum(o, "currentMa", r ? actualCurrentR : actualCurrentL, 0); jsonf(o, ",");
+    jsonNum(o, "vin", r ? vinR : vinL, 2);                        jsonf(o, ",");
+    jsonNum(o, "tempC", r ? motorTempR : motorTempL, 0);
+    jsonf(o, ",\"cmd\":%d,\"encoder\":%ld}", r ? dbgSentR : dbgSentL,
+          (long)(r ? encoderR : encoderL));
+  }
+  jsonf(o, "},\"power\":{");
+  jsonNum(o, "vbus", pw.vbus, 2); jsonf(o, ",");
+  jsonNum(o, "soc", pw.soc, 0);   jsonf(o, ",");
+  jsonNum(o, "ibus", pw.ibus, 2);
+  jsonf(o, ",\"warn\":%d}}", pw.warn);
+  return finish(o);
+}
+
+size_t buildApiParams(char *buf, size_t size, const char *names) {
+  JsonOut o = {buf, size, 0, false};
+  jsonf(o, "{\"params\":{");
+  bool first = true;
+  for (int i = 0; i < paramCount(); i++) {
+    const ParamDef &p = paramDef(i);
+    if (!listHas(names, p.name)) continue;
+    jsonf(o, "%s\"%s\":{", first ? "" : ",", p.name);
+    jsonNum(o, "value", paramGet(i), p.integer ? 0 : 3);
+    jsonf(o, ",\"min\":%g,\"max\":%g,\"unit\":\"%s\"}", p.minV, p.maxV, p.unit);
+    first = false;
+  }
+  jsonf(o, "}}");
+  return finish(o);
+}
+
+size_t buildApiRegisters(char *buf, size_t size, const char *motors, const char *regs) {
+  JsonOut o = {buf, size, 0, false};
+  MotorRegSnapshot snap;
+  motorRegsSnapshot(&snap);
+  static const char *const MOTOR_NAMES[2] = {"R", "L"};
+
+  jsonf(o, "{\"ms\":%lu,\"motors\":{", (unsigned long)snap.ms);
+  bool firstMotor = true;
+  for (int m = 0; m < 2; m++) {
+    if (!listHas(motors, MOTOR_NAMES[m])) continue;
+    jsonf(o, "%s\"%s\":{", firstMotor ? "" : ",", MOTOR_NAMES[m]);
+    firstMotor = false;
+    bool first = true;
+    for (int i = 0; i < MREG_COUNT; i++) {
+      const MotorRegDef &d = motorRegsDef(i);
+      char hex[8];
+      snprintf(hex, sizeof(hex), "0x%04X", d.reg);
+      if (regs && regs[0] && !listHas(regs, d.name) && !listHas(regs, hex)) continue;
+      jsonf(o, "%s\"%s\":{\"reg\":\"%s\",", first ? "" : ",", d.name, hex);
+      first = false;
+      if (!snap.atMs[m][i]) {
+        jsonf(o, "\"raw\":null,\"value\":null,\"ageMs\":null}");
+        continue;
+      }
+      jsonf(o, "\"raw\":%ld,", (long)snap.raw[m][i]);
+      jsonNum(o, "value", snap.raw[m][i] / (float)d.scale, d.scale >= 100000 ? 7 : 2);
+      jsonf(o, ",\"unit\":\"%s\",\"ageMs\":%lu}", d.unit,
+            (unsigned long)(snap.ms - snap.atMs[m][i]));
+    }
+    jsonf(o, "}");
+  }
+  jsonf(o, "}}");
+  return finish(o);
+}
+
+size_t buildApiDiag(char *buf, size_t size) {
+  JsonOut o = {buf, size, 0, false};
+  const DeadlineStats &dl = deadlineStats();
+  jsonf(o, "{\"deadline\":{\"ticks\":%lu,\"late\":%lu,\"skipped\":%lu,\"maxLateUs\":%lu,"
+           "\"events\":%lu,\"lostEvents\":%lu,\"missByTag\":{",
+        (unsigned long)dl.ticks, (unsigned long)dl.late, (unsigned long)dl.skipped,
+        (unsigned long)dl.maxLateUs, (unsigned long)dl.events, (unsigned long)dl.lostEvents);
+  for (int t = 0; t < DL_TAG_N; t++) {
+    jsonf(o, "%s\"%s\":%lu", t ? "," : "", deadlineTagName((DlTag)t),
+          (unsigned long)dl.missByTag[t]);
+  }
+
+  uint32_t outUsed, outHigh, drops;
+  webQueueStats(&outUsed, &outHigh, &drops);
+  jsonf(o, "}},\"net\":{\"outQueue\":%lu,\"outQueueHigh\":%lu,\"queueDrops\":%lu},",
+        (unsigned long)outUsed, (unsigned long)outHigh, (unsigned long)drops);
+  jsonf(o, "\"can\":{\"txFail\":%lu,\"latencyProbe\":%s",
+        (unsigned long)canTxFailCount, latencyProbeEnabled() ? "true" : "false");
+  if (latencyProbeEnabled()) {
+    static const char *const TYPE_NAMES[LAT_TYPES] = {"ack", "resp", "read"};
+    for (int t = 0; t < LAT_TYPES; t++) {
+      for (int m = 0; m < 2; m++) {
+        LatencyStats s = latencyStats(t, m == 0 ? MOTOR_R : MOTOR_L);
+        jsonf(o, ",\"%s%s\":{\"n\":%lu,\"p50Us\":%lu,\"p99Us\":%lu,\"maxUs\":%lu,\"lost\":%lu}",
+              TYPE_NAMES[t], m == 0 ? "R" : "L", (unsigned long)s.count,
+              (unsigned long)s.p50Us, (unsigned long)s.p99Us, (unsigned long)s.maxUs,
+              (unsigned long)s.lost);
+      }
+    }
+  }
+  jsonf(o, "},\"thermal\":{");
+  for (int m = 0; m < 2; m++) {
+    const ThermalState &t = thermalState(m == 0 ? THERMAL_R : THERMAL_L);
+    jsonf(o, "%s\"%s\":{", m ? "," : "", m == 0 ? "R" : "L");
+    jsonNum(o, "windingC", t.windingDeg, 1); jsonf(o, ",");
+    jsonNum(o, "i2t", t.i2tUsed, 3);
+    jsonf(o, ",\"limitMa\":%d}", t.limitMa);
+  }
+  jsonf(o, "},\"heap\":{\"free\":%lu,\"minFree\":%lu,\"maxAlloc\":%lu}}",
+        (unsigned long)ESP.getFreeHeap(), (unsigned long)ESP.getMinFreeHeap(),
+        (unsigned long)ESP.getMaxAllocHeap());
+  return finish(o);
+}
+
+size_t buildApiRuns(char *buf, size_t size) {
+  JsonOut o = {buf, size, 0, false};
+  uint32_t oldest = runLogOldestSeq();
+  jsonf(o, "{\"capacity\":%lu,\"hz\":%d,\"runs\":[", (unsigned long)runLogCapacity(),
+        CTRL_HZ / RUNLOG_DECIM);
+  RunInfo r;
+  for (int i = 0; runLogRun(i, &r); i++) {
+    uint32_t avail = r.endSeq > oldest ? r.endSeq - max(r.startSeq, oldest) : 0;
+    jsonf(o, "%s{\"id\":%lu,\"kind\":\"%s\",\"active\":%s,\"reason\":\"%s\","
+             "\"startMs\":%lu,\"durationMs\":%lu,\"samples\":%lu,\"available\":%lu,",
+          i ? "," : "", (unsigned long)r.id, r.kind == RUN_BENCH ? "BENCH" : "BAL",
+          r.active ? "true" : "false", r.reason, (unsigned long)r.startMs,
+          (unsigned long)(r.endMs - r.startMs), (unsigned long)(r.endSeq - r.startSeq),
+          (unsigned long)avail);
+    jsonNum(o, "maxPitch", r.maxPitch, 2);  jsonf(o, ",");
+    jsonNum(o, "maxPid", r.maxPid, 1);      jsonf(o, ",");
+    jsonNum(o, "maxSpeed", r.maxSpeed, 0);  jsonf(o, ",");
+    jsonNum(o, "distMm", r.endDist - r.startDist, 0);
+    jsonf(o, "}");
+  }
+  jsonf(o, "]}");
+  return finish(o);
+}
@@ -0,0 +1,22 @@
+#pragma once
+/**
+ * web_api.h — HTTP 接口的 JSON 响应编码 (/api/status, /api/params, /api/registers, /api/diag)
+ *
+ * 在网络任务中调用: 只读全局变量与各模块统计快照, 不发起 CAN 读。
+ * 返回写入长度; 缓冲区不足返回 0。
+ */
+
+#include <Arduino.h>
+
+size_t buildApiStatus(char *buf, size_t size);
+
+// names: 逗号分隔的参数名, 空 = 全部
+size_t buildApiParams(char *buf, size_t size, const char *names);
+
+// motors: "R" / "L" / 空 = 两者; regs: 逗号分隔的名称或 0x 地址, 空 = 全部
+size_t buildApiRegisters(char *buf, size_t size, const char *motors, const char *regs);
+
+size_t buildApiDiag(char *buf, size_t size);
+
+// 闭环日志 run 列表 (最新在前)
+size_t buildApiRuns(char *buf, size_t size);
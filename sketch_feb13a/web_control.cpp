@@ -1,7 +1,25 @@
+/**
+ * web_control.cpp — 网络任务 (核 0) + 控制侧消息交接
+ *
+ * WebServer / WebSocketsServer 只在网络任务中运行, loop() 不再做任何 socket 操作:
+ *   入站 (网络任务 → loop): 连接/断开事件与命令帧进 inQueue, webLoop() 取出后
+ *       在控制核上执行 handleWebCommand (命令会改参数/发 CAN, 必须与控制拍同核);
+ *   出站 (loop → 网络任务): 遥测/事件消息在控制核上编码为完整快照后进 outQueue,
+ *       网络任务负责实际 TCP 发送, 慢客户端只会让队列变满丢帧。
+ * 两个队列都是 net_queue 的 SPSC 无锁环, 双方都不持锁。
+ */
+
 #include "web_control.h"
 
 #include "config.h"
+#include "deadline_monitor.h"
 #include "globals.h"
+#include "net_queue.h"
+#include "auto_tune.h"
+#include "param_registry.h"
+#include "run_log.h"
+#include "telemetry_hub.h"
+#include "web_api.h"
 #include "web_protocol.h"
 #include "web_ui_page.h"
 
@@ -13,28 +31,450 @@
 static WebServer httpServer(80);
 static WebSocketsServer wsServer(81);
 
+static uint8_t  inStorage[NET_IN_QUEUE_BYTES];
+static uint8_t  outStorage[NET_OUT_QUEUE_BYTES];
+static NetQueue inQueue;    // 网络任务 → loop
+static NetQueue outQueue;   // loop → 网络任务
+static TaskHandle_t netTaskHandle = nullptr;
+// 网络任务实测的每客户端最长发送耗时 (µs), 控制侧读取后清零; 偶发丢一次更新无妨
+static volatile uint32_t clientSendUs[TEL_MAX_CLIENTS];
+static char lastHttpMsg[96] = "";   // 最近一次页面传输统计 (HT), 新连接时补发 (控制侧)
+
+// HTTP 写接口的命令信箱: 网络任务把 [seq 4B][命令文本] 以 API_CLIENT 身份放入 inQueue,
+// 并把 apiPendingSeq 置为 seq 后等待。控制核取出记录时以 CAS(seq → 0) 认领, 认领成功才执行,
+// 执行完写回复并把 apiDoneSeq 置为 seq。网络任务超时时同样以 CAS(seq → 0) 撤销:
+// 撤销成功则控制核取到该记录时跳过 (不会在报 503 之后才生效); 撤销失败说明命令已在执行,
+// 继续等待真实结果。同一时刻最多一条在途。
+static const uint8_t API_CLIENT = 0xFE;
+static uint32_t          apiCmdSeq     = 0;   // 网络任务写
+static volatile uint32_t apiPendingSeq = 0;   // 待认领的命令序号, 0 = 无 (两端 CAS)
+static volatile uint32_t apiDoneSeq    = 0;   // 控制核写
+static char              apiReply[64];
+static const size_t      API_CMD_MAX   = 128; // 超出命令解析上限即可, 控制侧再按实际上限检查
+
+// ============ 页面发送 (gzip, 网络任务中每轮写一块) ============
+// 头部由 WebServer 发出, 正文按 HTTP_CHUNK_BYTES 分块在随后的轮次中写入,
+// 单次 handleClient() 不再一次性推送整页。
+static WiFiClient    pageClient;
+static size_t        pageOff    = 0;
+static bool          pageActive = false;
+static unsigned long pageStartMs = 0;
+static uint16_t      pageChunks = 0;
+
+static void finishPage(int status, size_t bytes) {
+  uint32_t maxLateUs, missTicks;
+  deadlineWindowEnd(&maxLateUs, &missTicks);
+  char msg[96];
+  // HT,path,status,bytes,transferMs,chunks,maxLateUs,missTicks
+  snprintf(msg, sizeof(msg), "HT,/,%d,%u,%lu,%u,%lu,%lu", status,
+           (unsigned)bytes, millis() - pageStartMs, (unsigned)pageChunks,
+           (unsigned long)maxLateUs, (unsigned long)missTicks);
+  netQueuePush(inQueue, NET_HTTP_STAT, 0, msg, strlen(msg));
+}
+
+static void handleIndex() {
+  if (pageActive) {
+    // 上一页尚未发完 (单连接服务器, 正常不会发生): 放弃旧连接
+    pageClient.stop();
+    pageActive = false;
+  }
+  pageStartMs = millis();
+  pageChunks = 0;
+  deadlineWindowBegin();
+
+  httpServer.sendHeader("ETag", WEB_INDEX_ETAG);
+  // no-cache: 每次加载都带 If-None-Match 重新验证 (未变时 304 无正文),
+  // 固件更新后 ETag 变化立即取到新页面, 不会有旧页面对接新协议
+  httpServer.sendHeader("Cache-Control", "no-cache");
+  if (httpServer.header("If-None-Match") == WEB_INDEX_ETAG) {
+    httpServer.send(304);
+    finishPage(304, 0);
+    return;
+  }
+
+  httpServer.sendHeader("Content-Encoding", "gzip");
+  httpServer.setContentLength(WEB_INDEX_GZ_LEN);
+  httpServer.send(200, "text/html", "");
+  pageClient = httpServer.client();
+  pageOff = 0;
+  pageActive = true;
+}
+
+static void pumpPage() {
+  if (!pageActive) return;
+  if (!pageClient.connected() || millis() - pageStartMs > HTTP_SEND_TIMEOUT_MS) {
+    pageClient.stop();
+    pageActive = false;
+    finishPage(499, pageOff);   // 客户端中断 / 超时
+    return;
+  }
+  size_t n = min((size_t)HTTP_CHUNK_BYTES, WEB_INDEX_GZ_LEN - pageOff);
+  size_t w = pageClient.write(WEB_INDEX_GZ + pageOff, n);
+  pageOff += w;
+  if (w > 0) pageChunks++;
+  if (pageOff >= WEB_INDEX_GZ_LEN) {
+    pageClient.stop();
+    pageActive = false;
+    finishPage(200, pageOff);
+  }
+}
+
+// ============ HTTP 接口 (/api/*, 网络任务中执行) ============
+// 读接口直接编码当前状态与寄存器快照; 写接口经命令信箱交给控制核执行。
+static char apiBuf[API_JSON_BYTES];
+
+static void sendJson(int status, size_t len) {
+  if (len == 0) {
+    httpServer.send(500, "application/json", "{\"ok\":false,\"error\":\"overflow\"}");
+    return;
+  }
+  httpServer.setContentLength(len);
+  httpServer.send(status, "application/json", "");
+  httpServer.sendContent(apiBuf, len);
+}
+
+static void sendApiError(int status, const char *error, const char *detail) {
+  int n = snprintf(apiBuf, sizeof(apiBuf), "{\"ok\":false,\"error\":\"%s\",\"detail\":\"%s\"}",
+                   error, detail);
+  sendJson(status, n > 0 && (size_t)n < sizeof(apiBuf) ? n : 0);
+}
+
+// 返回 false = 超时 (命令已撤销, 不会执行) 或队列满; reply 为控制核的回复 (ERR,... 表示命令被拒)
+static bool runApiCommand(const char *cmd, char *reply, size_t size) {
+  uint8_t rec[4 + API_CMD_MAX];
+  size_t len = strlen(cmd);
+  if (len > API_CMD_MAX) {
+    snprintf(reply, size, "ERR,?,length");
+    return true;
+  }
+  uint32_t seq = ++apiCmdSeq;
+  if (seq == 0) seq = ++apiCmdSeq;                    // 0 保留为"无待认领"
+  memcpy(rec, &seq, 4);
+  memcpy(rec + 4, cmd, len);
+  __atomic_store_n(&apiPendingSeq, seq, __ATOMIC_RELEASE);
+  if (!netQueuePush(inQueue, NET_TEXT, API_CLIENT, rec, 4 + len)) {
+    __atomic_store_n(&apiPendingSeq, 0, __ATOMIC_RELEASE);
+    return false;
+  }
+  unsigned long t0 = millis();
+  while (__atomic_load_n(&apiDoneSeq, __ATOMIC_ACQUIRE) != seq) {
+    if (millis() - t0 > API_CMD_TIMEOUT_MS) {
+      uint32_t expect = seq;
+      if (__atomic_compare_exchange_n(&apiPendingSeq, &expect, 0, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+        return false;
+      // 控制核已认领, 命令正在执行: 等它完成, 如实返回结果
+    }
+    vTaskDelay(1);
+  }
+  strncpy(reply, apiReply, size - 1);
+  reply[size - 1] = '\0';
+  return true;
+}
+
+// ERR,<cmd>,busy (自动调参中 / 平衡中拒绝阻塞命令) → 409, 其余拒绝 → 400
+static int apiErrorStatus(const char *reply) {
+  const char *tail = strrchr(reply, ',');
+  return (tail && strcmp(tail, ",busy") == 0) ? 409 : 400;
+}
+
+static void handleApiStatus() {
+  sendJson(200, buildApiStatus(apiBuf, sizeof(apiBuf)));
+}
+
+static void handleApiDiag() {
+  sendJson(200, buildApiDiag(apiBuf, sizeof(apiBuf)));
+}
+
+static void handleApiRegisters() {
+  String motors = httpServer.arg("motor");
+  String regs = httpServer.arg("reg");
+  sendJson(200, buildApiRegisters(apiBuf, sizeof(apiBuf), motors.c_str(), regs.c_str()));
+}
+
+// GET /api/params[?names=Kp,Kd]; POST /api/params 表单 name=value 可一次写多个
+static void handleApiParams() {
+  if (httpServer.method() == HTTP_POST) {
+    if (isAutoTuning()) {
+      sendApiError(409, "busy", "autotune");
+      return;
+    }
+    for (int i = 0; i < httpServer.args(); i++) {
+      String name = httpServer.argName(i);
+      if (paramFind(name.c_str()) < 0) continue;
+      char cmd[96], reply[64];
+      snprintf(cmd, sizeof(cmd), "PS,%s,%s", name.c_str(), httpServer.arg(i).c_str());
+      if (!runApiCommand(cmd, reply, sizeof(reply))) {
+        sendApiError(503, "timeout", name.c_str());
+        return;
+      }
+      if (strncmp(reply, "ERR,", 4) == 0) {
+        sendApiError(apiErrorStatus(reply), reply + 4, name.c_str());
+        return;
+      }
+    }
+  }
+  String names = httpServer.arg("names");
+  sendJson(200, buildApiParams(apiBuf, sizeof(apiBuf), names.c_str()));
+}
+
+// POST /api/cmd?c=P,17.5,0.5,1.4 — 任意 WebSocket 文本命令
+static void handleApiCmd() {
+  String cmd = httpServer.hasArg("c") ? httpServer.arg("c") : httpServer.arg("plain");
+  char reply[64];
+  if (cmd.length() == 0) {
+    sendApiError(400, "args", "c");
+    return;
+  }
+  if (!runApiCommand(cmd.c_str(), reply, sizeof(reply))) {
+    sendApiError(503, "timeout", "cmd");
+    return;
+  }
+  if (strncmp(reply, "ERR,", 4) == 0) {
+    sendApiError(apiErrorStatus(reply), reply + 4, "cmd");
+    return;
+  }
+  int n = snprintf(apiBuf, sizeof(apiBuf), "{\"ok\":true,\"reply\":\"%s\"}", reply);
+  sendJson(200, n > 0 && (size_t)n < sizeof(apiBuf) ? n : 0);
+}
+
+static void handleApiRuns() {
+  sendJson(200, buildApiRuns(apiBuf, sizeof(apiBuf)));
+}
+
+// ============ 日志下载 (/api/log, 网络任务中每轮写一块) ============
+// GET /api/log?run=id&fmt=csv|bin&decim=k — 默认最新 run, CSV, 不抽取。
+// 响应头直接写入连接, 两种格式都以关闭连接结束; 之后由 pumpLog() 分块读环形缓冲区写出,
+// 不占用控制核。下载中采样被环覆盖时提前结束并显式标记: CSV 写 "# truncated" 注释行,
+// bin 的结尾记录状态为 1。发送超时写出不完整时直接断开: bin 缺少结尾记录 / CSV 行数少于
+// 头部 samples= 即为中断。
+struct LogDownload {
+  bool       active;
+  bool       csv;
+  WiFiClient client;
+  uint32_t   seq, endSeq;
+  uint32_t   written;    // 已写出条数 (bin 结尾记录)
+  uint16_t   decim;
+};
+static LogDownload logDl;
+
+static void handleApiLog() {
+  RunInfo r;
+  long id = httpServer.hasArg("run") ? httpServer.arg("run").toInt() : 0;
+  bool found = id > 0 ? runLogFind((uint32_t)id, &r) : runLogRun(0, &r);
+  if (!found) {
+    sendApiError(404, "run", "not found");
+    return;
+  }
+  uint32_t start = max(r.startSeq, runLogOldestSeq());
+  if (r.endSeq <= start) {
+    sendApiError(410, "run", "overwritten");
+    return;
+  }
+  long decim = httpServer.hasArg("decim") ? httpServer.arg("decim").toInt() : 1;
+  bool csv = httpServer.arg("fmt") != "bin";
+  if (logDl.active) logDl.client.stop();
+
+  logDl.client = httpServer.client();
+  logDl.csv    = csv;
+  logDl.seq    = start;
+  logDl.endSeq = r.endSeq;   // 进行中的 run 取请求时刻为止
+  logDl.decim  = (uint16_t)constrain(decim, 1L, (long)CTRL_HZ);
+  logDl.written = 0;
+  logDl.active = true;
+
+  uint32_t count = (r.endSeq - start + logDl.decim - 1) / logDl.decim;
+  char hdr[320];
+  int n = snprintf(hdr, sizeof(hdr),
+                   "HTTP/1.1 200 OK\r\nContent-Type: %s\r\n"
+                   "Content-Disposition: attachment; filename=\"run%lu.%s\"\r\n"
+                   "Cache-Control: no-store\r\nConnection: close\r\n",
+                   csv ? "text/csv" : "application/octet-stream", (unsigned long)r.id,
+                   csv ? "csv" : "bin");
+  n += snprintf(hdr + n, sizeof(hdr) - n, "\r\n");
+  logDl.client.write((const uint8_t *)hdr, n);
+
+  if (csv) {
+    n = snprintf(hdr, sizeof(hdr),
+                 "# run=%lu kind=%s reason=%s startMs=%lu samples=%lu available=%lu decim=%u hz=%d\n",
+                 (unsigned long)r.id, r.kind == RUN_BENCH ? "BENCH" : "BAL",
+                 r.active ? "ACTIVE" : r.reason, (unsigned long)r.startMs,
+                 (unsigned long)(r.endSeq - r.startSeq), (unsigned long)(r.endSeq - start),
+                 (unsigned)logDl.decim, CTRL_HZ / RUNLOG_DECIM);
+    logDl.client.write((const uint8_t *)hdr, n);
+    logDl.client.write((const uint8_t *)runLogCsvHeader(), strlen(runLogCsvHeader()));
+  } else {
+    // 'R','L',版本,采样字节数, runId, 预计条数, 首条序号, 抽取, 采样率 (共 RUNLOG_BIN_HDR 字节)
+    // 之后为采样, 最后是结尾记录 'R','L','E',状态(0 完整 / 1 截断), 实际条数 uint32
+    uint8_t bin[RUNLOG_BIN_HDR] = {'R', 'L', 2, (uint8_t)sizeof(RunLogSample)};
+    uint32_t fields[3] = {r.id, count, start};
+    uint16_t rate[2] = {logDl.decim, (uint16_t)(CTRL_HZ / RUNLOG_DECIM)};
+    memcpy(bin + 4, fields, sizeof(fields));
+    memcpy(bin + 16, rate, sizeof(rate));
+    logDl.client.write(bin, sizeof(bin));
+  }
+}
+
+static void pumpLog() {
+  if (!logDl.active) return;
+  static char buf[1460];
+  size_t len = 0;
+  bool lost = false;
+
+  if (!logDl.client.connected()) {
+    logDl.active = false;
+    logDl.client.stop();
+    return;
+  }
+  // 游标与条数只在整块写出后提交
+  uint32_t seq = logDl.seq, written = logDl.written;
+  while (seq < logDl.endSeq) {
+    RunLogSample s;
+    if (runLogRead(seq, &s, 1) != 1) {
+      lost = true;
+      break;
+    }
+    if (logDl.csv) {
+      size_t n = runLogFormatCsv(s, buf + len, sizeof(buf) - len);
+      if (n == 0) break;   // 本块已满, 该条下一轮再写
+      len += n;
+    } else {
+      if (len + sizeof(s) > sizeof(buf)) break;
+      memcpy(buf + len, &s, sizeof(s));
+      len += sizeof(s);
+    }
+    seq += logDl.decim;
+    written++;
+  }
+  if (len && logDl.client.write((const uint8_t *)buf, len) != len) {
+    // 部分写出 (发送超时): 流中留下半条记录, 无法续写; 直接断开, 不写结尾记录,
+    // 客户端按 "缺结尾记录 = 连接中断" 处理, 不会被当作完整下载
+    logDl.client.stop();
+    logDl.active = false;
+    return;
+  }
+  logDl.seq = seq;
+  logDl.written = written;
+
+  bool done = lost || logDl.seq >= logDl.endSeq;
+  if (lost && logDl.csv) {
+    const char *note = "# truncated: samples overwritten during download\n";
+    logDl.client.write((const uint8_t *)note, strlen(note));
+  }
+  if (done && !logDl.csv) {
+    uint8_t trailer[RUNLOG_BIN_TRAILER] = {'R', 'L', 'E', (uint8_t)(lost ? 1 : 0)};
+    memcpy(trailer + 4, &logDl.written, 4);
+    logDl.client.write(trailer, sizeof(trailer));
+  }
+  if (done) {
+    logDl.client.stop();
+    logDl.active = false;
+  }
+}
+
+// ============ 网络任务侧 ============
 static void wsEvent(uint8_t num, WStype_t type, uint8_t *payload, size_t len) {
   switch (type) {
-  case WStype_CONNECTED: {
-    String pidMsg = buildWebPidMessage();
-    String cfgMsg = buildWebConfigMessage();
-    wsServer.sendTXT(num, pidMsg.c_str());
-    wsServer.sendTXT(num, cfgMsg.c_str());
+  case WStype_CONNECTED:
+    netQueuePush(inQueue, NET_CONNECT, num, nullptr, 0);
     break;
-  }
   case WStype_DISCONNECTED:
+    netQueuePush(inQueue, NET_DISCONNECT, num, nullptr, 0);
+    break;
+  case WStype_TEXT:
+    netQueuePush(inQueue, NET_TEXT, num, payload, len);
+    break;
+  case WStype_BIN:
+    netQueuePush(inQueue, NET_BINARY, num, payload, len);
+    break;
+  default:
+    break;
+  }
+}
+
+static void drainOutbound() {
+  static uint8_t buf[NET_MSG_MAX];
+  NetMsgHdr h;
+  while (netQueuePop(outQueue, &h, buf, sizeof(buf))) {
+    uint32_t t0 = micros();
+    if (h.kind == NET_BINARY) wsServer.sendBIN(h.client, buf, h.len);
+    else                      wsServer.sendTXT(h.client, buf, h.len);
+    uint32_t us = micros() - t0;
+    if (h.client < TEL_MAX_CLIENTS && us > clientSendUs[h.client]) clientSendUs[h.client] = us;
+  }
+}
+
+static void netTask(void *) {
+  for (;;) {
+    httpServer.handleClient();
+    pumpPage();
+    pumpLog();
+    wsServer.loop();
+    drainOutbound();
+    // 有出站消息时被 loop 提前唤醒, 否则 1 tick 后轮询 socket
+    ulTaskNotifyTake(pdTRUE, 1);
+  }
+}
+
+// ============ 控制侧 ============
+static bool wsSend(uint8_t client, const uint8_t *data, size_t len, bool binary) {
+  if (!netQueuePush(outQueue, binary ? NET_BINARY : NET_TEXT, client, data, len)) return false;
+  if (netTaskHandle) xTaskNotifyGive(netTaskHandle);
+  return true;
+}
+
+static uint32_t wsSendCost(uint8_t client) {
+  if (client >= TEL_MAX_CLIENTS) return 0;
+  return __atomic_exchange_n(&clientSendUs[client], 0, __ATOMIC_RELAXED);
+}
+
+static void wsBroadcast(const char *msg) {
+  telemetryHubBroadcast((const uint8_t *)msg, strlen(msg), false);
+}
+
+static void dispatchInbound(const NetMsgHdr &h, const uint8_t *payload) {
+  switch (h.kind) {
+  case NET_CONNECT: {
+    telemetryHubConnect(h.client);
+    char msg[64];
+    buildWebPidMessage(msg, sizeof(msg));
+    telemetryHubSendTo(h.client, msg);
+    buildWebConfigMessage(msg, sizeof(msg));
+    telemetryHubSendTo(h.client, msg);
+    if (lastHttpMsg[0]) telemetryHubSendTo(h.client, lastHttpMsg);
+    break;
+  }
+  case NET_DISCONNECT:
+    telemetryHubDisconnect(h.client);
     handleWebDisconnect();
     break;
-  case WStype_TEXT: {
-    String cmd;
-    cmd.reserve(len + 1);
-    for (size_t i = 0; i < len; i++) {
-      cmd += (char)payload[i];
+  case NET_TEXT: {
+    static char reply[64];
+    if (h.client == API_CLIENT) {
+      uint32_t seq;
+      if (h.len < 4) break;
+      memcpy(&seq, payload, 4);
+      // 认领失败 = 网络任务已超时撤销, 不执行
+      uint32_t expect = seq;
+      if (!__atomic_compare_exchange_n(&apiPendingSeq, &expect, 0, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+        break;
+      bool hasReply = handleWebCommand(h.client, payload + 4, h.len - 4, reply, sizeof(reply)) && reply[0];
+      strcpy(apiReply, hasReply ? reply : "");
+      __atomic_store_n(&apiDoneSeq, seq, __ATOMIC_RELEASE);
+      break;
+    }
+    bool hasReply = handleWebCommand(h.client, payload, h.len, reply, sizeof(reply)) && reply[0];
+    if (hasReply) {
+      telemetryHubSendTo(h.client, reply);
     }
-    handleWebTextCommand(cmd);
     break;
   }
-  default:
+  case NET_BINARY:
+    handleWebBinaryCommand(payload, h.len);
+    break;
+  case NET_HTTP_STAT:
+    memcpy(lastHttpMsg, payload, min((size_t)h.len, sizeof(lastHttpMsg) - 1));
+    lastHttpMsg[min((size_t)h.len, sizeof(lastHttpMsg) - 1)] = '\0';
+    wsBroadcast(lastHttpMsg);
     break;
   }
 }
@@ -67,33 +507,66 @@ void webInit() {
     M5.Lcd.printf("IP: %s\n", myIP.c_str());
   }
 
-  httpServer.on("/", []() { httpServer.send_P(200, "text/html", WEB_INDEX_HTML); });
+  static const char *httpHeaders[] = {"If-None-Match"};
+  httpServer.collectHeaders(httpHeaders, 1);
+  httpServer.on("/", handleIndex);
+  httpServer.on("/api/status", HTTP_GET, handleApiStatus);
+  httpServer.on("/api/params", HTTP_ANY, handleApiParams);
+  httpServer.on("/api/registers", HTTP_GET, handleApiRegisters);
+  httpServer.on("/api/diag", HTTP_GET, handleApiDiag);
+  httpServer.on("/api/cmd", HTTP_POST, handleApiCmd);
+  httpServer.on("/api/runs", HTTP_GET, handleApiRuns);
+  httpServer.on("/api/log", HTTP_GET, handleApiLog);
   httpServer.begin();
 
+  netQueueInit(inQueue, inStorage, sizeof(inStorage));
+  netQueueInit(outQueue, outStorage, sizeof(outStorage));
+  telemetryHubInit(wsSend, wsSendCost);
   wsServer.begin();
   wsServer.onEvent(wsEvent);
+
+  // loop() 运行在核 1; 网络任务放在核 0 与 WiFi 协议栈同核
+  xTaskCreatePinnedToCore(netTask, "net", NET_TASK_STACK, nullptr, NET_TASK_PRIO,
+                          &netTaskHandle, NET_TASK_CORE);
 }
 
 void webLoop() {
-  httpServer.handleClient();
-  wsServer.loop();
+  static uint8_t buf[128];   // 命令上限 96 字节, 超长帧截断后仍由解析器按超长拒绝
+  NetMsgHdr h;
+  deadlineBegin(DL_NET);
+  for (int i = 0; i < NET_IN_DRAIN_MAX && netQueuePop(inQueue, &h, buf, sizeof(buf)); i++)
+    dispatchInbound(h, buf);
+  deadlineEnd(DL_NET);
+}
+
+void webQueueStats(uint32_t *outUsed, uint32_t *outHigh, uint32_t *drops) {
+  *outUsed = netQueueUsed(outQueue);
+  *outHigh = outQueue.highWater;
+  *drops   = inQueue.drops + outQueue.drops;
 }
 
-void webBroadcastAngle() {
-  char msg[320];
-  buildWebAngleMessage(msg, sizeof(msg));
-  wsServer.broadcastTXT(msg);
+void webBroadcastLatency() {
+  char msg[400];
+  buildWebLatencyMessage(msg, sizeof(msg));
+  wsBroadcast(msg);
+}
 
-  buildWebTelemetryMessage(msg, sizeof(msg));
-  wsServer.broadcastTXT(msg);
+void webBroadcastDeadline() {
+  char msg[256];
+  buildWebDeadlineMessage(msg, sizeof(msg));
+  wsBroadcast(msg);
 }
 
-void webBroadcastMotor() {
-  char msg[160];
-  buildWebMotorMessage(msg, sizeof(msg));
-  wsServer.broadcastTXT(msg);
+void webBroadcastJoystick() {
+  char msg[128];
+  buildWebJoystickMessage(msg, sizeof(msg));
+  wsBroadcast(msg);
 }
 
 void webBroadcastText(const char* msg) {
-  wsServer.broadcastTXT(msg);
+  wsBroadcast(msg);
+}
+
+void webBroadcastBinary(const uint8_t *data, size_t len) {
+  telemetryHubBroadcast(data, len, true);
 }
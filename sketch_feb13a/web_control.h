@@ -1,21 +1,32 @@
 #pragma once
 /**
- * web_control.h — WiFi 连接 + HTTP 服务 + WebSocket 实时通信
+ * web_control.h — WiFi 连接 + HTTP 服务 + WebSocket 实时通信 (网络任务在核 0)
  */
 
 #include <Arduino.h>
 
-// WiFi + Web 服务器初始化
+// WiFi + Web 服务器初始化, 启动网络任务
 void webInit();
 
-// 主循环中调用 (处理 HTTP 和 WebSocket)
+// 主循环中调用: 处理网络任务转来的连接事件与命令 (不做 socket 操作)
 void webLoop();
 
-// 广播姿态数据到手机
-void webBroadcastAngle();
+// 出站队列占用 / 峰值 (字节) 与两方向累计丢弃条数
+void webQueueStats(uint32_t *outUsed, uint32_t *outHigh, uint32_t *drops);
 
-// 广播电机参数到手机
-void webBroadcastMotor();
+// 周期遥测由 telemetry_hub 按客户端订阅发送 (telemetryHubPump); 以下为一次性广播
+
+// 广播 CAN 时延探针统计
+void webBroadcastLatency();
+
+// 广播控制拍超时统计
+void webBroadcastDeadline();
+
+// 广播摇杆通道统计 (回传最近包时间戳, 页面计算往返时延)
+void webBroadcastJoystick();
 
 // 广播任意文本消息 (供 auto_tune 等模块使用)
 void webBroadcastText(const char* msg);
+
+// 广播二进制帧 (电机辨识采样块等)
+void webBroadcastBinary(const uint8_t *data, size_t len);
@@ -1,131 +1,493 @@
 #include "web_protocol.h"
 
 #include "auto_tune.h"
+#include "can_latency.h"
 #include "can_motor.h"
 #include "config.h"
+#include "deadline_monitor.h"
 #include "display.h"
+#include "gain_schedule.h"
 #include "globals.h"
 #include "imu_balance.h"
+#include "joystick_input.h"
+#include "motion_control.h"
+#include "motor_charact.h"
+#include "param_registry.h"
+#include "power_mgmt.h"
+#include "profiler.h"
+#include "spectrum.h"
+#include "standup.h"
+#include "supervisor.h"
+#include "telemetry_hub.h"
+#include "thermal_model.h"
+#include "web_control.h"
 
-String buildWebPidMessage() {
-  return "P," + String(Kp, 1) + "," + String(Ki, 1) + "," + String(Kd, 2);
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+// ============ 命令解析 (零堆分配) ============
+// 文本命令 "NAME,arg1,arg2,..." 复制到栈上定长缓冲区原地切分, 按命令表分发。
+// 超长/参数个数不符/数值越界的命令整条丢弃, 并向发送方回 ERR,name,reason。
+
+static const size_t WEB_CMD_MAX_LEN    = 96;
+static const int    WEB_CMD_MAX_TOKENS = 8;
+
+// 参数范围
+static const long  JOY_LIMIT    = 100;
+static const long  SPEED_LOOP_REG_MAX = 100000000L;
+static const float TRAJ_XY_LIMIT_MM   = 20000.0f;
+
+struct WebArgs {
+  const char *tok[WEB_CMD_MAX_TOKENS];  // tok[0] = 命令名
+  int         n;                        // 参数个数 (不含命令名)
+};
+
+struct WebCmdResult {
+  uint8_t client;
+  char  *reply;
+  size_t size;
+  bool   failed;
+};
+
+static void replyError(WebCmdResult &r, const char *name, const char *reason) {
+  r.failed = true;
+  if (r.reply && r.size)
+    snprintf(r.reply, r.size, "ERR,%s,%s", name, reason);
 }
 
-String buildWebConfigMessage() {
-  return "C," + String(ROBOT_WEIGHT_G) + "," + String(WHEEL_DIAMETER_MM);
+// 阻塞 CAN/NVS 操作 (20~240 ms) 超出心跳监督周期; 同 motorRegsPoll, 只在诊断模式或倒地时执行
+static bool blockingBusy() {
+  return !diagMode && !fallen;
 }
 
-void handleWebDisconnect() {
-  phoneX = 0;
-  phoneY = 0;
-  targetAngle = 0;
-  targetAngleFilt = 0;
+static bool argLong(const WebArgs &a, int i, long lo, long hi, long *out) {
+  if (i > a.n) return false;
+  char *end = nullptr;
+  long v = strtol(a.tok[i], &end, 10);
+  if (end == a.tok[i] || *end != '\0') return false;
+  if (v < lo || v > hi) return false;
+  *out = v;
+  return true;
 }
 
-void handleWebTextCommand(const String &cmd) {
-  if (cmd == "AT") {
-    autoTuneStart();
+static bool argFloat(const WebArgs &a, int i, float lo, float hi, float *out) {
+  if (i > a.n) return false;
+  char *end = nullptr;
+  float v = strtof(a.tok[i], &end);
+  if (end == a.tok[i] || *end != '\0') return false;
+  if (!(v >= lo && v <= hi)) return false;  // 同时拒绝 NaN
+  *out = v;
+  return true;
+}
+
+static bool argFlag(const WebArgs &a, int i, bool *out) {
+  long v = 0;
+  if (!argLong(a, i, 0, 1, &v)) return false;
+  *out = v != 0;
+  return true;
+}
+
+// ---- 命令处理 (参数已按命令表检查个数) ----
+static void cmdAutoTuneStart(const WebArgs &, WebCmdResult &) { autoTuneStart(); }
+static void cmdAutoTuneStop(const WebArgs &, WebCmdResult &) { autoTuneStop(); }
+
+// 摇杆: J,x,y (旧格式) 或 J,seq,clientMs,x,y
+static void cmdJoystick(const WebArgs &a, WebCmdResult &r) {
+  long seq = 0, ts = 0, jx = 0, jy = 0;
+  int xi = (a.n == 4) ? 3 : 1;
+  if (a.n == 3 ||
+      (a.n == 4 && (!argLong(a, 1, 0, 0xFFFF, &seq) || !argLong(a, 2, 0, LONG_MAX, &ts))) ||
+      !argLong(a, xi, -JOY_LIMIT, JOY_LIMIT, &jx) || !argLong(a, xi + 1, -JOY_LIMIT, JOY_LIMIT, &jy)) {
+    replyError(r, "J", "range");
     return;
   }
-  if (cmd == "AX") {
-    autoTuneStop();
+  joystickInput(JOY_SRC_WS, a.n == 4, (uint16_t)seq, (uint32_t)ts, (int)jx, (int)jy);
+}
+
+// 摇杆超时窗口: JT,ms
+static void cmdJoystickTimeout(const WebArgs &a, WebCmdResult &r) {
+  long ms = 0;
+  if (!argLong(a, 1, JOY_TIMEOUT_MIN_MS, JOY_TIMEOUT_MAX_MS, &ms)) {
+    replyError(r, "JT", "range");
     return;
   }
-  if (isAutoTuning()) return;
+  joystickSetTimeout(ms);
+  webBroadcastJoystick();
+}
 
-  if (cmd.startsWith("J,")) {
-    int jx = 0;
-    int jy = 0;
-    sscanf(cmd.c_str() + 2, "%d,%d", &jx, &jy);
-    phoneX = -jx;
-    phoneY = -jy;
-    targetAngle = phoneY * MOVE_ANGLE_GAIN;
+static void cmdPid(const WebArgs &a, WebCmdResult &r) {
+  float np = 0, ni = 0, nd = 0;
+  if (!argFloat(a, 1, 0, KP_MAX, &np) || !argFloat(a, 2, 0, KI_MAX, &ni) ||
+      !argFloat(a, 3, 0, KD_MAX, &nd)) {
+    replyError(r, "P", "range");
     return;
   }
+  Kp = np;
+  Ki = ni;
+  Kd = nd;
+  pidIntegral = 0;
+}
 
-  if (cmd.startsWith("P,")) {
-    float np = 0;
-    float ni = 0;
-    float nd = 0;
-    sscanf(cmd.c_str() + 2, "%f,%f,%f", &np, &ni, &nd);
-    Kp = np;
-    Ki = ni;
-    Kd = nd;
-    pidIntegral = 0;
+// 内部速度环参数 (RollerCAN FOC内环)
+static void cmdSpeedLoopGains(const WebArgs &a, WebCmdResult &r) {
+  long ikp = 0, iki = 0, ikd = 0;
+  if (!argLong(a, 1, 0, SPEED_LOOP_REG_MAX, &ikp) || !argLong(a, 2, 0, SPEED_LOOP_REG_MAX, &iki) ||
+      !argLong(a, 3, 0, SPEED_LOOP_REG_MAX, &ikd)) {
+    replyError(r, "G", "range");
     return;
   }
+  setMotorSpeedLoopGains(ikp, iki, ikd);
+}
 
-  // 内部速度环参数 (RollerCAN FOC内环)
-  if (cmd.startsWith("G,")) {
-    int32_t ikp = 0, iki = 0, ikd = 0;
-    sscanf(cmd.c_str() + 2, "%ld,%ld,%ld", &ikp, &iki, &ikd);
-    setMotorSpeedLoopGains(ikp, iki, ikd);
+// 增益调度表: GS,ip,is,iv,kpMul,kdMul 写单元; GSW 存 NVS; GSD 恢复默认; GSQ 读回
+static void cmdGainCell(const WebArgs &a, WebCmdResult &r) {
+  long ip = 0, is = 0, iv = 0;
+  float kpMul = 0, kdMul = 0;
+  if (!argLong(a, 1, 0, GS_PITCH_N - 1, &ip) || !argLong(a, 2, 0, GS_SPEED_N - 1, &is) ||
+      !argLong(a, 3, 0, GS_VIN_N - 1, &iv) || !argFloat(a, 4, 0, GS_MUL_MAX, &kpMul) ||
+      !argFloat(a, 5, 0, GS_MUL_MAX, &kdMul)) {
+    replyError(r, "GS", "range");
     return;
   }
+  gainScheduleSetCell(ip, is, iv, kpMul, kdMul);
+}
+
+static void broadcastGainSchedule() {
+  static char msg[768];
+  buildWebGainScheduleMessage(msg, sizeof(msg));
+  webBroadcastText(msg);
+}
+
+static void cmdGainSave(const WebArgs &, WebCmdResult &) {
+  gainScheduleSave();
+  broadcastGainSchedule();
+}
 
-  // 速度模式限流 (mA)
-  if (cmd.startsWith("IL,")) {
-    int32_t mA = 0;
-    sscanf(cmd.c_str() + 3, "%ld", &mA);
-    if (mA < 200) mA = 200;
-    if (mA > 3000) mA = 3000;
-    setMotorSpeedCurrentLimit(mA);
+static void cmdGainDefault(const WebArgs &, WebCmdResult &) {
+  gainScheduleReset();
+  broadcastGainSchedule();
+}
+
+static void cmdGainQuery(const WebArgs &, WebCmdResult &) {
+  broadcastGainSchedule();
+}
+
+// 速度模式限流 (mA), 超出范围钳位
+static void cmdSpeedCurrentLimit(const WebArgs &a, WebCmdResult &r) {
+  long mA = 0;
+  if (!argLong(a, 1, 0, 100000, &mA)) {
+    replyError(r, "IL", "range");
     return;
   }
+  setMotorSpeedCurrentLimit(constrain(mA, (long)SPEED_IL_MIN_MA, (long)SPEED_IL_MAX_MA));
+}
 
-  // 电机模式切换
-  if (cmd == "MS") {
-    setMotorModeAll(MODE_SPEED);
+// 参数表写入: PS,name,value; 成功回 PS,name,实际值
+static void cmdParamSet(const WebArgs &a, WebCmdResult &r) {
+  int idx = paramFind(a.tok[1]);
+  float v = 0;
+  if (idx < 0) {
+    replyError(r, "PS", "name");
     return;
   }
-  if (cmd == "MC") {
-    setMotorModeAll(MODE_CURRENT);
+  const ParamDef &p = paramDef(idx);
+  if (p.blocking && blockingBusy()) {
+    replyError(r, "PS", "busy");
     return;
   }
-  if (cmd == "MP") {
-    setMotorModeAll(MODE_POSITION);
+  if (!argFloat(a, 2, p.minV, p.maxV, &v) || !paramSet(idx, v)) {
+    replyError(r, "PS", "range");
     return;
   }
+  if (r.reply && r.size)
+    snprintf(r.reply, r.size, "PS,%s,%g", p.name, paramGet(idx));
+}
 
-  if (cmd == "R") {
-    setBenchStepTest(false);
-    stopMotors();
-    diagMode = true;
-    fallen = false;
-    drawMainUI();
+// 电机模式切换
+static void cmdModeSpeed(const WebArgs &, WebCmdResult &) { setMotorModeAll(MODE_SPEED); }
+static void cmdModeCurrent(const WebArgs &, WebCmdResult &) { setMotorModeAll(MODE_CURRENT); }
+static void cmdModePosition(const WebArgs &, WebCmdResult &) { setMotorModeAll(MODE_POSITION); }
+
+// 遥测订阅: SUB,channel,periodMs (channel 为 A/T/M/PW/TH/DL/JS/PF/LT/TS/K/ALL, 0 = 退订)
+static void cmdSubscribe(const WebArgs &a, WebCmdResult &r) {
+  long ms = 0;
+  if (!argLong(a, 2, 0, 60000, &ms) || !telemetryHubSubscribe(r.client, a.tok[1], ms)) {
+    replyError(r, "SUB", "range");
+  }
+}
+
+// 流控确认: ACK,累计收到帧数
+static void cmdAck(const WebArgs &a, WebCmdResult &r) {
+  long n = 0;
+  if (!argLong(a, 1, 0, LONG_MAX, &n)) {
+    replyError(r, "ACK", "range");
     return;
   }
+  telemetryHubAck(r.client, (uint32_t)n);
+}
 
-  if (cmd == "S") {
-    setBenchStepTest(false);
-    if (getMotorMode() != MODE_CURRENT) {
-      setMotorModeAll(MODE_CURRENT);
-    }
-    if (fallen) {
-      diagMode = true;
-      fallen   = false;
-      stableCount = STABLE_HOLD_COUNT;
-    }
-    activateBalance();
+// 控制拍超时统计清零
+static void cmdDeadlineReset(const WebArgs &, WebCmdResult &) {
+  deadlineReset();
+  webBroadcastDeadline();
+}
+
+// CAN 时延探针: LP,1 开启 (清空统计) / LP,0 关闭; LQ 读回
+static void cmdLatencyProbe(const WebArgs &a, WebCmdResult &r) {
+  bool on = false;
+  if (!argFlag(a, 1, &on)) {
+    replyError(r, "LP", "range");
+    return;
+  }
+  latencyProbeEnable(on);
+  webBroadcastLatency();
+}
+
+static void cmdLatencyQuery(const WebArgs &, WebCmdResult &) {
+  webBroadcastLatency();
+}
+
+// 频谱分析: SP,1 开始采样 (约 2s 后每秒上报 FS) / SP,0 停止
+static void cmdSpectrum(const WebArgs &a, WebCmdResult &r) {
+  bool on = false;
+  if (!argFlag(a, 1, &on)) {
+    replyError(r, "SP", "range");
     return;
   }
+  spectrumEnable(on);
+}
 
-  if (cmd == "B,1") {
-    setBenchStepTest(true);
+// 支架自立: SU,1 用规划电流曲线 / SU,0 只用恢复增益 (对比自立时间与峰值电流)
+static void cmdStandupProfile(const WebArgs &a, WebCmdResult &r) {
+  bool on = false;
+  if (!argFlag(a, 1, &on)) {
+    replyError(r, "SU", "range");
     return;
   }
+  standupEnable(on);
+}
 
-  if (cmd == "B,0") {
-    setBenchStepTest(false);
+// ---- 轨迹跟踪: 先入队 TV/TW, TG 开始, TX 中止并清空; 执行中可继续追加 ----
+// 定时点: TV,tMs,v_mm_s,w_dps (同一段内 tMs 递增, 线性插值)
+static void cmdTrajTimed(const WebArgs &a, WebCmdResult &r) {
+  long t = 0;
+  float v = 0, w = 0;
+  if (!argLong(a, 1, 0, 3600000L, &t) || !argFloat(a, 2, -MC_MAX_SPEED_MMS, MC_MAX_SPEED_MMS, &v) ||
+      !argFloat(a, 3, -MC_MAX_YAW_DPS, MC_MAX_YAW_DPS, &w)) {
+    replyError(r, "TV", "range");
     return;
   }
+  if (!motionQueueTimed((uint32_t)t, v, w)) replyError(r, "TV", "full");
+}
 
-  if (cmd == "E") {
+// 航点: TW,x_mm,y_mm,v_mm_s (TG 时位姿为原点, x 沿 linearSpeed 正方向)
+static void cmdTrajWaypoint(const WebArgs &a, WebCmdResult &r) {
+  float x = 0, y = 0, v = 0;
+  if (!argFloat(a, 1, -TRAJ_XY_LIMIT_MM, TRAJ_XY_LIMIT_MM, &x) ||
+      !argFloat(a, 2, -TRAJ_XY_LIMIT_MM, TRAJ_XY_LIMIT_MM, &y) || !argFloat(a, 3, 1.0f, MC_MAX_SPEED_MMS, &v)) {
+    replyError(r, "TW", "range");
+    return;
+  }
+  if (!motionQueueWaypoint(x, y, v)) replyError(r, "TW", "full");
+}
+
+static void cmdTrajGo(const WebArgs &, WebCmdResult &r) {
+  if (!motionStart()) replyError(r, "TG", "state");
+}
+
+static void cmdTrajStop(const WebArgs &, WebCmdResult &) { motionStop(); }
+
+// 架空轮电机特性辨识: CH,1 启动 / CH,0 中止
+static void cmdCharact(const WebArgs &a, WebCmdResult &r) {
+  bool on = false;
+  if (!argFlag(a, 1, &on)) {
+    replyError(r, "CH", "range");
+    return;
+  }
+  if (on) {
     setBenchStepTest(false);
-    diagMode = false;
-    fallen = true;
-    stopMotors();
-    pidIntegral = 0;
+    charactStart();
+  } else {
+    charactStop();
+  }
+}
+
+static void cmdReset(const WebArgs &, WebCmdResult &) {
+  charactStop();
+  setBenchStepTest(false);
+  stopMotors();
+  diagMode = true;
+  fallen = false;
+  drawMainUI();
+}
+
+static void cmdStand(const WebArgs &, WebCmdResult &) {
+  charactStop();
+  setBenchStepTest(false);
+  if (getMotorMode() != MODE_CURRENT) {
+    setMotorModeAll(MODE_CURRENT);
+  }
+  if (fallen) {
+    diagMode = true;
+    fallen   = false;
+    stableCount = STABLE_HOLD_COUNT;
+  }
+  supervisorClear();
+  activateBalance();
+}
+
+static void cmdBenchStep(const WebArgs &a, WebCmdResult &r) {
+  bool on = false;
+  if (!argFlag(a, 1, &on)) {
+    replyError(r, "B", "range");
+    return;
+  }
+  if (on) charactStop();
+  setBenchStepTest(on);
+}
+
+static void cmdEmergencyStop(const WebArgs &, WebCmdResult &) {
+  charactStop();
+  setBenchStepTest(false);
+  diagMode = false;
+  fallen = true;
+  stopMotors();
+  pidIntegral = 0;
+}
+
+// ============ 命令表 ============
+struct WebCmd {
+  const char *name;
+  uint8_t     minArgs;
+  uint8_t     maxArgs;
+  bool        duringTune;  // 自动调参进行中是否仍然受理
+  bool        blocking;    // 阻塞 CAN/NVS 操作: 平衡中拒绝 (blockingBusy)
+  void (*fn)(const WebArgs &, WebCmdResult &);
+};
+
+static const WebCmd WEB_CMDS[] = {
+  {"AT",  0, 0, true,  false, cmdAutoTuneStart},
+  {"AX",  0, 0, true,  false, cmdAutoTuneStop},
+  {"J",   2, 4, false, false, cmdJoystick},
+  {"JT",  1, 1, false, false, cmdJoystickTimeout},
+  {"P",   3, 3, false, false, cmdPid},
+  {"G",   3, 3, false, true,  cmdSpeedLoopGains},
+  {"GS",  5, 5, false, false, cmdGainCell},
+  {"GSW", 0, 0, false, true,  cmdGainSave},
+  {"GSD", 0, 0, false, false, cmdGainDefault},
+  {"GSQ", 0, 0, false, false, cmdGainQuery},
+  {"IL",  1, 1, false, true,  cmdSpeedCurrentLimit},
+  {"PS",  2, 2, false, false, cmdParamSet},      // 阻塞与否按参数, 见 ParamDef::blocking
+  {"MS",  0, 0, false, true,  cmdModeSpeed},
+  {"MC",  0, 0, false, true,  cmdModeCurrent},
+  {"MP",  0, 0, false, true,  cmdModePosition},
+  {"DLR", 0, 0, false, false, cmdDeadlineReset},
+  {"SUB", 2, 2, true,  false, cmdSubscribe},
+  {"ACK", 1, 1, true,  false, cmdAck},
+  {"LP",  1, 1, false, false, cmdLatencyProbe},
+  {"LQ",  0, 0, false, false, cmdLatencyQuery},
+  {"SP",  1, 1, true,  false, cmdSpectrum},
+  {"CH",  1, 1, false, false, cmdCharact},
+  {"SU",  1, 1, false, false, cmdStandupProfile},
+  {"TV",  3, 3, false, false, cmdTrajTimed},
+  {"TW",  3, 3, false, false, cmdTrajWaypoint},
+  {"TG",  0, 0, false, false, cmdTrajGo},
+  {"TX",  0, 0, true,  false, cmdTrajStop},
+  {"R",   0, 0, false, false, cmdReset},
+  {"S",   0, 0, false, false, cmdStand},
+  {"B",   1, 1, false, false, cmdBenchStep},
+  {"E",   0, 0, false, false, cmdEmergencyStop},
+};
+static const int WEB_CMD_N = sizeof(WEB_CMDS) / sizeof(WEB_CMDS[0]);
+
+void buildWebPidMessage(char *msg, size_t size) {
+  snprintf(msg, size, "P,%.1f,%.1f,%.2f", Kp, Ki, Kd);
+}
+
+void buildWebConfigMessage(char *msg, size_t size) {
+  snprintf(msg, size, "C,%d,%d", (int)ROBOT_WEIGHT_G, (int)WHEEL_DIAMETER_MM);
+}
+
+void handleWebDisconnect() {
+  joystickReset();
+  targetAngleFilt = 0;
+}
+
+bool handleWebCommand(uint8_t client, const uint8_t *payload, size_t len, char *reply, size_t replySize) {
+  WebCmdResult r = {client, reply, replySize, false};
+  if (reply && replySize) reply[0] = '\0';
+
+  char buf[WEB_CMD_MAX_LEN + 1];
+  if (len == 0) return false;
+  if (len > WEB_CMD_MAX_LEN) {
+    replyError(r, "?", "length");
+    return true;
+  }
+  memcpy(buf, payload, len);
+  buf[len] = '\0';
+
+  // 原地切分: ',' → '\0'
+  WebArgs a;
+  a.n = 0;
+  a.tok[0] = buf;
+  for (char *p = buf; *p; p++) {
+    if (*p != ',') continue;
+    if (a.n + 1 >= WEB_CMD_MAX_TOKENS) {
+      replyError(r, buf, "args");
+      return true;
+    }
+    *p = '\0';
+    a.tok[++a.n] = p + 1;
+  }
+
+  for (int i = 0; i < WEB_CMD_N; i++) {
+    const WebCmd &c = WEB_CMDS[i];
+    if (strcmp(c.name, a.tok[0]) != 0) continue;
+    if (!c.duringTune && isAutoTuning()) {
+      replyError(r, c.name, "busy");   // 明确告知被拒, 不静默丢弃
+      return true;
+    }
+    if (c.blocking && blockingBusy()) {
+      replyError(r, c.name, "busy");
+      return true;
+    }
+    if (a.n < c.minArgs || a.n > c.maxArgs) {
+      replyError(r, c.name, "args");
+      return true;
+    }
+    c.fn(a, r);
+    return r.failed || (reply && reply[0]);
+  }
+  replyError(r, a.tok[0], "unknown");
+  return true;
+}
+
+bool handleWebBinaryCommand(const uint8_t *payload, size_t len) {
+  if (len == 0) return false;
+  switch (payload[0]) {
+  case WEB_BIN_JOYSTICK: {
+    // 旧: [0]='J' [1..2]=x [3..4]=y
+    // 新: [0]='J' [1..2]=seq uint16 [3..6]=clientMs uint32 [7..8]=x [9..10]=y (均为 LE)
+    if (isAutoTuning()) return false;
+    bool hasSeq = (len >= 11);
+    if (!hasSeq && len < 5) return false;
+    uint16_t seq = 0;
+    uint32_t ts = 0;
+    int16_t jx, jy;
+    const uint8_t *xy = payload + 1;
+    if (hasSeq) {
+      memcpy(&seq, payload + 1, 2);
+      memcpy(&ts, payload + 3, 4);
+      xy = payload + 7;
+    }
+    memcpy(&jx, xy, 2);
+    memcpy(&jy, xy + 2, 2);
+    if (abs(jx) > JOY_LIMIT || abs(jy) > JOY_LIMIT) return false;
+    return joystickInput(JOY_SRC_WS, hasSeq, seq, ts, jx, jy);
+  }
+  default:
+    return false;
   }
 }
 
@@ -144,14 +506,15 @@ void buildWebTelemetryMessage(char *msg, size_t size) {
   float controlPitch = currentPitch + PITCH_MOUNT_OFFSET;
   unsigned long nowMs = millis();
 
-  // T,...,benchMode,canTxFailCount
+  // T,...,benchMode,canTxFailCount,benchStartRpm
   snprintf(msg, size,
-           "T,%lu,%.2f,%.2f,%.2f,%.1f,%d,%d,%d,%d,%.3f,%.4f,%.2f,%.2f,%.1f,%.1f,%.1f,%.1f,%d,%d,%.2f,%.1f,%.1f,%.0f,%d,%d,%d,%lu",
+           "T,%lu,%.2f,%.2f,%.2f,%.1f,%d,%d,%d,%d,%.3f,%.4f,%.2f,%.2f,%.1f,%.1f,%.1f,%.1f,%d,%d,%.2f,%.1f,%.1f,%.0f,%d,%d,%d,%lu,%d",
            nowMs, controlPitch, targetAngleFilt, gyroRate, pidOutput, cmdSpdR, cmdSpdL,
            actualSpdR, actualSpdL, linearSpeed / 1000.0f, distanceMM / 1000.0f,
            vinR, vinL, actualCurrentR, actualCurrentL, motorTempR, motorTempL,
            fallen ? 1 : 0, diagMode ? 1 : 0,
-           ctrlDtMs, dbgPidRaw, dbgPidClamped, dbgAfterDeadzone, dbgSentR, dbgSentL, benchMode ? 1 : 0, canTxFailCount);
+           ctrlDtMs, dbgPidRaw, dbgPidClamped, dbgAfterDeadzone, dbgSentR, dbgSentL, benchMode ? 1 : 0, canTxFailCount,
+           benchStepStartRpm());
 }
 
 void buildWebMotorMessage(char *msg, size_t size) {
@@ -161,3 +524,87 @@ void buildWebMotorMessage(char *msg, size_t size) {
            vinR, vinL, actualCurrentR, actualCurrentL,
            motorTempR, motorTempL);
 }
+
+void buildWebGainScheduleMessage(char *msg, size_t size) {
+  // GT,nPitch,nSpeed,nVin,pitchStep,speedStep,vinMin,vinStep,{kp,kd}... (vin→speed→pitch 顺序)
+  int n = snprintf(msg, size, "GT,%d,%d,%d,%.1f,%.0f,%.1f,%.1f",
+                   GS_PITCH_N, GS_SPEED_N, GS_VIN_N,
+                   GS_PITCH_STEP, GS_SPEED_STEP, GS_VIN_MIN, GS_VIN_STEP);
+  for (int iv = 0; iv < GS_VIN_N; iv++) {
+    for (int is = 0; is < GS_SPEED_N; is++) {
+      for (int ip = 0; ip < GS_PITCH_N; ip++) {
+        if (n < 0 || (size_t)n >= size) return;
+        GainScale c = gainScheduleGetCell(ip, is, iv);
+        n += snprintf(msg + n, size - n, ",%.3f,%.3f", c.kp, c.kd);
+      }
+    }
+  }
+}
+
+void buildWebPowerMessage(char *msg, size_t size) {
+  const PowerStatus &p = powerStatus();
+  // PW,vbus,vbusMin,voc,rint,soc,ibus,budgetMa,comp,warn,limitCount
+  snprintf(msg, size, "PW,%.2f,%.2f,%.2f,%.3f,%.0f,%.2f,%d,%.3f,%d,%lu",
+           p.vbus, p.vbusMin, p.voc, p.rint, p.soc, p.ibus, p.budgetMa, p.comp,
+           p.warn, (unsigned long)p.limitCount);
+}
+
+void buildWebThermalMessage(char *msg, size_t size) {
+  const ThermalState &r = thermalState(THERMAL_R);
+  const ThermalState &l = thermalState(THERMAL_L);
+  // TH,windR,windL,ambR,ambL,limR,limL,i2tR%,i2tL%,calErrR,calErrL
+  snprintf(msg, size, "TH,%.1f,%.1f,%.1f,%.1f,%d,%d,%.0f,%.0f,%.1f,%.1f",
+           r.windingDeg, l.windingDeg, r.ambientDeg, l.ambientDeg,
+           r.limitMa, l.limitMa, r.i2tUsed * 100.0f, l.i2tUsed * 100.0f,
+           r.calErrDeg, l.calErrDeg);
+}
+
+void buildWebLatencyMessage(char *msg, size_t size) {
+  // LT,enabled,{count,p50,p99,max,lost}× (ACK R/L, RESP R/L, READ R/L), 单位 µs
+  int n = snprintf(msg, size, "LT,%d", latencyProbeEnabled() ? 1 : 0);
+  const uint8_t ids[] = {MOTOR_R, MOTOR_L};
+  for (int t = 0; t < LAT_TYPES; t++) {
+    for (int m = 0; m < 2; m++) {
+      if (n < 0 || (size_t)n >= size) return;
+      LatencyStats s = latencyStats(t, ids[m]);
+      n += snprintf(msg + n, size - n, ",%lu,%lu,%lu,%lu,%lu",
+                    (unsigned long)s.count, (unsigned long)s.p50Us, (unsigned long)s.p99Us,
+                    (unsigned long)s.maxUs, (unsigned long)s.lost);
+    }
+  }
+}
+
+void buildWebProfileMessage(char *msg, size_t size) {
+  // PF,windowMs,{stage,count,minUs,meanUs,p99Us,maxUs}...
+  int n = snprintf(msg, size, "PF,%lu", (unsigned long)profWindowMs());
+  for (int s = 0; s < PROF_STAGE_N; s++) {
+    if (n < 0 || (size_t)n >= size) return;
+    const ProfStats &p = profStats((ProfStage)s);
+    n += snprintf(msg + n, size - n, ",%s,%lu,%.1f,%.1f,%.1f,%.1f",
+                  profStageName((ProfStage)s), (unsigned long)p.count,
+                  p.minUs, p.meanUs, p.p99Us, p.maxUs);
+  }
+}
+
+void buildWebDeadlineMessage(char *msg, size_t size) {
+  const DeadlineStats &d = deadlineStats();
+  // DL,S,ticks,late,skipped,maxLateUs,events,lostEvents,{tag:misses}...
+  int n = snprintf(msg, size, "DL,S,%lu,%lu,%lu,%lu,%lu,%lu",
+                   (unsigned long)d.ticks, (unsigned long)d.late, (unsigned long)d.skipped,
+                   (unsigned long)d.maxLateUs, (unsigned long)d.events, (unsigned long)d.lostEvents);
+  for (int t = 0; t < DL_TAG_N; t++) {
+    if (n < 0 || (size_t)n >= size) return;
+    n += snprintf(msg + n, size - n, ",%s:%lu", deadlineTagName((DlTag)t),
+                  (unsigned long)d.missByTag[t]);
+  }
+}
+
+void buildWebJoystickMessage(char *msg, size_t size) {
+  JoystickStats j = joystickLatchStats();
+  // JS,rx,rejected,timeouts,lastSeq,echoTs,holdMs,intervalMeanMs,intervalMaxMs,jitterMaxMs,timeoutMs
+  snprintf(msg, size, "JS,%lu,%lu,%lu,%u,%lu,%lu,%.1f,%lu,%lu,%u",
+           (unsigned long)j.rx, (unsigned long)j.rejected, (unsigned long)j.timeouts,
+           (unsigned)j.lastSeq, (unsigned long)j.echoTs, (unsigned long)j.holdMs,
+           j.intervalMeanMs, (unsigned long)j.intervalMaxMs, (unsigned long)j.jitterMaxMs,
+           (unsigned)j.timeoutMs);
+}
@@ -2,12 +2,27 @@
 
 #include <Arduino.h>
 
-String buildWebPidMessage();
-String buildWebConfigMessage();
+// 二进制命令操作码 (帧首字节)
+#define WEB_BIN_JOYSTICK 'J'
+
+void buildWebPidMessage(char *msg, size_t size);
+void buildWebConfigMessage(char *msg, size_t size);
 
 void handleWebDisconnect();
-void handleWebTextCommand(const String &cmd);
+
+// 文本命令: 直接解析 payload (不分配堆内存); 需回复发送方时写入 reply 并返回 true
+bool handleWebCommand(uint8_t client, const uint8_t *payload, size_t len, char *reply, size_t replySize);
+
+// 二进制命令 (摇杆等高频包), 返回是否受理
+bool handleWebBinaryCommand(const uint8_t *payload, size_t len);
 
 void buildWebAngleMessage(char *msg, size_t size);
 void buildWebTelemetryMessage(char *msg, size_t size);
 void buildWebMotorMessage(char *msg, size_t size);
+void buildWebGainScheduleMessage(char *msg, size_t size);
+void buildWebPowerMessage(char *msg, size_t size);
+void buildWebThermalMessage(char *msg, size_t size);
+void buildWebLatencyMessage(char *msg, size_t size);
+void buildWebProfileMessage(char *msg, size_t size);
+void buildWebDeadlineMessage(char *msg, size_t size);
+void buildWebJoystickMessage(char *msg, size_t size);
@@ -1,1023 +1,1023 @@
+// 由 tools/gen_web_ui.py 从 web_ui/index.html 生成, 请勿手改
+// 原始 50528 字节 → gzip 16238 字节
 #include "web_ui_page.h"
 
-const char WEB_INDEX_HTML[] PROGMEM = R"rawliteral(
-<!DOCTYPE html>
-<html lang="zh-CN">
-<head>
-<meta charset="UTF-8">
-<meta name="viewport" content="width=device-width, initial-scale=1, user-scalable=no">
-<title>自平衡机器人控制台</title>
-<script src="https://cdn.jsdelivr.net/npm/chart.js"></script>
-<style>
-:root {
-  --bg: #0b1219;
-  --panel: #151f2b;
-  --panel-soft: #101925;
-  --line: #253244;
-  --text: #d9e7f3;
-  --muted: #8aa0b5;
-  --ok: #57c785;
-  --warn: #f0b429;
-  --err: #ef6b6b;
-  --a1: #4fc3f7;
-  --a2: #ffc857;
-  --a3: #f687b3;
-  --a4: #72e4b6;
-}
-* { box-sizing: border-box; margin: 0; padding: 0; }
-body {
-  font-family: "Segoe UI", "PingFang SC", "Microsoft YaHei", sans-serif;
-  color: var(--text);
-  background: radial-gradient(circle at top right, #172334 0%, #0b1219 56%);
-  min-height: 100vh;
-}
-.container {
-  display: grid;
-  grid-template-columns: 360px 1fr;
-  gap: 10px;
-  padding: 10px;
-  height: 100vh;
-}
-.left-panel, .right-panel {
-  min-height: 0;
-  display: flex;
-  flex-direction: column;
-  gap: 10px;
-}
-.left-panel { overflow-y: auto; }
-.panel {
-  background: linear-gradient(180deg, var(--panel) 0%, var(--panel-soft) 100%);
-  border: 1px solid var(--line);
-  border-radius: 10px;
-  padding: 10px;
-}
-h2 { font-size: 18px; color: var(--a1); letter-spacing: 0.5px; }
-h3 {
-  display: flex;
-  justify-content: space-between;
-  align-items: center;
-  font-size: 13px;
-  color: var(--a1);
-  border-bottom: 1px solid rgba(255,255,255,0.06);
-  padding-bottom: 6px;
-  margin-bottom: 8px;
-}
-.status-bar { display: flex; flex-wrap: wrap; gap: 8px; font-size: 12px; }
-.badge {
-  padding: 4px 10px;
-  border-radius: 14px;
-  border: 1px solid var(--line);
-  background: #1a2431;
-  color: var(--muted);
-}
-.badge.on { color: #08140f; background: var(--ok); border-color: transparent; }
-.badge.warn { color: #1f1400; background: var(--warn); border-color: transparent; }
-.badge.err { color: #2a0303; background: var(--err); border-color: transparent; }
-
-.view-3d {
-  position: relative;
-  height: 230px;
-  border: 1px solid var(--line);
-  border-radius: 8px;
-  overflow: hidden;
-  background: radial-gradient(circle at center, #17243a 0%, #0a1118 70%);
-}
-canvas#c3d { width: 100%; height: 100%; display: block; }
-.overlay-info {
-  position: absolute;
-  top: 8px;
-  left: 8px;
-  font-size: 12px;
-  color: #b7cada;
-  line-height: 1.35;
-  background: rgba(0,0,0,0.25);
-  border: 1px solid rgba(255,255,255,0.08);
-  border-radius: 6px;
-  padding: 4px 6px;
-}
-.key-hint {
-  position: absolute;
-  right: 8px;
-  bottom: 8px;
-  font-size: 11px;
-  text-align: right;
-  color: #8da2b8;
-}
-
-.kpi-grid {
-  display: grid;
-  grid-template-columns: repeat(2, minmax(0, 1fr));
-  gap: 6px;
-  font-size: 12px;
-}
-.kpi {
-  border: 1px solid var(--line);
-  border-radius: 6px;
-  padding: 6px;
-  background: rgba(0,0,0,0.15);
-}
-.kpi .label { color: var(--muted); font-size: 11px; }
-.kpi .value { color: #f7f3d8; font-family: ui-monospace, SFMono-Regular, Menlo, Consolas, monospace; font-size: 14px; }
-
-.pid-ctrl { display: flex; flex-direction: column; gap: 8px; }
-.slider-row { display: flex; align-items: center; gap: 8px; }
-.slider-row label { width: 24px; color: var(--muted); font-size: 12px; }
-.slider-row input { flex: 1; accent-color: var(--a1); }
-.slider-row .val { width: 50px; text-align: right; color: #f6cf65; font-family: ui-monospace, SFMono-Regular, Menlo, Consolas, monospace; font-size: 12px; }
-
-.btn-row { display: flex; flex-wrap: wrap; gap: 8px; }
-.btn {
-  flex: 1;
-  min-width: 88px;
-  padding: 10px 12px;
-  border: none;
-  border-radius: 6px;
-  font-size: 13px;
-  font-weight: 700;
-  color: white;
-  cursor: pointer;
-}
-.btn:active { transform: scale(0.98); }
-.btn.cal { background: #e69500; }
-.btn.run { background: #268a5f; }
-.btn.stop { background: #be4040; }
-.btn.sm {
-  flex: initial;
-  min-width: initial;
-  padding: 4px 8px;
-  font-size: 11px;
-  background: #2a3748;
-}
-
-.pc-keys { display: grid; grid-template-columns: repeat(3, 34px); gap: 5px; justify-content: center; }
-.key {
-  width: 34px;
-  height: 34px;
-  border-radius: 6px;
-  background: #293647;
-  color: #c8d7e6;
-  display: flex;
-  align-items: center;
-  justify-content: center;
-  font-size: 12px;
-}
-.key.active { background: var(--a1); color: #00111e; }
-.key.w { grid-column: 2; }
-.key.a { grid-column: 1; grid-row: 2; }
-.key.s { grid-column: 2; grid-row: 2; }
-.key.d { grid-column: 3; grid-row: 2; }
-
-.header-strip {
-  display: grid;
-  grid-template-columns: repeat(5, minmax(0, 1fr));
-  gap: 8px;
-  font-size: 12px;
-}
-.header-cell {
-  border: 1px solid var(--line);
-  border-radius: 8px;
-  background: rgba(0,0,0,0.2);
-  padding: 6px;
-}
-.header-cell .l { color: var(--muted); font-size: 11px; }
-.header-cell .v { font-family: ui-monospace, SFMono-Regular, Menlo, Consolas, monospace; color: #ffe59c; }
-
-.chart-grid {
-  display: grid;
-  grid-template-columns: repeat(3, minmax(0, 1fr));
-  gap: 8px;
-}
-.chart-box {
-  border: 1px solid var(--line);
-  border-radius: 8px;
-  background: rgba(0,0,0,0.18);
-  padding: 6px;
-  height: 180px;
-}
-.chart-title {
-  font-size: 11px;
-  color: var(--muted);
-  margin-bottom: 4px;
-}
-
-.monitor-panel { flex: 1; min-height: 0; }
-.monitor-table-wrap {
-  height: 100%;
-  border: 1px solid var(--line);
-  border-radius: 8px;
-  overflow: auto;
-  background: #090f16;
-}
-.monitor-table {
-  width: 100%;
-  border-collapse: collapse;
-  font-family: ui-monospace, SFMono-Regular, Menlo, Consolas, monospace;
-  font-size: 11px;
-  min-width: 1360px;
-}
-.monitor-table th {
-  position: sticky;
-  top: 0;
-  z-index: 1;
-  background: #151f2b;
-  color: var(--muted);
-  padding: 4px 6px;
-  text-align: right;
-  border-bottom: 1px solid var(--line);
-  white-space: nowrap;
-}
-.monitor-table td {
-  padding: 3px 6px;
-  text-align: right;
-  border-bottom: 1px solid #101824;
-  white-space: nowrap;
-}
-.monitor-table tr:hover { background: #101923; }
-tr.run-marker td {
-  text-align: left;
-  font-weight: 700;
-  color: #d6e7ff;
-  background: #1d2b3e;
-  border-bottom: 1px solid #2c415d;
-}
-tr.run-end td {
-  color: #ffe0a8;
-  background: #2a1f13;
-  border-bottom: 1px solid #5d4329;
-}
-
-::-webkit-scrollbar { width: 8px; height: 8px; }
-::-webkit-scrollbar-thumb { background: #2a3748; border-radius: 5px; }
-::-webkit-scrollbar-track { background: #0e1621; }
-
-@media (max-width: 1180px) {
-  .container { grid-template-columns: 1fr; height: auto; }
-  .left-panel { max-height: none; overflow: visible; }
-  .chart-grid { grid-template-columns: 1fr; }
-  .header-strip { grid-template-columns: repeat(2, minmax(0, 1fr)); }
-}
-</style>
-</head>
-<body>
-<div class="container">
-  <div class="left-panel">
-    <h2>自平衡机器人</h2>
-
-    <div class="status-bar">
-      <div id="ws-st" class="badge">未连接</div>
-      <div id="bot-st" class="badge">待机</div>
-      <div id="mode-st" class="badge">DIAG</div>
-      <div id="bat-st" class="badge">-- V</div>
-    </div>
-
-    <div class="view-3d">
-      <canvas id="c3d"></canvas>
-      <div class="overlay-info">
-        Pitch: <span id="val-p">0.0</span>°<br>
-        Roll: <span id="val-r">0.0</span>°<br>
-        Yaw: <span id="val-y">0.0</span>°<br>
-        Gyro: <span id="val-g">0.0</span>°/s
-      </div>
-      <div class="key-hint">WASD 控制<br>Q 启动 / E 急停</div>
-    </div>
-
-    <div class="pc-keys">
-      <div class="key w" id="k-w">W</div>
-      <div class="key a" id="k-a">A</div>
-      <div class="key s" id="k-s">S</div>
-      <div class="key d" id="k-d">D</div>
-    </div>
-
-    <div class="panel">
-      <h3>实时关键量</h3>
-      <div class="kpi-grid">
-        <div class="kpi"><div class="label">整车重量</div><div class="value" id="kpi-weight">-- g</div></div>
-        <div class="kpi"><div class="label">车轮直径</div><div class="value" id="kpi-wheel">-- mm</div></div>
-        <div class="kpi"><div class="label">目标角</div><div class="value" id="kpi-target">0.00°</div></div>
-        <div class="kpi"><div class="label">PID 输出</div><div class="value" id="kpi-pid">0.0</div></div>
-        <div class="kpi"><div class="label">线速度</div><div class="value" id="kpi-speed">0.000 m/s</div></div>
-        <div class="kpi"><div class="label">路程</div><div class="value" id="kpi-dist">0.000 m</div></div>
-        <div class="kpi"><div class="label">Cmd RPM</div><div class="value" id="kpi-cmd">0 / 0</div></div>
-        <div class="kpi"><div class="label">Act RPM</div><div class="value" id="kpi-act">0 / 0</div></div>
-      </div>
-    </div>
-
-    <div class="panel">
-      <h3>PID 参数调节</h3>
-      <div class="pid-ctrl">
-        <div class="slider-row"><label>Kp</label><input type="range" id="rp" min="0" max="40" step="0.5" value="12"><div class="val" id="vp">12.0</div></div>
-        <div class="slider-row"><label>Ki</label><input type="range" id="ri" min="0" max="10" step="0.1" value="0"><div class="val" id="vi">0.0</div></div>
-        <div class="slider-row"><label>Kd</label><input type="range" id="rd" min="0" max="10" step="0.05" value="0.5"><div class="val" id="vd">0.5</div></div>
-      </div>
-    </div>
-
-    <div class="btn-row">
-      <button class="btn run" onclick="send('S')">启动平衡</button>
-      <button class="btn stop" onclick="send('E')">急停</button>
-      <button class="btn cal" id="at-btn" onclick="toggleAutoTune()">自动调参</button>
-    </div>
-
-    <div class="panel" id="at-panel" style="display:none">
-      <h3>自动调参 <button class="btn sm" onclick="send('AX')">停止</button></h3>
-      <div style="font-size:12px;line-height:1.6">
-        <div>阶段: <span id="at-phase" style="color:var(--a1)">--</span></div>
-        <div>当前值: <span id="at-cur" style="color:var(--a2)">--</span> &nbsp; 试次: <span id="at-trial">--</span></div>
-        <div>最佳值: <span id="at-best" style="color:var(--ok)">--</span> &nbsp; 存活: <span id="at-score" style="color:var(--ok)">--</span></div>
-        <div>进度: <span id="at-prog">--</span></div>
-        <div style="margin-top:4px">
-          <div style="height:6px;background:#1a2431;border-radius:3px;overflow:hidden">
-            <div id="at-bar" style="height:100%;width:0%;background:var(--a1);transition:width 0.3s"></div>
-          </div>
-        </div>
-        <div id="at-log" style="margin-top:6px;max-height:100px;overflow-y:auto;font-family:monospace;font-size:11px;color:var(--muted)"></div>
-      </div>
-    </div>
-  </div>
-
-  <div class="right-panel">
-    <div class="header-strip">
-      <div class="header-cell"><div class="l">K</div><div class="v" id="k-val">--</div></div>
-      <div class="header-cell"><div class="l">目标角</div><div class="v" id="t-val">0.0°</div></div>
-      <div class="header-cell"><div class="l">电压 (R/L)</div><div class="v" id="vin-val">-- / -- V</div></div>
-      <div class="header-cell"><div class="l">电流 (R/L)</div><div class="v" id="cur-val">-- / -- mA</div></div>
-      <div class="header-cell"><div class="l">温度 (R/L)</div><div class="v" id="tmp-val">-- / -- C</div></div>
-    </div>
-
-    <div class="panel">
-      <h3>多维实时可视化</h3>
-      <div class="chart-grid">
-        <div class="chart-box"><div class="chart-title">姿态: Pitch / Target / Roll</div><canvas id="chart-angle"></canvas></div>
-        <div class="chart-box"><div class="chart-title">控制: PID / Gyro / Speed</div><canvas id="chart-ctrl"></canvas></div>
-        <div class="chart-box"><div class="chart-title">电机: Cmd/Act RPM + Current</div><canvas id="chart-motor"></canvas></div>
-      </div>
-    </div>
-
-    <div class="panel monitor-panel">
-      <h3>
-        闭环日志（每次站立到跌倒完整保留）
-        <div>
-          <button class="btn sm" onclick="copyTable()">复制全部</button>
-          <button class="btn sm" onclick="copyLastRun()">复制最近闭环</button>
-          <button class="btn sm" onclick="clearTable()">清空</button>
-        </div>
-      </h3>
-      <div class="monitor-table-wrap" id="table-wrap">
-        <table class="monitor-table" id="monitor-table">
-          <thead>
-          <tr>
-            <th>#</th><th>Run</th><th>t(ms)</th><th>age(ms)</th><th>dt(ms)</th>
-            <th>Pitch</th><th>Target</th><th>Gyro</th><th>PID</th><th>dtCtrl</th>
-            <th>uRaw</th><th>uClamp</th><th>uDZ</th><th>uSendR</th><th>uSendL</th>
-            <th>CmdR</th><th>CmdL</th><th>ActR</th><th>ActL</th>
-            <th>Speed(m/s)</th><th>Dist(m)</th>
-            <th>VinR</th><th>VinL</th><th>CurR</th><th>CurL</th>
-            <th>TmpR</th><th>TmpL</th><th>State</th>
-          </tr>
-          </thead>
-          <tbody id="monitor-body"></tbody>
-        </table>
-      </div>
-    </div>
-  </div>
-</div>
-
-<script>
-const tableBody = document.getElementById('monitor-body');
-const tableWrap = document.getElementById('table-wrap');
-const wsSt = document.getElementById('ws-st');
-const botSt = document.getElementById('bot-st');
-const modeSt = document.getElementById('mode-st');
-
-const state = {
-  pitch: 0, roll: 0, yaw: 0, gyro: 0,
-  target: 0, pid: 0,
-  fallen: false, diag: true, bench: false,
-  cmdR: 0, cmdL: 0, actR: 0, actL: 0,
-  speed: 0, dist: 0,
-  vinR: 0, vinL: 0, curR: 0, curL: 0, tmpR: 0, tmpL: 0
+const char WEB_INDEX_ETAG[] = "\"c3427975131463fa\"";
+const size_t WEB_INDEX_GZ_LEN = 16238;
+const uint8_t WEB_INDEX_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x7d, 0x6b, 0x77, 0x13, 0x47,
+  0xb6, 0xe8, 0x77, 0x7e, 0x45, 0xc5, 0x79, 0x48, 0x0a, 0x2d, 0x59, 0x0f, 0xdb, 0x18, 0x1b, 0x7b,
+  0x8e, 0x31, 0x66, 0x60, 0x30, 0xc4, 0xc7, 0x36, 0x61, 0x72, 0x3d, 0x5e, 0xa1, 0x2d, 0xb5, 0xec,
+  0x8e, 0x25, 0xb5, 0xa6, 0xbb, 0xe5, 0x47, 0x88, 0xd6, 0x22, 0x4f, 0x20, 0x84, 0x40, 0x32, 0x09,
+  0x4c, 0x12, 0xf2, 0x80, 0xc9, 0x83, 0xc9, 0x4c, 0x80, 0xbc, 0x80, 0x40, 0x08, 0x6b, 0xe5, 0x7c,
+  0xbf, 0x3f, 0xe2, 0x5c, 0x4b, 0xb6, 0x3f, 0xcd, 0x5f, 0xb8, 0x7b, 0xef, 0xaa, 0xea, 0xae, 0x6e,
+  0xb5, 0x64, 0xc3, 0xcc, 0xac, 0x75, 0xd6, 0x5d, 0x77, 0x26, 0x58, 0xdd, 0xf5, 0xd8, 0xb5, 0x6b,
+  0xd7, 0xae, 0xfd, 0xaa, 0x47, 0xef, 0x79, 0x6c, 0xdf, 0x33, 0xa3, 0xd3, 0xcf, 0x4d, 0x8c, 0xb1,
+  0x05, 0xb7, 0x5c, 0x1a, 0xde, 0xb1, 0x07, 0x7f, 0x58, 0x49, 0xaf, 0xcc, 0x0f, 0x75, 0xbd, 0xb8,
+  0x90, 0x1c, 0x3d, 0xd2, 0x85, 0x69, 0x86, 0x5e, 0x80, 0x9f, 0xb2, 0xe1, 0xea, 0x2c, 0xbf, 0xa0,
+  0xdb, 0x8e, 0xe1, 0x0e, 0x75, 0x1d, 0x9d, 0xde, 0x9f, 0xec, 0xef, 0x92, 0xc9, 0x15, 0xbd, 0x6c,
+  0x0c, 0x75, 0x2d, 0x99, 0xc6, 0x72, 0xd5, 0xb2, 0xdd, 0x2e, 0x96, 0xb7, 0x2a, 0xae, 0x51, 0x81,
+  0x62, 0xcb, 0x66, 0xc1, 0x5d, 0x18, 0x2a, 0x18, 0x4b, 0x66, 0xde, 0x48, 0xd2, 0x8b, 0xc6, 0xcc,
+  0x8a, 0xe9, 0x9a, 0x7a, 0x29, 0xe9, 0xe4, 0xf5, 0x92, 0x31, 0x94, 0xd1, 0x58, 0xcd, 0x31, 0x6c,
+  0x7a, 0xd3, 0xe7, 0x20, 0xa1, 0x62, 0x21, 0x58, 0xd7, 0x74, 0x4b, 0xc6, 0xf0, 0xc6, 0xa9, 0xaf,
+  0x1b, 0x3f, 0x7d, 0xbf, 0x71, 0xe5, 0x4a, 0xf3, 0xf2, 0xdd, 0xc6, 0x07, 0xd7, 0xd6, 0xee, 0xde,
+  0x6d, 0xbe, 0xfd, 0x55, 0xe3, 0xf4, 0xad, 0xc6, 0xf9, 0x9b, 0x7b, 0xba, 0x79, 0x91, 0x1d, 0x7b,
+  0x1c, 0x77, 0x15, 0x7f, 0x07, 0x6c, 0xcb, 0x72, 0xd9, 0x89, 0x1d, 0x8c, 0x25, 0x93, 0x73, 0xf3,
+  0x03, 0xec, 0xf1, 0xf4, 0x5c, 0x26, 0x9b, 0xd9, 0x3d, 0x48, 0x09, 0x55, 0xbd, 0x62, 0x94, 0x20,
+  0x2d, 0xd3, 0x9b, 0x29, 0x66, 0xe7, 0x94, 0xb4, 0xa4, 0x63, 0x15, 0x5d, 0xcc, 0x48, 0x67, 0x76,
+  0x67, 0x7b, 0x79, 0x46, 0xc9, 0xac, 0x18, 0x90, 0x94, 0xed, 0xcd, 0x65, 0x7b, 0x7a, 0x78, 0x92,
+  0x6b, 0xac, 0x60, 0xa9, 0xc2, 0x6e, 0x63, 0x57, 0x31, 0xc7, 0x93, 0xca, 0x35, 0xd7, 0x28, 0x40,
+  0x5a, 0xbf, 0xae, 0xa7, 0xe7, 0x44, 0x4d, 0x6b, 0x11, 0x12, 0x7a, 0x77, 0xe5, 0x77, 0xf5, 0x8b,
+  0x84, 0x65, 0xdd, 0xae, 0x40, 0x52, 0x31, 0x3d, 0xd7, 0x93, 0x15, 0xa8, 0x18, 0xb6, 0x0d, 0x29,
+  0x46, 0xb1, 0x6f, 0xae, 0x4f, 0x20, 0xa2, 0x67, 0x20, 0xa1, 0xa7, 0x98, 0xcf, 0x15, 0x77, 0x89,
+  0x84, 0x2c, 0xd6, 0x29, 0xe6, 0xfb, 0x7b, 0x65, 0x42, 0x0e, 0x13, 0xfa, 0xfa, 0x77, 0xcd, 0x89,
+  0xc6, 0xf5, 0x1e, 0x48, 0xd8, 0x95, 0x35, 0x7a, 0xe6, 0xfa, 0x06, 0x77, 0xd4, 0x77, 0x3c, 0xcd,
+  0x4e, 0xb0, 0x39, 0x6b, 0x25, 0xe9, 0x98, 0x2f, 0x9a, 0x15, 0xe8, 0xfb, 0x9c, 0x65, 0x17, 0x80,
+  0xa6, 0x90, 0x34, 0xc8, 0xca, 0xba, 0x3d, 0x6f, 0x02, 0x12, 0xe9, 0x41, 0x56, 0xd5, 0x0b, 0x05,
+  0xca, 0x87, 0xe7, 0xfa, 0x8e, 0x39, 0xab, 0xb0, 0x4a, 0xf4, 0x2a, 0xc2, 0x68, 0x25, 0x8b, 0x7a,
+  0xd9, 0x2c, 0xad, 0x0e, 0xb0, 0xae, 0x29, 0x63, 0xde, 0x32, 0xd8, 0xd1, 0x83, 0x5d, 0x1a, 0xeb,
+  0x9a, 0x80, 0xd2, 0xfb, 0x81, 0x1b, 0xd8, 0xd4, 0x28, 0xbe, 0x1e, 0x36, 0xf3, 0xb6, 0x85, 0x04,
+  0x63, 0xcf, 0xe9, 0x07, 0x0c, 0x13, 0x92, 0x1c, 0xbd, 0xe2, 0x24, 0x61, 0xf8, 0xcc, 0x22, 0xe2,
+  0x95, 0xb7, 0x4a, 0x16, 0x74, 0x6e, 0x49, 0xb7, 0xe3, 0x9c, 0x64, 0x09, 0x4c, 0x9d, 0xd3, 0xf3,
+  0x8b, 0xf3, 0xb6, 0x55, 0xab, 0x00, 0xb5, 0x6c, 0xbd, 0x80, 0x43, 0x3f, 0x8f, 0xbf, 0xc0, 0x20,
+  0xf1, 0xbc, 0x69, 0xe7, 0x4b, 0x06, 0xd3, 0x5d, 0xe6, 0x5a, 0x55, 0x66, 0x9b, 0xf3, 0x0b, 0xae,
+  0x06, 0x83, 0xb1, 0x2b, 0x9b, 0xcb, 0xf5, 0xb0, 0xf4, 0x93, 0x9a, 0x1c, 0x45, 0xd6, 0xdb, 0xf7,
+  0x24, 0x01, 0x2b, 0x9b, 0x95, 0xe4, 0x82, 0x81, 0xe5, 0x06, 0x58, 0x26, 0x9d, 0x5e, 0x5a, 0xc0,
+  0xee, 0xa7, 0x90, 0xdf, 0x74, 0x18, 0x35, 0x9b, 0xfa, 0x53, 0x30, 0x9d, 0x6a, 0x49, 0x87, 0xbe,
+  0xcc, 0xdb, 0x66, 0x01, 0x2b, 0xe1, 0x2f, 0xe0, 0x53, 0x86, 0x54, 0xd7, 0x48, 0x02, 0x96, 0xb5,
+  0x72, 0xc5, 0x19, 0x60, 0xb9, 0xbe, 0x74, 0x75, 0x85, 0x65, 0x8a, 0x36, 0x95, 0xd1, 0xab, 0x08,
+  0xb1, 0xba, 0x82, 0x2f, 0x1e, 0xa1, 0x64, 0x42, 0x6b, 0x93, 0x25, 0xa3, 0xe8, 0x72, 0x16, 0xd2,
+  0x58, 0x8a, 0x10, 0xe7, 0x6f, 0x84, 0x81, 0x8a, 0x65, 0x7a, 0x50, 0x45, 0xa9, 0x58, 0x32, 0x08,
+  0x20, 0xfe, 0x26, 0x0b, 0xa6, 0x6d, 0xe4, 0x5d, 0xd3, 0x82, 0xd1, 0xe1, 0x48, 0x85, 0x10, 0x09,
+  0x34, 0x03, 0x43, 0x6c, 0x2d, 0x19, 0x76, 0xb1, 0x64, 0x2d, 0x27, 0x01, 0x90, 0x5e, 0x73, 0x2d,
+  0x1c, 0xc5, 0x94, 0xdf, 0xaa, 0x4a, 0x68, 0xe4, 0x61, 0xdd, 0xf6, 0x09, 0x9d, 0xe9, 0x4f, 0x17,
+  0x8c, 0x79, 0x4d, 0x8c, 0x0d, 0xd5, 0x49, 0x10, 0x81, 0x95, 0x04, 0x9a, 0x0b, 0x09, 0xec, 0x23,
+  0xa7, 0x35, 0xe7, 0x22, 0x40, 0x06, 0xa8, 0xe4, 0x58, 0x25, 0xb3, 0x20, 0x0a, 0x23, 0x6c, 0xa5,
+  0x40, 0x12, 0xdb, 0xa8, 0x39, 0x6d, 0xa9, 0x57, 0xdf, 0xb1, 0x90, 0x05, 0xe4, 0x89, 0xcb, 0x80,
+  0x41, 0x61, 0x6a, 0x65, 0xfa, 0x21, 0x3d, 0xc8, 0x2d, 0x7a, 0x26, 0x31, 0xc8, 0x4a, 0x86, 0xeb,
+  0xa2, 0x28, 0xa8, 0xea, 0x79, 0xce, 0xa6, 0xa9, 0x5e, 0x2c, 0x08, 0x00, 0x72, 0xc1, 0x81, 0x95,
+  0x54, 0x7c, 0xa1, 0xe6, 0xb8, 0x66, 0x71, 0x35, 0x29, 0xe4, 0xcd, 0x00, 0xc3, 0xaa, 0x46, 0x72,
+  0xce, 0x70, 0x97, 0x0d, 0x83, 0xa8, 0xa9, 0x97, 0xcc, 0xf9, 0x4a, 0xd2, 0x84, 0xc1, 0x07, 0x04,
+  0xf3, 0x50, 0xc6, 0xa0, 0xd1, 0x56, 0x91, 0xc9, 0x71, 0xac, 0x5b, 0xd0, 0xf1, 0x3b, 0x38, 0x67,
+  0xb9, 0xae, 0x55, 0x56, 0x09, 0x61, 0xcf, 0xcf, 0xe9, 0xf1, 0x6c, 0x6f, 0xaf, 0x26, 0xff, 0xa5,
+  0x53, 0xe9, 0xbe, 0x84, 0xd2, 0x79, 0xaf, 0x4e, 0x1f, 0x87, 0xce, 0x67, 0xa1, 0x97, 0xda, 0x2f,
+  0x86, 0xd7, 0x71, 0x75, 0xb7, 0xe6, 0x24, 0xe7, 0x74, 0xe0, 0xdc, 0x50, 0xf7, 0x38, 0x8b, 0x2c,
+  0xdb, 0xc8, 0x0e, 0xf8, 0x77, 0x90, 0x73, 0x06, 0x91, 0x4e, 0x45, 0x3f, 0xcb, 0x49, 0x94, 0x9a,
+  0xd3, 0x0b, 0xf3, 0x06, 0x91, 0xc9, 0xa3, 0x7f, 0x0f, 0xb2, 0xb7, 0x18, 0x94, 0xf0, 0x58, 0xf5,
+  0xa8, 0xc9, 0x9d, 0xc6, 0x58, 0x61, 0xaa, 0xc7, 0x33, 0x7a, 0xb6, 0x27, 0x97, 0x69, 0xa1, 0x16,
+  0x89, 0xc2, 0x04, 0x75, 0x88, 0xb0, 0x48, 0x59, 0x15, 0xe8, 0x8e, 0x28, 0xf2, 0x78, 0xba, 0x3f,
+  0xd3, 0x93, 0x2e, 0x0e, 0x06, 0x20, 0xf1, 0x7a, 0xd6, 0x22, 0x0c, 0xba, 0x40, 0x4c, 0x94, 0x76,
+  0x6d, 0x90, 0x28, 0x55, 0xdd, 0x86, 0x91, 0xf2, 0x7b, 0x95, 0x42, 0x31, 0xaa, 0x40, 0xcc, 0x14,
+  0x01, 0x62, 0x3a, 0x0a, 0x22, 0x16, 0xdc, 0x26, 0x4c, 0x90, 0xc3, 0x0a, 0xc8, 0xac, 0x9e, 0xce,
+  0xa5, 0x73, 0x51, 0x20, 0xa1, 0xdc, 0x56, 0x10, 0x77, 0xa4, 0x50, 0xf5, 0x25, 0x73, 0x05, 0x4e,
+  0x7e, 0xcb, 0x31, 0xf9, 0xa4, 0xb6, 0x0d, 0x10, 0x38, 0xe6, 0x92, 0xa1, 0x4a, 0x90, 0x6c, 0x2e,
+  0xbd, 0x5d, 0xca, 0x07, 0x47, 0xac, 0x9f, 0x57, 0x93, 0x32, 0x60, 0x80, 0x2d, 0x98, 0x85, 0x02,
+  0x67, 0xf2, 0xed, 0x49, 0x58, 0xce, 0xfd, 0x5c, 0xbc, 0xf6, 0xe4, 0x74, 0x21, 0x5e, 0xf5, 0x4c,
+  0x26, 0xd3, 0xcf, 0x76, 0xd1, 0x94, 0xaf, 0xef, 0xc8, 0xeb, 0x95, 0x25, 0xdd, 0x79, 0x3c, 0x8f,
+  0x5d, 0x61, 0xa4, 0xaf, 0x49, 0xe6, 0x3d, 0x39, 0xa8, 0x4a, 0x40, 0x78, 0xf3, 0x58, 0x75, 0xae,
+  0x64, 0xe5, 0x17, 0x89, 0xaa, 0x88, 0x18, 0x24, 0x25, 0xcd, 0x4a, 0xd1, 0x0a, 0xd1, 0x41, 0x9f,
+  0x83, 0x0e, 0x02, 0x8f, 0x20, 0xae, 0x20, 0xe7, 0xbd, 0xbe, 0xa0, 0x70, 0xf3, 0x5e, 0xc2, 0x3c,
+  0xed, 0x33, 0xd9, 0xe3, 0x73, 0xbb, 0xf2, 0x7a, 0x41, 0xa7, 0x1a, 0x40, 0x1c, 0x5f, 0xfe, 0xa7,
+  0x72, 0xbd, 0x2d, 0xdd, 0xc7, 0x89, 0x99, 0xd6, 0xe8, 0xff, 0xa9, 0x6c, 0x6f, 0x1b, 0x39, 0x16,
+  0x35, 0x7d, 0xfb, 0xa3, 0x88, 0xde, 0x17, 0x92, 0x68, 0x38, 0xa3, 0xfa, 0xc4, 0xdc, 0x5d, 0x34,
+  0x56, 0x93, 0x0b, 0x66, 0xc5, 0xed, 0xd0, 0x59, 0x9b, 0x23, 0xda, 0x2f, 0x47, 0x5c, 0x99, 0xfc,
+  0xc1, 0x0e, 0x67, 0x78, 0x12, 0xea, 0xcc, 0x24, 0x89, 0xac, 0x01, 0x5e, 0x57, 0xa5, 0x42, 0x7f,
+  0x41, 0xcf, 0xce, 0xf5, 0x63, 0xd3, 0xd0, 0x76, 0xd5, 0x4c, 0xa2, 0x56, 0x7b, 0x28, 0x7d, 0x67,
+  0x1b, 0x55, 0x43, 0x77, 0xe3, 0x59, 0x0d, 0xf5, 0x53, 0x59, 0x5f, 0x01, 0x3a, 0xa1, 0xf6, 0x4b,
+  0x24, 0x3c, 0xb5, 0xd3, 0xd7, 0x66, 0x28, 0xea, 0xd4, 0x22, 0x57, 0x32, 0x0f, 0xc9, 0xb6, 0x61,
+  0x0a, 0x8a, 0xf7, 0xb6, 0x63, 0x96, 0xe9, 0x4d, 0x78, 0xed, 0xa5, 0xc0, 0x22, 0x24, 0xc5, 0x17,
+  0x25, 0x6d, 0x5a, 0xe8, 0xc7, 0x64, 0xad, 0x25, 0xbd, 0x54, 0x33, 0x94, 0xb9, 0x5d, 0x04, 0x9b,
+  0xad, 0xd0, 0x3f, 0x18, 0xb4, 0x73, 0x6a, 0x66, 0xb2, 0x6c, 0x55, 0x2c, 0x52, 0x18, 0x1a, 0x9b,
+  0xda, 0x7f, 0x18, 0x5e, 0x92, 0x93, 0xc6, 0x7c, 0xad, 0xa4, 0xc3, 0x1c, 0x39, 0x6c, 0x54, 0x4a,
+  0x96, 0xc6, 0x46, 0xad, 0x0a, 0xf4, 0x51, 0x77, 0x80, 0x62, 0xb2, 0x6c, 0xb0, 0xdd, 0x1e, 0xde,
+  0x2e, 0x68, 0x61, 0xa0, 0x78, 0xde, 0xb5, 0x4b, 0x6d, 0xc4, 0x78, 0xab, 0xa6, 0x57, 0xa4, 0x39,
+  0xea, 0x01, 0x20, 0x24, 0x12, 0xcd, 0x5a, 0x6e, 0x05, 0x10, 0xa5, 0xc2, 0xda, 0xd6, 0x96, 0x14,
+  0x13, 0x73, 0x37, 0xdb, 0xd3, 0xa2, 0x69, 0xa3, 0xc8, 0x97, 0x6d, 0x05, 0x64, 0x56, 0xaa, 0x35,
+  0x17, 0xd5, 0x36, 0xe0, 0x00, 0x25, 0x00, 0x8d, 0x3c, 0xb6, 0x9d, 0x6c, 0xd5, 0xda, 0xc1, 0x7a,
+  0x48, 0x7d, 0xbf, 0xfd, 0x5e, 0x14, 0x76, 0x11, 0x6c, 0xed, 0x8f, 0x4d, 0x5f, 0xbe, 0xd8, 0xd7,
+  0xfb, 0x6f, 0x19, 0x9b, 0xac, 0x1c, 0x9b, 0x39, 0xb7, 0x12, 0x4d, 0xd9, 0x0e, 0x1a, 0xb6, 0x4e,
+  0xd5, 0xb8, 0x79, 0x2c, 0x28, 0x20, 0xec, 0x3a, 0xd1, 0xb3, 0xfe, 0xfe, 0x08, 0x63, 0xc7, 0x93,
+  0x5c, 0x72, 0x96, 0x54, 0xac, 0x8a, 0xd1, 0x7e, 0x52, 0x44, 0x58, 0x21, 0x94, 0xb4, 0x2c, 0x04,
+  0xdc, 0xae, 0x74, 0x5a, 0x11, 0x00, 0xcb, 0x0b, 0x26, 0x97, 0x2a, 0xf9, 0x9a, 0xed, 0x60, 0x42,
+  0xd5, 0x32, 0xb9, 0x3d, 0xc3, 0x91, 0x1d, 0xd0, 0xf3, 0xa8, 0x6c, 0xa0, 0x9b, 0xa4, 0x9e, 0x8a,
+  0x96, 0x0d, 0xb2, 0x86, 0x9c, 0xac, 0x78, 0x3a, 0xb5, 0xbb, 0x3f, 0x21, 0x3b, 0x95, 0xca, 0xd3,
+  0x08, 0x05, 0x14, 0xbb, 0xd1, 0xb7, 0xbb, 0x37, 0x9d, 0xf6, 0x4a, 0xd8, 0xb5, 0x4a, 0xb8, 0x44,
+  0xb6, 0xaf, 0x5f, 0xef, 0x2d, 0x7a, 0x25, 0x1c, 0xb4, 0xd7, 0x43, 0x45, 0xe6, 0x8c, 0x9e, 0x74,
+  0x8f, 0x0f, 0xc4, 0x29, 0x2b, 0xe4, 0x13, 0x4e, 0x5f, 0x88, 0x88, 0x4a, 0x6a, 0x40, 0xc4, 0xb6,
+  0x97, 0x90, 0x41, 0x9c, 0xf4, 0xdc, 0xae, 0x1e, 0x92, 0x88, 0x3a, 0x1f, 0x2d, 0x7f, 0x80, 0xcd,
+  0x0a, 0xa9, 0x0a, 0xa1, 0x9e, 0x88, 0x01, 0x0b, 0x46, 0xde, 0xb2, 0x75, 0x3e, 0x09, 0x69, 0x5c,
+  0xf8, 0xc4, 0xcd, 0x27, 0x41, 0x90, 0x3b, 0x6a, 0x5d, 0x12, 0xa3, 0x5b, 0x08, 0xd1, 0x9c, 0xc6,
+  0x72, 0x80, 0x69, 0x42, 0xf0, 0x0c, 0xd9, 0xa9, 0x2d, 0xd6, 0xa8, 0x9c, 0xac, 0x5c, 0x59, 0x10,
+  0x35, 0x44, 0xc7, 0x73, 0x3d, 0x41, 0xbf, 0x22, 0xd7, 0x13, 0x69, 0xa5, 0xf5, 0x45, 0x75, 0x7a,
+  0x77, 0xae, 0xaf, 0x67, 0x97, 0xaa, 0x18, 0xf2, 0xfd, 0x85, 0x5d, 0x46, 0x5f, 0xa4, 0x9b, 0xd1,
+  0xc6, 0xfc, 0x6d, 0x87, 0x69, 0x3b, 0xd9, 0x6f, 0xac, 0xa6, 0x3c, 0xe6, 0x6a, 0xb5, 0x90, 0x48,
+  0x0a, 0x78, 0xd6, 0x5e, 0x1a, 0x0c, 0x0a, 0x43, 0xf6, 0x39, 0x85, 0xb3, 0x8e, 0x28, 0xc9, 0x09,
+  0x08, 0x12, 0xc9, 0xcb, 0xd2, 0xc3, 0x59, 0x19, 0x41, 0x74, 0x1b, 0xad, 0x1b, 0xbf, 0x9c, 0x13,
+  0x01, 0x22, 0xaa, 0x5c, 0x21, 0x5c, 0x2e, 0xd7, 0x52, 0x6e, 0x47, 0x0a, 0x83, 0x19, 0xe8, 0x62,
+  0xb8, 0xb6, 0x59, 0x7d, 0x14, 0xe5, 0xd9, 0xdb, 0x5e, 0x79, 0xf6, 0xb7, 0x57, 0x9e, 0xa2, 0xd5,
+  0xbc, 0x51, 0x2a, 0x3d, 0x92, 0x12, 0xed, 0xdf, 0x42, 0x69, 0x66, 0x13, 0xad, 0x3a, 0x36, 0xd4,
+  0x6c, 0xea, 0xa1, 0xf4, 0x68, 0xa0, 0xe6, 0x92, 0xf4, 0xde, 0xfe, 0x79, 0xf9, 0xec, 0x89, 0xfd,
+  0xa2, 0xd1, 0xbb, 0x3b, 0xcf, 0x87, 0x04, 0x63, 0x4a, 0xee, 0x23, 0x5b, 0x33, 0xb9, 0x2d, 0x06,
+  0xa4, 0x2e, 0x1b, 0x98, 0xb3, 0x56, 0xfe, 0x2d, 0xb4, 0xcf, 0xf4, 0x27, 0xa2, 0x0c, 0x1c, 0xcf,
+  0x48, 0xed, 0x4f, 0x07, 0xd0, 0xa0, 0xa8, 0x95, 0x1f, 0x76, 0x09, 0x4a, 0xb7, 0x48, 0xaf, 0xaa,
+  0xc5, 0x79, 0x0c, 0xc9, 0x0e, 0xee, 0xca, 0x05, 0xfa, 0xc9, 0xcd, 0xf8, 0x20, 0x39, 0xb9, 0x28,
+  0xf4, 0x45, 0x10, 0x19, 0xf2, 0x0a, 0x18, 0xd0, 0x0a, 0xf9, 0x38, 0x26, 0xb2, 0x24, 0x39, 0xe8,
+  0x09, 0x05, 0x66, 0xc5, 0x72, 0x0d, 0xb2, 0x05, 0x2c, 0xdd, 0xf5, 0x54, 0xb8, 0xda, 0x62, 0xca,
+  0xd5, 0x91, 0xb5, 0x7d, 0x2f, 0xa7, 0x27, 0x2d, 0xb5, 0x2f, 0x8c, 0xbe, 0xe9, 0x5a, 0xb6, 0x17,
+  0xc4, 0xf0, 0x0c, 0x8a, 0x60, 0x90, 0x04, 0xc1, 0xc9, 0xa2, 0x2e, 0x06, 0x02, 0x49, 0x31, 0x53,
+  0x17, 0x02, 0xae, 0xc7, 0xbf, 0xc2, 0x73, 0xa2, 0xd8, 0x49, 0x58, 0xae, 0xa6, 0x77, 0xa7, 0x8b,
+  0x19, 0x8a, 0xa6, 0x05, 0xf1, 0x50, 0xc5, 0x76, 0x10, 0x03, 0xe4, 0xc5, 0x92, 0x5e, 0x75, 0x0c,
+  0x32, 0xea, 0xe8, 0x69, 0x30, 0x1c, 0x4e, 0x7b, 0xe4, 0xa9, 0x12, 0xcd, 0x20, 0x8a, 0xee, 0xcc,
+  0x50, 0xf8, 0x2a, 0x02, 0x5f, 0x77, 0x21, 0xe4, 0x91, 0x80, 0xac, 0xcf, 0x2f, 0xae, 0x7a, 0xce,
+  0x17, 0xd9, 0x14, 0x2f, 0x82, 0x9f, 0x56, 0xf0, 0xec, 0x9a, 0xa0, 0x93, 0xef, 0xc5, 0x48, 0xdb,
+  0xb0, 0x63, 0xab, 0x37, 0xd4, 0xc6, 0x73, 0x69, 0x1b, 0x3e, 0x09, 0x8d, 0x17, 0x59, 0x36, 0x14,
+  0xf6, 0x31, 0x50, 0x35, 0x93, 0x2d, 0x16, 0xd1, 0xaf, 0x42, 0x30, 0xba, 0x91, 0x7b, 0xd4, 0xd6,
+  0x31, 0xd8, 0xdb, 0x9f, 0xed, 0x79, 0x88, 0x96, 0xed, 0x81, 0x05, 0xe4, 0x9e, 0xb0, 0xc1, 0x43,
+  0x41, 0xe3, 0x1c, 0xb2, 0xae, 0x6b, 0xa3, 0xcd, 0x94, 0x84, 0x89, 0xba, 0x08, 0xc5, 0x04, 0xa6,
+  0x2a, 0x56, 0xe8, 0xea, 0x6e, 0x61, 0xdf, 0x3d, 0x5e, 0xe8, 0x33, 0x76, 0x15, 0x8b, 0xad, 0xe3,
+  0x51, 0xc8, 0xce, 0xe5, 0x8c, 0xce, 0x3d, 0xca, 0xe6, 0x7b, 0x32, 0xbd, 0x05, 0x44, 0x5d, 0x60,
+  0x62, 0x54, 0x0a, 0x12, 0x0d, 0x45, 0xe6, 0xa6, 0xf5, 0xfe, 0x08, 0x23, 0x2a, 0x53, 0xcc, 0xe4,
+  0x3a, 0x83, 0xef, 0x2d, 0xf4, 0xe4, 0x30, 0x7e, 0x0d, 0xf3, 0x79, 0x60, 0x00, 0xd0, 0x9f, 0x5b,
+  0x34, 0x81, 0x33, 0xf3, 0x36, 0x70, 0x3d, 0x0f, 0x5d, 0x49, 0xa3, 0x18, 0x27, 0xbd, 0x9c, 0xae,
+  0xc2, 0x8e, 0x8e, 0xa8, 0x90, 0x74, 0x17, 0x6a, 0xe5, 0xb9, 0x16, 0x0b, 0x93, 0x5b, 0x73, 0xe1,
+  0xd9, 0xdb, 0xdb, 0x01, 0x8c, 0x0d, 0xf5, 0xc3, 0x60, 0xd2, 0x46, 0xa6, 0x2f, 0x9b, 0x21, 0xd9,
+  0xf3, 0x1f, 0x65, 0xa3, 0x60, 0xea, 0x2c, 0x0e, 0xda, 0xc1, 0x9b, 0x35, 0x24, 0x8f, 0x13, 0x44,
+  0x18, 0x35, 0x6c, 0xdc, 0x4e, 0xcb, 0x60, 0x74, 0xd8, 0xeb, 0x91, 0x8c, 0xb9, 0x42, 0xd5, 0x40,
+  0x5c, 0x16, 0xe1, 0xcb, 0x32, 0xdc, 0xb2, 0xf4, 0x65, 0xcd, 0x92, 0xe9, 0x98, 0xc0, 0x43, 0xa2,
+  0x9a, 0xaa, 0xeb, 0x3a, 0x36, 0x49, 0xa5, 0x83, 0xc6, 0xca, 0xc3, 0xbb, 0xf5, 0x00, 0xa5, 0xbe,
+  0x63, 0x4f, 0xb7, 0x58, 0x20, 0xd9, 0xd3, 0x2d, 0x56, 0x72, 0x30, 0xf0, 0x0f, 0x3f, 0x05, 0x73,
+  0x89, 0xe5, 0x41, 0xea, 0x38, 0x43, 0x5d, 0x1e, 0x21, 0xba, 0x86, 0xa1, 0x5d, 0x35, 0xc7, 0xef,
+  0x27, 0x65, 0x41, 0xe6, 0x42, 0x36, 0x62, 0x59, 0x06, 0x60, 0x67, 0x87, 0x77, 0xf0, 0x02, 0x4a,
+  0x6d, 0x3f, 0xbc, 0x29, 0x6a, 0x8b, 0x6c, 0xb3, 0x30, 0xd4, 0xb5, 0xec, 0x40, 0xc7, 0xba, 0x64,
+  0x49, 0x8a, 0xc9, 0x75, 0x0d, 0x37, 0x2f, 0x7f, 0xbd, 0xf1, 0xe0, 0x93, 0xe6, 0xdb, 0x5f, 0xec,
+  0xe9, 0x86, 0x72, 0x2d, 0x75, 0x80, 0x35, 0x23, 0x2a, 0x35, 0x7e, 0x79, 0x1d, 0x10, 0x89, 0xae,
+  0x51, 0xb6, 0x0a, 0x46, 0x44, 0x95, 0x7d, 0x07, 0x47, 0x7e, 0xdb, 0xa6, 0x09, 0x3d, 0xaa, 0x89,
+  0x64, 0x92, 0x3d, 0x1b, 0x5d, 0xfe, 0x05, 0x6b, 0xb5, 0xb5, 0x3c, 0x23, 0x92, 0x0f, 0x75, 0x49,
+  0xe5, 0x8b, 0x4c, 0xd1, 0x35, 0xfc, 0xbb, 0x67, 0x9e, 0x63, 0xc9, 0x64, 0x34, 0x98, 0x42, 0x69,
+  0x9b, 0x50, 0x98, 0x55, 0xc9, 0x97, 0x40, 0x9e, 0x03, 0x71, 0x61, 0x8e, 0xc7, 0x63, 0xfb, 0xc6,
+  0x27, 0x63, 0x89, 0xae, 0xe1, 0xc3, 0x07, 0xa7, 0xa6, 0x58, 0x3a, 0x1a, 0x76, 0xd5, 0xb6, 0x8a,
+  0xdb, 0xc5, 0x71, 0x74, 0xe2, 0x68, 0x5b, 0x1c, 0x4b, 0x51, 0xa4, 0xd9, 0x16, 0x92, 0xe3, 0x13,
+  0x5a, 0x1a, 0xb1, 0x1c, 0x1d, 0x39, 0xd2, 0x16, 0xba, 0xb3, 0xb4, 0x5d, 0x1c, 0xa7, 0x46, 0xf6,
+  0x8f, 0x45, 0xc3, 0x28, 0x56, 0xb7, 0x0b, 0x63, 0xff, 0xc8, 0xf8, 0x78, 0x7b, 0x54, 0x6a, 0x0f,
+  0xdd, 0x4f, 0xd7, 0x9a, 0x9f, 0x2f, 0x19, 0x53, 0xae, 0x5e, 0x29, 0xd4, 0xaa, 0x13, 0x40, 0x70,
+  0x13, 0xdc, 0x6e, 0xe8, 0xf1, 0xd1, 0x89, 0xb6, 0xad, 0xb8, 0xc6, 0x23, 0x52, 0x73, 0xfa, 0xf7,
+  0x48, 0xcb, 0xe9, 0xc9, 0x43, 0x41, 0xd0, 0xe2, 0xb1, 0x65, 0x12, 0x8a, 0xd8, 0xb4, 0x3f, 0x03,
+  0x85, 0x75, 0x88, 0x38, 0xe4, 0x31, 0x7d, 0x4f, 0x37, 0x4f, 0x09, 0x60, 0x28, 0x2a, 0xab, 0x51,
+  0x5d, 0x0f, 0x02, 0x63, 0x13, 0xa6, 0x9b, 0x07, 0x69, 0xba, 0x07, 0x34, 0x67, 0x85, 0x00, 0x2d,
+  0xe9, 0xa5, 0x64, 0xb5, 0x6b, 0x38, 0x9d, 0x02, 0x1e, 0xc4, 0xc4, 0xe1, 0x5f, 0x6f, 0xee, 0x99,
+  0xb3, 0xfd, 0x0a, 0x93, 0x20, 0xb2, 0xc3, 0xe5, 0xed, 0x0e, 0xe5, 0x9f, 0xd3, 0x97, 0xc3, 0xc5,
+  0x57, 0x3b, 0x14, 0xff, 0xed, 0xaa, 0x6d, 0x85, 0xcb, 0xcf, 0x07, 0xcb, 0x77, 0x3b, 0xb2, 0x7b,
+  0x2d, 0xa3, 0x21, 0xfa, 0x2a, 0x03, 0xba, 0x5d, 0xc3, 0xc7, 0x46, 0xa6, 0xf6, 0x31, 0xbe, 0xd4,
+  0x8c, 0xcd, 0xfc, 0x27, 0x6b, 0x5c, 0xb8, 0xd1, 0x78, 0xf3, 0x1a, 0xeb, 0x66, 0x63, 0xac, 0x79,
+  0xf2, 0x8b, 0xc6, 0xcb, 0x97, 0xb7, 0x41, 0x77, 0x11, 0x59, 0xe8, 0x6a, 0xd3, 0x14, 0x5b, 0xee,
+  0x22, 0x54, 0x17, 0x93, 0xcb, 0xd0, 0x60, 0x27, 0xa4, 0x98, 0x2e, 0x4b, 0xea, 0x5d, 0xc3, 0x23,
+  0x1d, 0x4b, 0x3a, 0xb2, 0x24, 0x34, 0x3b, 0xd5, 0xb1, 0x64, 0x41, 0x96, 0x04, 0x06, 0xd8, 0xb7,
+  0x9d, 0xde, 0x28, 0x3a, 0x00, 0xb5, 0x40, 0x6e, 0xb8, 0x71, 0xfd, 0x93, 0xe6, 0xa5, 0x5b, 0x8d,
+  0xd7, 0xbf, 0xdf, 0x7c, 0xef, 0xfa, 0xe6, 0xa9, 0xf3, 0xa0, 0x02, 0x72, 0x91, 0x8d, 0x89, 0x50,
+  0xb5, 0xc2, 0x3d, 0xa1, 0x6c, 0xe0, 0x40, 0x55, 0xe3, 0x60, 0x04, 0x13, 0x34, 0xc1, 0xfb, 0x3f,
+  0x6c, 0xdc, 0xff, 0x72, 0xf3, 0xd4, 0x39, 0x02, 0x8d, 0x38, 0x05, 0x78, 0x1a, 0x43, 0xbc, 0xa2,
+  0x07, 0x00, 0x9f, 0x1b, 0x54, 0x24, 0xa6, 0xe7, 0x45, 0x61, 0xb5, 0xef, 0xdb, 0x6b, 0x11, 0x9a,
+  0xdb, 0xb8, 0x7f, 0x7d, 0xfd, 0xa3, 0x1f, 0x1a, 0xbf, 0xbc, 0xb6, 0x75, 0x8b, 0x0b, 0x06, 0xd6,
+  0x81, 0x06, 0xcb, 0xe5, 0x47, 0x6e, 0x71, 0xfd, 0xa3, 0xeb, 0xcd, 0xcf, 0x4e, 0x6d, 0x7c, 0xf5,
+  0xee, 0x96, 0xcd, 0xb9, 0xe0, 0x01, 0x1a, 0x2e, 0x31, 0x74, 0x1a, 0x58, 0xff, 0x51, 0x1b, 0x9c,
+  0x38, 0xb8, 0x8f, 0x6d, 0xfc, 0xf2, 0xa7, 0xc6, 0xa9, 0xbb, 0x5b, 0xb6, 0x58, 0xc5, 0x11, 0xa3,
+  0xf9, 0xf3, 0xa8, 0x9d, 0xbb, 0xfb, 0x60, 0xf3, 0xe4, 0xa7, 0x8d, 0xbb, 0x5f, 0x6e, 0xd9, 0x94,
+  0x53, 0x35, 0x0c, 0xde, 0x58, 0x3a, 0xcd, 0xca, 0xdd, 0xce, 0xa3, 0x8f, 0xe0, 0xed, 0x1b, 0xeb,
+  0xd7, 0xce, 0x6e, 0xd9, 0x1e, 0x08, 0x57, 0xd7, 0x6b, 0xee, 0x91, 0x1b, 0x1b, 0x2d, 0x17, 0xd8,
+  0xe4, 0xc4, 0xe1, 0x2d, 0x5b, 0xcb, 0x97, 0xb1, 0x6f, 0x20, 0x3a, 0x1e, 0x9d, 0x94, 0x23, 0x79,
+  0x77, 0x5b, 0x4d, 0xe9, 0x79, 0xb7, 0x7d, 0x53, 0x8f, 0x34, 0xc7, 0x91, 0x61, 0x1a, 0xe7, 0x5f,
+  0x69, 0xbe, 0x7f, 0x73, 0xe3, 0xe6, 0xab, 0x1b, 0x6f, 0xbe, 0xd2, 0x6e, 0x92, 0xcb, 0xe5, 0x8f,
+  0x36, 0x93, 0xdc, 0x5f, 0x1f, 0x80, 0xfe, 0x51, 0xa7, 0x86, 0x0f, 0x55, 0xf7, 0x74, 0xf3, 0xa7,
+  0x3d, 0x7c, 0xa9, 0xc1, 0x5d, 0xad, 0x82, 0xe2, 0xb3, 0xf5, 0xca, 0xbc, 0xe8, 0x91, 0x5d, 0xed,
+  0x42, 0x8b, 0x76, 0xa8, 0x2b, 0xdd, 0x85, 0x16, 0xf6, 0x50, 0x57, 0x4f, 0x1a, 0xf5, 0xa3, 0x51,
+  0x85, 0x94, 0x54, 0x6f, 0x17, 0xa3, 0xce, 0x0f, 0x75, 0x65, 0xb2, 0x5d, 0x61, 0x9a, 0xf0, 0xfa,
+  0x4b, 0xa0, 0x8f, 0x32, 0xd9, 0x6d, 0x70, 0x70, 0x14, 0x76, 0xe6, 0x96, 0xd8, 0x99, 0x21, 0xec,
+  0x32, 0x0a, 0x76, 0x19, 0x0f, 0xbb, 0x74, 0x3b, 0xe4, 0xcc, 0xed, 0xcd, 0xae, 0x28, 0xdc, 0x0a,
+  0x5b, 0xe2, 0x56, 0xe8, 0x80, 0x5b, 0xda, 0x27, 0x1d, 0x92, 0xb1, 0x0d, 0x7a, 0x34, 0x1f, 0x7b,
+  0x1f, 0x8d, 0x8d, 0xc4, 0x7a, 0x8b, 0xcf, 0x48, 0x73, 0x35, 0xf0, 0x28, 0x2b, 0x4a, 0x36, 0x03,
+  0x17, 0xb5, 0xc5, 0xac, 0x99, 0x42, 0xab, 0x86, 0x2b, 0x5a, 0xee, 0x5d, 0xec, 0xe9, 0xe6, 0x15,
+  0x3b, 0xc0, 0xc1, 0x65, 0x88, 0x16, 0x40, 0x63, 0x08, 0x48, 0xaa, 0xe9, 0x2d, 0x41, 0xe4, 0x65,
+  0x9f, 0xc1, 0xba, 0x85, 0xf7, 0x16, 0x9b, 0x6e, 0x04, 0x9c, 0xbe, 0xe9, 0x5a, 0x85, 0xac, 0x39,
+  0x74, 0x7c, 0xde, 0xbc, 0x06, 0x53, 0x01, 0xe6, 0x44, 0x10, 0x74, 0xe7, 0x29, 0x25, 0xe1, 0x8b,
+  0xb7, 0x48, 0x8b, 0x54, 0x99, 0x75, 0x6a, 0x33, 0x91, 0xbd, 0x2e, 0xb7, 0xf4, 0x79, 0x84, 0x6c,
+  0x42, 0xe8, 0x71, 0xf3, 0x9b, 0xab, 0x1e, 0x66, 0x2d, 0xb3, 0x55, 0x34, 0xec, 0x07, 0x96, 0x28,
+  0x42, 0xad, 0x2e, 0xaa, 0x67, 0x52, 0x7d, 0xa1, 0x39, 0x3c, 0xbc, 0xf9, 0xe7, 0x5b, 0xcd, 0xeb,
+  0x3f, 0xaa, 0xd6, 0x15, 0xf6, 0x64, 0x41, 0x77, 0x7c, 0x73, 0x95, 0x87, 0x18, 0xbc, 0xd5, 0x00,
+  0xd4, 0x8b, 0xc2, 0xee, 0x8a, 0x60, 0xed, 0xe1, 0xc6, 0xfd, 0x3f, 0x35, 0xce, 0x9c, 0x6b, 0x9c,
+  0xfc, 0x39, 0x04, 0x33, 0x5f, 0xb3, 0xa3, 0x21, 0x66, 0x55, 0x88, 0xec, 0xa9, 0xca, 0x9c, 0x53,
+  0x1d, 0x64, 0x1b, 0x37, 0xde, 0x6f, 0xfe, 0xfd, 0x4a, 0x08, 0x04, 0x78, 0xca, 0x7a, 0x69, 0x8b,
+  0xe6, 0x9b, 0x97, 0x4f, 0xae, 0xdd, 0xff, 0xbe, 0xb5, 0xf9, 0x39, 0x03, 0xcd, 0xf1, 0x88, 0xf6,
+  0xad, 0xc5, 0xa8, 0xf6, 0x1b, 0xdf, 0xfc, 0xb9, 0xf9, 0xc3, 0xbd, 0x10, 0x0c, 0x27, 0x6f, 0xd9,
+  0xc6, 0x36, 0x80, 0x44, 0xe1, 0xb5, 0xf1, 0xe0, 0x23, 0xd0, 0x96, 0x61, 0x3a, 0xdb, 0xd6, 0x7c,
+  0xe7, 0x7a, 0xb2, 0x31, 0x11, 0x24, 0xc6, 0x10, 0x5f, 0x4f, 0x75, 0x45, 0x19, 0xc4, 0x60, 0x31,
+  0x31, 0xce, 0x18, 0x38, 0x53, 0xc2, 0x26, 0x72, 0x67, 0x4f, 0x30, 0xf6, 0x82, 0x6b, 0x92, 0x5e,
+  0x24, 0x83, 0x6f, 0x37, 0x09, 0xc0, 0x55, 0x9c, 0x19, 0xa4, 0x9f, 0xee, 0x0f, 0x9f, 0xe4, 0x26,
+  0x8c, 0x97, 0xf2, 0xc8, 0x0b, 0x3c, 0x28, 0xed, 0xf9, 0x0b, 0x47, 0xb4, 0x56, 0xc9, 0x03, 0x95,
+  0x54, 0x90, 0xa5, 0x53, 0x39, 0xa7, 0x2b, 0xdc, 0xd1, 0x90, 0xd5, 0xde, 0xfa, 0xaa, 0xe0, 0x51,
+  0x02, 0x8a, 0x45, 0x10, 0x05, 0x7b, 0xac, 0x04, 0x6a, 0x00, 0x35, 0xa5, 0x77, 0xc9, 0xd5, 0x01,
+  0x0a, 0xee, 0xa8, 0xb1, 0x5b, 0x3f, 0x16, 0xab, 0xcc, 0x17, 0x8c, 0xc3, 0xaa, 0xc3, 0xca, 0xa3,
+  0xa2, 0x5d, 0x5b, 0xc9, 0x48, 0x55, 0x40, 0xa8, 0xe2, 0x41, 0xd9, 0x38, 0x28, 0xe3, 0x2b, 0x4a,
+  0xae, 0x1a, 0xff, 0x89, 0x74, 0x23, 0x94, 0x65, 0x9a, 0x90, 0xe1, 0xd0, 0x35, 0x7c, 0x28, 0xc2,
+  0x5c, 0x90, 0x36, 0xff, 0x92, 0x9c, 0x24, 0xad, 0xe2, 0x7d, 0x9b, 0xd0, 0x3b, 0x99, 0xae, 0xbc,
+  0x15, 0x97, 0xb7, 0x02, 0x0a, 0x27, 0xd2, 0x60, 0xdd, 0x76, 0x43, 0xef, 0xfd, 0xd8, 0x78, 0xfb,
+  0x2c, 0x8b, 0x4f, 0x76, 0x8f, 0x27, 0xda, 0xb6, 0xb5, 0x04, 0x63, 0x2c, 0xfa, 0x04, 0xd6, 0x8f,
+  0x1f, 0xac, 0x79, 0xd4, 0x16, 0x9b, 0x3f, 0xbe, 0xbc, 0x45, 0x8b, 0x20, 0xab, 0x82, 0x2d, 0x96,
+  0x47, 0xfe, 0x89, 0x26, 0x9b, 0x77, 0xfe, 0x0a, 0x53, 0x7f, 0x8b, 0x26, 0xdd, 0x72, 0x35, 0xd8,
+  0xe4, 0x68, 0x4b, 0x8b, 0x0f, 0xe1, 0xbc, 0x7d, 0xfe, 0xe1, 0xfa, 0xbd, 0x1f, 0x84, 0x0b, 0x77,
+  0xfe, 0xc6, 0xc6, 0x57, 0x6f, 0x34, 0xde, 0xba, 0xd8, 0xce, 0xba, 0xf3, 0xa3, 0x96, 0x6d, 0xec,
+  0x3b, 0x6f, 0x1d, 0x28, 0xd8, 0x33, 0x65, 0xc5, 0x0b, 0x74, 0xd3, 0x57, 0x0f, 0x9a, 0x27, 0x5f,
+  0x1e, 0xe0, 0xa1, 0x03, 0xe8, 0xc0, 0x34, 0xb9, 0x34, 0xf0, 0x80, 0xa1, 0x01, 0x2e, 0xf3, 0x02,
+  0xd5, 0x70, 0xcd, 0x89, 0x77, 0x1c, 0xf8, 0xdf, 0xd0, 0xcb, 0x18, 0x2c, 0x19, 0x0e, 0x88, 0xc1,
+  0x40, 0x20, 0x83, 0xea, 0x80, 0x09, 0x84, 0x4d, 0x79, 0x01, 0x8d, 0x0e, 0x86, 0xd5, 0x76, 0x50,
+  0xe6, 0x11, 0x00, 0x40, 0x19, 0xac, 0xe0, 0x6e, 0x8a, 0x31, 0xc0, 0xcf, 0x14, 0x7a, 0x2b, 0xed,
+  0x10, 0xe0, 0x36, 0xf0, 0xbf, 0xaa, 0x7d, 0xe4, 0xc4, 0xcb, 0x77, 0x07, 0x18, 0xb8, 0x1a, 0xdd,
+  0xc2, 0x07, 0x60, 0x3b, 0xd9, 0x68, 0xcd, 0xc6, 0x8d, 0x87, 0xed, 0x50, 0x28, 0x5b, 0xae, 0x65,
+  0xb7, 0xc3, 0xe1, 0x91, 0x78, 0xc5, 0xc3, 0x7f, 0xf3, 0xea, 0x3b, 0x1b, 0x37, 0xbf, 0x6d, 0x9c,
+  0x7e, 0xa3, 0xf9, 0xc9, 0x85, 0x7f, 0xfc, 0x7c, 0xda, 0xdf, 0x94, 0xff, 0xd9, 0x1d, 0x96, 0x66,
+  0x1b, 0xd7, 0xaf, 0xac, 0x5f, 0xbf, 0xc4, 0x8e, 0x19, 0x25, 0x18, 0xdf, 0x89, 0xa9, 0x7d, 0x1a,
+  0xeb, 0x4d, 0xa7, 0x0f, 0xbc, 0xc8, 0x1a, 0xaf, 0x5f, 0x03, 0x47, 0x70, 0xf3, 0xd4, 0xa9, 0xe6,
+  0x67, 0xb7, 0x35, 0xb6, 0x0e, 0x7c, 0x9e, 0x75, 0xd8, 0xfa, 0xd7, 0x97, 0x1a, 0xe7, 0xff, 0xf2,
+  0x8f, 0x9f, 0xcf, 0x04, 0x75, 0x60, 0x1b, 0x63, 0x87, 0x62, 0x7b, 0x4e, 0xa4, 0x79, 0x06, 0xc3,
+  0x01, 0x44, 0xaf, 0x95, 0xd1, 0x3c, 0x6b, 0xfc, 0x7c, 0x12, 0xec, 0x47, 0xc5, 0xfc, 0x09, 0xf4,
+  0xbc, 0x13, 0x6f, 0xe3, 0xa2, 0x29, 0x2e, 0x61, 0x76, 0x18, 0x0c, 0xe8, 0x11, 0x8b, 0x17, 0xf6,
+  0x76, 0x1f, 0x78, 0x31, 0x21, 0x99, 0xf8, 0xd7, 0x9b, 0xbf, 0x7e, 0xc7, 0x5e, 0xe2, 0x8c, 0xd1,
+  0x78, 0xfb, 0xd3, 0xc6, 0x57, 0x67, 0xbb, 0xd7, 0xee, 0xbf, 0xbd, 0x79, 0xf2, 0x43, 0x16, 0xc7,
+  0x78, 0x53, 0x82, 0x72, 0x85, 0x38, 0x29, 0x8f, 0xfc, 0xfa, 0x5d, 0x47, 0x2e, 0x2f, 0x3a, 0xdb,
+  0xe1, 0x70, 0x47, 0x74, 0x37, 0x7a, 0x80, 0x3b, 0x8e, 0x29, 0x0b, 0xac, 0xc4, 0xb6, 0x19, 0xe1,
+  0x4b, 0xdf, 0xac, 0xbf, 0x7d, 0xa3, 0x79, 0xe9, 0x8b, 0xc6, 0x83, 0x4b, 0x30, 0xc2, 0x1b, 0xd7,
+  0x7f, 0x69, 0x7c, 0x7e, 0x6a, 0xfd, 0x6f, 0x37, 0x36, 0xae, 0xdf, 0x6c, 0xdc, 0x7f, 0x5f, 0x63,
+  0xcd, 0x1b, 0xe7, 0xc1, 0xe8, 0x5a, 0xff, 0xdb, 0x07, 0xeb, 0x7f, 0x3b, 0xdb, 0x38, 0x7d, 0x73,
+  0xe3, 0xf6, 0x5b, 0x8d, 0x93, 0xef, 0x36, 0xae, 0xbf, 0xd5, 0x7c, 0xff, 0x87, 0xb5, 0x07, 0x1f,
+  0xaf, 0xbf, 0xff, 0x41, 0xcb, 0x88, 0xaa, 0x2a, 0x7c, 0x0b, 0x4b, 0xd6, 0x36, 0x8a, 0xb6, 0xe1,
+  0x2c, 0x4c, 0xd6, 0x2a, 0x0e, 0x8d, 0xe6, 0xe9, 0xdb, 0xcd, 0x8b, 0x37, 0xc3, 0x16, 0x3c, 0x01,
+  0xd2, 0xc3, 0x30, 0x16, 0xa0, 0xee, 0x50, 0x57, 0xb7, 0x5e, 0x35, 0xbb, 0x41, 0xfd, 0xff, 0xa6,
+  0x58, 0x76, 0x87, 0xf2, 0xce, 0x12, 0xae, 0x27, 0x9c, 0xdc, 0x78, 0xf0, 0x0e, 0xef, 0x15, 0x1b,
+  0x9d, 0x02, 0xb5, 0xa0, 0x3f, 0x34, 0xa0, 0x39, 0x13, 0xac, 0x9e, 0xbd, 0x07, 0x8f, 0x04, 0xea,
+  0x6e, 0x8b, 0xb7, 0x5a, 0xd7, 0xb3, 0x85, 0x24, 0xf7, 0xdf, 0x15, 0x88, 0x7c, 0xad, 0x31, 0xaa,
+  0x6a, 0xd0, 0x98, 0x73, 0xf9, 0x32, 0x8e, 0x9a, 0x62, 0x87, 0xac, 0x32, 0x77, 0x61, 0x18, 0xa8,
+  0xb8, 0xa7, 0x1b, 0x7e, 0xf1, 0x79, 0xfd, 0xdb, 0x7b, 0x8d, 0x4f, 0xce, 0xfa, 0xaf, 0xf7, 0xfe,
+  0xd4, 0xfc, 0xf8, 0x53, 0xef, 0x15, 0x67, 0xcd, 0x57, 0x67, 0xe3, 0x65, 0x27, 0xe1, 0x25, 0x81,
+  0x52, 0xd8, 0x7c, 0xff, 0x81, 0x97, 0xd4, 0x02, 0x1c, 0x66, 0x72, 0xf3, 0xf2, 0xdf, 0x7d, 0x08,
+  0xe7, 0x6f, 0xac, 0xdd, 0x39, 0xbb, 0x71, 0xff, 0xbe, 0x97, 0x02, 0x86, 0xd6, 0x4b, 0x34, 0x47,
+  0x5e, 0x0a, 0x26, 0x1d, 0xdc, 0x17, 0x4c, 0x20, 0x61, 0xea, 0x27, 0xed, 0x33, 0x1d, 0x37, 0x5e,
+  0xf6, 0xf1, 0x08, 0xb7, 0x0e, 0xef, 0x76, 0xe8, 0xbd, 0x95, 0x18, 0x74, 0xae, 0x85, 0xdc, 0x60,
+  0x60, 0xa4, 0x24, 0xbe, 0xe1, 0x64, 0x71, 0xf9, 0xaa, 0x97, 0x52, 0x13, 0x29, 0x3b, 0xbc, 0x55,
+  0x4c, 0xb8, 0xdd, 0x10, 0x56, 0x6d, 0x83, 0xe2, 0xea, 0x3c, 0x25, 0xc2, 0xa1, 0x1b, 0x54, 0x4c,
+  0xcf, 0xfe, 0x80, 0x3d, 0xfe, 0x70, 0x03, 0x1d, 0x68, 0x0d, 0x13, 0xa8, 0x33, 0x1d, 0x7a, 0x2d,
+  0xcb, 0x3e, 0x74, 0xc7, 0xc3, 0xa6, 0xaa, 0x14, 0x26, 0x7b, 0x9c, 0x3c, 0xd8, 0x9f, 0x2e, 0x01,
+  0xaf, 0x18, 0x6e, 0x72, 0xd9, 0xc2, 0x45, 0xee, 0x2e, 0x11, 0x76, 0xc0, 0x45, 0xee, 0xee, 0x17,
+  0x1c, 0x99, 0x3a, 0xbc, 0xa3, 0xbb, 0x9b, 0xad, 0xdf, 0x7f, 0x67, 0xfd, 0xde, 0xe5, 0xf5, 0xbb,
+  0x0f, 0xd6, 0xaf, 0x9d, 0x1d, 0x60, 0xcd, 0xb7, 0x5e, 0x6e, 0x5e, 0x3e, 0x03, 0x7a, 0x61, 0x6e,
+  0xca, 0xca, 0x2f, 0x1a, 0xae, 0xc6, 0x1a, 0x1f, 0x7d, 0xc2, 0x46, 0x46, 0x0f, 0x69, 0x6c, 0xe3,
+  0xab, 0xbf, 0xac, 0x7f, 0xf6, 0x32, 0x1b, 0xe9, 0x9e, 0x66, 0xcd, 0x8b, 0xa7, 0x80, 0xa5, 0xd6,
+  0xee, 0xbc, 0xcd, 0x0e, 0xb1, 0xb5, 0xbb, 0x6f, 0xa1, 0x33, 0x74, 0xfa, 0x16, 0x08, 0xce, 0x41,
+  0x04, 0xb8, 0x79, 0xe5, 0xc7, 0xcd, 0x8f, 0xaf, 0x82, 0xf0, 0x59, 0xbb, 0x83, 0x9e, 0xf1, 0xfa,
+  0x7b, 0xf7, 0x1a, 0x77, 0xbe, 0x6a, 0x9c, 0x7f, 0x67, 0xed, 0xce, 0x49, 0x10, 0x47, 0xac, 0x5a,
+  0x2b, 0x95, 0x40, 0x36, 0xbd, 0x77, 0x0b, 0x44, 0x12, 0x00, 0x81, 0xbc, 0xf5, 0xaf, 0x6e, 0xac,
+  0xff, 0x70, 0x63, 0xfd, 0xc3, 0xd7, 0x50, 0xf9, 0xbc, 0x7a, 0xad, 0xf9, 0xfe, 0xcd, 0xe6, 0xb9,
+  0xeb, 0x2c, 0x8e, 0x0d, 0x35, 0xce, 0x7f, 0xcd, 0x45, 0x15, 0xc8, 0x06, 0x90, 0x2f, 0x08, 0xe2,
+  0xe3, 0x2b, 0x89, 0x1d, 0x79, 0xab, 0xe2, 0xb8, 0xec, 0xd0, 0xf3, 0xfb, 0x0f, 0x8e, 0x8d, 0xef,
+  0x9b, 0x62, 0x43, 0x2c, 0x93, 0xa5, 0xa6, 0x0f, 0x31, 0xae, 0xb9, 0x1a, 0xdf, 0x5c, 0x02, 0x2f,
+  0x98, 0xfd, 0xf7, 0x1b, 0xef, 0xb2, 0xf5, 0x33, 0x7f, 0x5d, 0xbf, 0xf0, 0xc6, 0xe6, 0xa9, 0xf3,
+  0x03, 0xac, 0x4a, 0x7a, 0x80, 0x47, 0x67, 0x19, 0x2e, 0x4b, 0xa3, 0xe4, 0x4f, 0x68, 0x6c, 0x1e,
+  0x55, 0x02, 0x57, 0x02, 0x1a, 0x14, 0x2a, 0x68, 0x8c, 0x82, 0x9c, 0x2c, 0x5e, 0xa6, 0x94, 0x7c,
+  0xb9, 0x30, 0x89, 0x7f, 0xc6, 0x99, 0x9e, 0x77, 0x27, 0xf1, 0xcf, 0x38, 0x18, 0x7f, 0x13, 0x87,
+  0x31, 0xab, 0x66, 0x4f, 0xe2, 0x1f, 0x48, 0x28, 0x8f, 0xf8, 0x68, 0x4d, 0x8d, 0x8e, 0x8c, 0x8f,
+  0x01, 0x56, 0x33, 0x60, 0x4f, 0x67, 0x34, 0x16, 0xfc, 0xeb, 0xff, 0x49, 0x63, 0x42, 0xf8, 0xbf,
+  0xd9, 0x41, 0x0f, 0xcc, 0xa1, 0xb1, 0xb1, 0x09, 0x80, 0xd2, 0x9f, 0xd9, 0x9d, 0x1d, 0xe4, 0x0c,
+  0xe0, 0x51, 0x77, 0xed, 0xce, 0xb9, 0xc6, 0xf9, 0x8b, 0x2c, 0xde, 0xb8, 0xf0, 0x76, 0xe3, 0xfc,
+  0x4d, 0x30, 0xee, 0xd7, 0xbf, 0xf9, 0x05, 0x72, 0x9a, 0x1f, 0xbe, 0xd2, 0x78, 0xf9, 0x32, 0x27,
+  0x7a, 0x82, 0x81, 0x60, 0x00, 0xb2, 0xa1, 0xf1, 0xf8, 0xd5, 0x0d, 0x30, 0xcb, 0x81, 0xc0, 0x9c,
+  0x3a, 0x40, 0x60, 0xd1, 0xc6, 0xf4, 0xd8, 0xef, 0xa7, 0x65, 0x33, 0xd9, 0xde, 0xbe, 0xc1, 0x1d,
+  0x3b, 0x4a, 0x40, 0x9a, 0x65, 0x07, 0x5e, 0x2b, 0x30, 0x4c, 0x83, 0xf4, 0x5a, 0xb3, 0x4b, 0xf0,
+  0x1e, 0x8b, 0xf1, 0x37, 0x7b, 0x65, 0x14, 0x9c, 0x42, 0x17, 0x52, 0xd2, 0x3c, 0x01, 0x66, 0x86,
+  0x3b, 0x22, 0x2a, 0x68, 0xf4, 0x36, 0x1d, 0xa8, 0x8e, 0x3c, 0x87, 0x00, 0x67, 0x66, 0xf9, 0xfb,
+  0xe2, 0xde, 0x5a, 0x11, 0x0b, 0x18, 0xcb, 0x6c, 0x3f, 0x6e, 0x51, 0xca, 0x65, 0x47, 0x6c, 0x5b,
+  0x5f, 0x8d, 0x7b, 0xa3, 0xf9, 0x34, 0xcb, 0xa4, 0xb3, 0x3d, 0x09, 0x51, 0xda, 0x6b, 0x4d, 0x63,
+  0x8b, 0x47, 0x00, 0xd4, 0x94, 0xf1, 0x47, 0x78, 0x4b, 0x02, 0xa9, 0x16, 0xc7, 0x2d, 0x47, 0xe0,
+  0xb1, 0xa3, 0x58, 0xab, 0xd0, 0x8e, 0x6d, 0x68, 0xb7, 0xec, 0xc4, 0x0b, 0x7c, 0xcb, 0x80, 0x6d,
+  0xb8, 0x35, 0xbb, 0xc2, 0x5b, 0xe9, 0xeb, 0xa1, 0x56, 0x52, 0x45, 0xdb, 0x2a, 0xc7, 0x0b, 0x29,
+  0x98, 0xfa, 0xa6, 0x1b, 0x8f, 0x69, 0x31, 0x18, 0xc4, 0x23, 0xb5, 0xf2, 0x9c, 0x61, 0xd3, 0x0e,
+  0x2a, 0x1f, 0x0e, 0xee, 0x3f, 0x2d, 0x18, 0x87, 0xe2, 0x73, 0xb5, 0x62, 0x42, 0x6c, 0xcc, 0x40,
+  0x82, 0x2d, 0x09, 0xcc, 0xf7, 0xe9, 0xae, 0xfe, 0x2c, 0x4c, 0x5c, 0xca, 0xc7, 0xed, 0x18, 0x66,
+  0x91, 0xe1, 0x73, 0x6a, 0x6e, 0xd5, 0x35, 0xc6, 0x8d, 0xca, 0x3c, 0xf8, 0xc6, 0x7b, 0x58, 0x3f,
+  0x7b, 0xe9, 0x25, 0xb6, 0x94, 0x02, 0x76, 0x3b, 0x6a, 0x56, 0xdc, 0xfe, 0x78, 0x3a, 0xc1, 0x1e,
+  0x1b, 0x02, 0x84, 0x57, 0x7a, 0xf6, 0x86, 0x72, 0x32, 0x3c, 0x07, 0x7e, 0x38, 0xd2, 0x83, 0x5e,
+  0x8b, 0x15, 0x68, 0xd1, 0x2b, 0x98, 0xe9, 0xc3, 0x9d, 0x03, 0x60, 0x52, 0xf0, 0xad, 0x38, 0xbc,
+  0x84, 0x43, 0x14, 0xf1, 0xca, 0xe4, 0xb2, 0xf1, 0x1e, 0xa5, 0x4c, 0x1b, 0xc4, 0x76, 0x02, 0xe0,
+  0xa7, 0x99, 0x42, 0xf3, 0xac, 0xda, 0x34, 0x56, 0xf2, 0xa8, 0x3d, 0x0c, 0x18, 0xb3, 0xa7, 0x9e,
+  0xa2, 0x76, 0x10, 0x49, 0x99, 0x91, 0x10, 0x23, 0xb0, 0x73, 0x88, 0xc5, 0x31, 0x2f, 0xa9, 0xe4,
+  0x0c, 0x0f, 0x0f, 0xf3, 0xad, 0x4b, 0xca, 0x98, 0x51, 0x21, 0x68, 0xd7, 0xcb, 0x95, 0x0d, 0xf1,
+  0x21, 0x46, 0x8c, 0x86, 0x05, 0xd7, 0x73, 0x92, 0xcb, 0x0e, 0x16, 0x6c, 0xab, 0x0a, 0xf5, 0x95,
+  0x72, 0x49, 0x51, 0x6e, 0x90, 0x4a, 0x21, 0x47, 0xa5, 0xf2, 0x56, 0x75, 0xf5, 0x98, 0xe9, 0x2e,
+  0x98, 0x15, 0xdc, 0x52, 0x41, 0x55, 0xfc, 0xfe, 0x69, 0xb2, 0xb2, 0x9f, 0x94, 0x10, 0x75, 0x79,
+  0x7a, 0x72, 0x88, 0xaa, 0x60, 0x5a, 0x5d, 0xa0, 0xa5, 0xe0, 0x95, 0x50, 0x49, 0x35, 0xcc, 0xdb,
+  0x2b, 0x11, 0x2d, 0x83, 0x88, 0xce, 0xdb, 0xd6, 0x72, 0x25, 0x8a, 0xb7, 0x0f, 0xeb, 0xee, 0x42,
+  0xaa, 0x0c, 0xa8, 0x71, 0xb4, 0x35, 0x16, 0x02, 0x9e, 0x4d, 0xb4, 0x62, 0x46, 0xc0, 0x52, 0x8e,
+  0xe1, 0xc6, 0xa9, 0x3d, 0xa7, 0x36, 0xa7, 0x13, 0xac, 0x74, 0x54, 0x67, 0x12, 0x3e, 0x25, 0xa0,
+  0x7d, 0xaa, 0x2a, 0xfb, 0x82, 0xb3, 0xc8, 0xf2, 0xc9, 0xe7, 0x57, 0xe2, 0x3b, 0x9c, 0x6c, 0x16,
+  0xc7, 0x12, 0x26, 0x4d, 0x24, 0xf8, 0xd9, 0x13, 0x60, 0x0c, 0x48, 0xd9, 0xb9, 0x53, 0x76, 0x12,
+  0xa1, 0xcf, 0x58, 0x3b, 0x77, 0xce, 0x4a, 0x76, 0x3b, 0x48, 0x1c, 0x89, 0xcc, 0x64, 0x62, 0x27,
+  0x04, 0xd7, 0x51, 0x75, 0x12, 0x81, 0x33, 0x26, 0x7b, 0xd2, 0x03, 0x35, 0x2b, 0x11, 0x92, 0x5d,
+  0x07, 0x3a, 0x05, 0xe7, 0x1c, 0x10, 0xb1, 0x02, 0x06, 0x73, 0x5c, 0xcc, 0x5e, 0x55, 0xd0, 0xb0,
+  0xe0, 0xe4, 0xa7, 0xdd, 0x60, 0x8e, 0xa0, 0xb4, 0xa7, 0xab, 0xe2, 0x20, 0xa9, 0xf8, 0x16, 0x35,
+  0x27, 0x05, 0x76, 0xa0, 0x6e, 0xaf, 0x4e, 0x83, 0xd6, 0x43, 0xd9, 0x45, 0x94, 0x83, 0x59, 0x50,
+  0x34, 0xec, 0x98, 0x28, 0x60, 0x55, 0xac, 0xaa, 0x81, 0x83, 0x05, 0xcd, 0x0d, 0x0d, 0xe3, 0x06,
+  0x3c, 0xf7, 0xb0, 0xe1, 0x38, 0xfa, 0xbc, 0x11, 0x3f, 0x41, 0xda, 0x72, 0x80, 0xc5, 0xb0, 0x44,
+  0x8c, 0xd5, 0x13, 0x5e, 0x95, 0x7c, 0xc9, 0x72, 0x0c, 0xaf, 0x0e, 0xa7, 0x4a, 0x64, 0x4d, 0x2a,
+  0x28, 0xab, 0x32, 0x98, 0x3a, 0xee, 0xb4, 0x59, 0x36, 0xac, 0x9a, 0x1b, 0x17, 0x9d, 0x04, 0x49,
+  0x0f, 0x0e, 0x17, 0x65, 0xd7, 0x3d, 0xf0, 0x65, 0x0e, 0x06, 0x1b, 0x30, 0x94, 0x16, 0xc4, 0x2c,
+  0x80, 0x64, 0x23, 0x55, 0x00, 0xc1, 0xc3, 0x61, 0x82, 0x2e, 0x00, 0x8d, 0x0b, 0x5e, 0xef, 0xfa,
+  0x95, 0xeb, 0x1b, 0xd7, 0x3f, 0x1f, 0x20, 0x73, 0xff, 0xbd, 0x5b, 0x2c, 0xd3, 0xc7, 0x50, 0xdf,
+  0x7e, 0xf4, 0x09, 0xd7, 0xb7, 0xa0, 0x59, 0xc1, 0xd7, 0x83, 0x14, 0x90, 0xfa, 0xa0, 0x76, 0x3d,
+  0x2f, 0xf0, 0xdc, 0xf5, 0xe6, 0x37, 0x9f, 0x73, 0x2f, 0x10, 0xb5, 0xf0, 0xf5, 0xab, 0xcd, 0xd3,
+  0xb7, 0xc1, 0x77, 0xd8, 0xfc, 0xf3, 0xa7, 0x8d, 0xd3, 0x97, 0x9a, 0xb7, 0xbf, 0x6d, 0xdc, 0xfd,
+  0x92, 0x9a, 0x11, 0xc3, 0xb0, 0x73, 0x27, 0x6f, 0x95, 0x66, 0x86, 0x1c, 0x9a, 0xa7, 0xa0, 0x13,
+  0x80, 0x27, 0x8a, 0xb4, 0x04, 0xf6, 0x80, 0xa2, 0xdb, 0xc7, 0xd1, 0x58, 0x78, 0xe2, 0x84, 0x28,
+  0x53, 0x3f, 0x9e, 0xf0, 0x2b, 0x22, 0x71, 0xac, 0x22, 0xf4, 0x04, 0xc5, 0x48, 0x0c, 0x23, 0x65,
+  0x95, 0xf9, 0x98, 0xe4, 0x2e, 0xe6, 0xc9, 0x5c, 0xdc, 0xe7, 0x4c, 0xfd, 0x6b, 0xbc, 0x7e, 0x6b,
+  0xed, 0xde, 0x45, 0xcf, 0xc0, 0x80, 0x4e, 0xb0, 0xf8, 0xc6, 0x2f, 0xd7, 0x36, 0x6e, 0xbc, 0xc1,
+  0x15, 0x59, 0x02, 0xfc, 0xb5, 0x6f, 0xd7, 0xee, 0xdc, 0xc3, 0x5e, 0xdd, 0xfe, 0xa2, 0xf1, 0xfa,
+  0xed, 0xe6, 0xdb, 0x5f, 0x00, 0x09, 0x04, 0x38, 0x5f, 0x9c, 0x71, 0xbe, 0xe3, 0x38, 0x14, 0xf0,
+  0x18, 0xa7, 0xed, 0x3a, 0x28, 0x2b, 0xe2, 0xb1, 0x11, 0xd0, 0x00, 0x09, 0x45, 0x85, 0x91, 0xf2,
+  0xe0, 0x55, 0x8c, 0x12, 0x0c, 0x75, 0x6b, 0x8d, 0x69, 0xaf, 0xc6, 0x74, 0x64, 0x0d, 0xd9, 0x19,
+  0x52, 0x7b, 0xa9, 0x6a, 0xcd, 0x59, 0xf0, 0xf2, 0x05, 0x11, 0x28, 0x83, 0x8b, 0x0f, 0x10, 0x26,
+  0x9e, 0x0a, 0x4e, 0x88, 0x2a, 0xce, 0x82, 0x59, 0x84, 0x39, 0xe0, 0xe3, 0x5d, 0xa7, 0x59, 0xd2,
+  0x86, 0x3b, 0x38, 0x6f, 0x94, 0x03, 0xbc, 0x81, 0xad, 0x94, 0x53, 0x2e, 0xf1, 0x3e, 0x12, 0x5a,
+  0xb0, 0x9c, 0x47, 0x69, 0xae, 0xd0, 0xcb, 0x29, 0xf8, 0x1d, 0x94, 0x0c, 0xc6, 0x27, 0x1e, 0xb1,
+  0xa3, 0xdf, 0x73, 0x15, 0x08, 0x8e, 0xad, 0x07, 0x01, 0x33, 0x61, 0xfe, 0x81, 0x52, 0x80, 0x51,
+  0xb7, 0xc1, 0xbc, 0x5d, 0x9d, 0x72, 0x75, 0x97, 0x97, 0xcc, 0xf8, 0xac, 0x50, 0x26, 0x94, 0x3a,
+  0x41, 0x45, 0x63, 0x30, 0x16, 0x14, 0xa2, 0x8b, 0x28, 0xab, 0x48, 0xe2, 0x81, 0xa3, 0x69, 0x44,
+  0x8b, 0xbb, 0xc1, 0xf6, 0x33, 0xaf, 0x68, 0xeb, 0x65, 0x23, 0xa6, 0x31, 0x7d, 0x80, 0x0f, 0x2b,
+  0x08, 0x25, 0xfe, 0x34, 0xad, 0x71, 0x02, 0x03, 0x3c, 0xf8, 0xaf, 0x32, 0x20, 0xc0, 0x82, 0xc9,
+  0x02, 0x60, 0x06, 0x84, 0x2e, 0xab, 0x6b, 0x6c, 0x66, 0x31, 0xc5, 0x25, 0xc5, 0xac, 0x68, 0x46,
+  0x72, 0x47, 0xd0, 0xb4, 0xf1, 0xc6, 0x58, 0x98, 0x36, 0x8a, 0x32, 0x11, 0x12, 0xab, 0xbe, 0x03,
+  0x46, 0x6e, 0x4f, 0x37, 0x37, 0xc8, 0x87, 0xa5, 0x65, 0x3e, 0x2c, 0x4c, 0x2f, 0xf4, 0x77, 0xf6,
+  0xa2, 0x1b, 0x00, 0x9a, 0xc7, 0xca, 0xd7, 0xca, 0x46, 0xc5, 0x45, 0x91, 0x3a, 0x56, 0x32, 0xf0,
+  0x71, 0xef, 0xea, 0xc1, 0x42, 0x3c, 0xe6, 0xf9, 0x44, 0xb1, 0x84, 0xb4, 0x0a, 0x85, 0xc3, 0x70,
+  0x0c, 0xb7, 0x5b, 0x77, 0xa8, 0xa9, 0x7a, 0x3c, 0x7e, 0xe5, 0x65, 0x67, 0xca, 0xed, 0x54, 0x8b,
+  0x76, 0xf9, 0xf9, 0xc5, 0xe7, 0x2c, 0xb7, 0x73, 0x79, 0xbe, 0xc3, 0xcf, 0xaf, 0x50, 0x28, 0x8d,
+  0x2d, 0x41, 0xa6, 0x24, 0x89, 0xe0, 0x4d, 0x98, 0xd3, 0x9d, 0xc1, 0x88, 0x6d, 0x7f, 0x08, 0x47,
+  0xd4, 0x71, 0x38, 0x37, 0xf1, 0x2d, 0xc4, 0x7c, 0xf7, 0x12, 0xf0, 0x81, 0x4d, 0xdb, 0x92, 0xe0,
+  0x61, 0x15, 0xf7, 0x1b, 0xa5, 0xb9, 0xe1, 0x8e, 0x0f, 0xb8, 0x7d, 0x97, 0xac, 0x7a, 0x4a, 0x05,
+  0x0b, 0x5e, 0x24, 0x16, 0xf5, 0x12, 0xcc, 0xb3, 0x01, 0xfc, 0x75, 0x0c, 0x30, 0x0a, 0x4c, 0x7d,
+  0x7e, 0x80, 0x74, 0x94, 0xc6, 0xe6, 0x8c, 0x0a, 0x42, 0xe5, 0x39, 0x38, 0x8f, 0xc0, 0xc8, 0xa7,
+  0xda, 0x68, 0xe8, 0xd3, 0x03, 0x1a, 0xfb, 0xf2, 0x61, 0x5c, 0x00, 0x24, 0xbf, 0x80, 0x12, 0x71,
+  0x5b, 0x82, 0x48, 0x5c, 0x32, 0x2b, 0xbc, 0x20, 0x3c, 0xf0, 0xaa, 0xe8, 0x16, 0xc8, 0x07, 0x9e,
+  0xe2, 0x96, 0xab, 0x93, 0xf2, 0x41, 0x02, 0x73, 0x17, 0x20, 0x89, 0x5b, 0xcd, 0xee, 0xc2, 0x38,
+  0x7f, 0x44, 0x96, 0xe1, 0x66, 0x36, 0x0c, 0x3d, 0xaa, 0x0c, 0xdb, 0x63, 0x38, 0x5f, 0x4f, 0x16,
+  0xcb, 0x6e, 0x7c, 0x49, 0x63, 0x95, 0xa1, 0xac, 0x6a, 0x9a, 0xae, 0x40, 0x49, 0x6e, 0xca, 0xc6,
+  0x97, 0x88, 0x73, 0x85, 0xf9, 0xcb, 0xd3, 0x52, 0xa6, 0xb3, 0x1f, 0x0f, 0x70, 0x19, 0xf1, 0x95,
+  0x04, 0xfb, 0x0d, 0x5b, 0x49, 0xb9, 0xd6, 0x7e, 0x73, 0xc5, 0x28, 0xc4, 0xc1, 0xfe, 0x80, 0x59,
+  0x93, 0x4c, 0xc6, 0x48, 0xca, 0xa0, 0x83, 0xa1, 0x44, 0x95, 0x40, 0xbc, 0x7a, 0x1a, 0x83, 0x47,
+  0x95, 0x58, 0x7c, 0x62, 0x6a, 0x72, 0xe4, 0x30, 0x83, 0x22, 0x3c, 0xc0, 0x74, 0xf6, 0x9c, 0x70,
+  0xca, 0x06, 0x85, 0x6b, 0x02, 0x2e, 0x1b, 0x68, 0x90, 0xc6, 0xa9, 0xbb, 0xd8, 0x07, 0xd6, 0xf8,
+  0xe9, 0x56, 0xf3, 0xad, 0x33, 0x9b, 0xe0, 0xbd, 0x9d, 0x3d, 0x03, 0x1e, 0x4b, 0xf3, 0xcd, 0xfb,
+  0xf0, 0x17, 0xbc, 0x16, 0x74, 0x46, 0xae, 0xbe, 0xb6, 0xf1, 0xd5, 0x69, 0x0d, 0xdb, 0xe4, 0x41,
+  0x29, 0xee, 0xf8, 0x6d, 0x9e, 0xfc, 0x70, 0xe3, 0xc1, 0x29, 0x26, 0xa3, 0x3a, 0x8c, 0x07, 0x2b,
+  0x58, 0x7c, 0x74, 0xea, 0x59, 0xd6, 0xed, 0x7b, 0x9b, 0xd2, 0xdb, 0x9a, 0x98, 0x1c, 0x7b, 0xf6,
+  0xe0, 0xd8, 0xb1, 0xe7, 0x27, 0x9f, 0x39, 0x86, 0x8e, 0x60, 0x5f, 0x3a, 0xe0, 0x0e, 0x04, 0xa2,
+  0x54, 0xfc, 0x20, 0x87, 0x01, 0xec, 0x14, 0x8f, 0x11, 0x78, 0x24, 0x72, 0x2c, 0x91, 0x02, 0x07,
+  0xbd, 0x02, 0x4a, 0x8d, 0x64, 0xaa, 0x9d, 0x7a, 0xc1, 0xb1, 0x2a, 0xf1, 0x84, 0x48, 0xb5, 0x41,
+  0x8c, 0x19, 0x36, 0x56, 0x4f, 0xa4, 0xf2, 0x3a, 0xd6, 0x14, 0xaa, 0xbf, 0x9e, 0x90, 0xf4, 0x9a,
+  0x1c, 0x67, 0xcd, 0x5b, 0xa7, 0x9b, 0x2f, 0xdf, 0xc0, 0x10, 0xdb, 0x2f, 0xbf, 0xa0, 0x47, 0x76,
+  0xe1, 0x34, 0x74, 0x9b, 0x47, 0xc4, 0x58, 0x9c, 0xa8, 0x40, 0x51, 0x9b, 0x6e, 0x1e, 0xcb, 0x49,
+  0xf8, 0xe8, 0x39, 0xf9, 0x05, 0xa3, 0x50, 0x2b, 0x19, 0xd8, 0xc0, 0x24, 0x47, 0x55, 0xa0, 0x89,
+  0x82, 0xd2, 0xe3, 0x01, 0xd5, 0x34, 0x57, 0x19, 0x43, 0x31, 0x2b, 0x04, 0x5a, 0xad, 0x7c, 0x13,
+  0x24, 0xc1, 0x20, 0x4a, 0xb8, 0x1c, 0x19, 0x1e, 0xf5, 0x00, 0x99, 0x64, 0x37, 0xe3, 0x2f, 0x08,
+  0xeb, 0x4b, 0x88, 0xa7, 0x94, 0x09, 0xaa, 0xc1, 0x3e, 0x30, 0x7d, 0x78, 0x1c, 0x00, 0xbe, 0x80,
+  0xbb, 0xd5, 0x9d, 0x54, 0x59, 0xaf, 0x4a, 0x72, 0x1d, 0xdf, 0x21, 0x62, 0x5a, 0x32, 0x42, 0x02,
+  0x8a, 0x5f, 0x9e, 0x3e, 0xfb, 0x0d, 0x8b, 0xf9, 0xdb, 0xec, 0x63, 0xc8, 0x65, 0xb1, 0xba, 0x1f,
+  0xc8, 0x74, 0x0b, 0xc3, 0x58, 0xd6, 0x2c, 0xd4, 0xf7, 0x74, 0xc3, 0xb3, 0x7c, 0x5f, 0x34, 0x2b,
+  0xa1, 0x14, 0x1f, 0x1a, 0x0c, 0xfc, 0xc6, 0x95, 0xb7, 0xd6, 0xee, 0x7c, 0x83, 0xc0, 0x6c, 0xd4,
+  0x3b, 0x30, 0x54, 0xbc, 0x70, 0x08, 0x2a, 0x29, 0xec, 0xc3, 0x4e, 0x10, 0x50, 0xa1, 0xc6, 0x0f,
+  0x14, 0x86, 0xd3, 0x1d, 0xbd, 0x5c, 0x2d, 0x19, 0xa1, 0x44, 0x7d, 0x49, 0x37, 0xe9, 0x8a, 0x9b,
+  0x08, 0xf8, 0x38, 0xff, 0x6c, 0xa0, 0xc2, 0x0a, 0x05, 0xcd, 0xb4, 0x6c, 0x42, 0xad, 0xaa, 0x64,
+  0x16, 0xb4, 0x4c, 0x74, 0x16, 0x05, 0xd2, 0x80, 0x99, 0x33, 0xe9, 0x74, 0x5a, 0xcb, 0x25, 0xda,
+  0x36, 0x81, 0x42, 0xe6, 0x70, 0xb9, 0x43, 0xc1, 0x1d, 0xdb, 0x8d, 0xd6, 0x0a, 0x7d, 0x00, 0x23,
+  0x1c, 0x17, 0x54, 0xd7, 0x58, 0xb0, 0x9b, 0xb8, 0x0b, 0xe3, 0xd3, 0x2f, 0xd6, 0x2f, 0x9f, 0x6d,
+  0x8d, 0xe1, 0x6e, 0x19, 0x78, 0x85, 0x61, 0x1e, 0x12, 0x60, 0x9f, 0xf2, 0xa2, 0xb9, 0xe1, 0x00,
+  0xee, 0x43, 0x43, 0x89, 0x08, 0xe5, 0xfa, 0xfd, 0xa7, 0xe0, 0xe2, 0xf1, 0x44, 0xea, 0x05, 0x0b,
+  0xbc, 0xaa, 0x58, 0x2c, 0xc4, 0xcf, 0x4a, 0x77, 0x31, 0x9c, 0xe3, 0xf5, 0x52, 0x95, 0x97, 0x60,
+  0x6d, 0x9a, 0x68, 0x37, 0x71, 0xdf, 0x4c, 0x5f, 0x89, 0x67, 0x34, 0xfe, 0x9c, 0x37, 0xcc, 0x52,
+  0xdc, 0xab, 0x02, 0xd4, 0x57, 0x45, 0x0c, 0xf7, 0xb4, 0xb8, 0x10, 0x39, 0x1e, 0x42, 0x5d, 0xe9,
+  0xfe, 0x53, 0x04, 0x1d, 0xd2, 0xe8, 0x17, 0x8c, 0xe0, 0x90, 0x90, 0x41, 0xcb, 0xc1, 0x13, 0x32,
+  0x64, 0x12, 0xb6, 0xd8, 0xfb, 0xb8, 0xd1, 0x03, 0x35, 0x29, 0x66, 0xca, 0x78, 0xc5, 0x1f, 0x2a,
+  0x20, 0xae, 0x8a, 0x66, 0xc9, 0x05, 0x21, 0x1f, 0x2f, 0x51, 0x95, 0x12, 0x5a, 0x61, 0x8f, 0x95,
+  0x02, 0x36, 0xea, 0xe3, 0xb1, 0x84, 0x62, 0x75, 0x3f, 0x46, 0x90, 0x3c, 0x87, 0x55, 0x35, 0x8b,
+  0xb7, 0xb4, 0x1f, 0x30, 0x74, 0x09, 0x4d, 0x2a, 0x42, 0x40, 0x8c, 0x44, 0x0c, 0xe3, 0xd8, 0x31,
+  0xf0, 0xfc, 0x08, 0xf8, 0x4c, 0x7a, 0x56, 0x09, 0xa9, 0x70, 0x01, 0xb1, 0xc0, 0x05, 0x04, 0x46,
+  0x86, 0x9f, 0x38, 0xb1, 0x50, 0xa7, 0xe8, 0xb0, 0x32, 0x60, 0x50, 0x35, 0x46, 0x83, 0x18, 0xdb,
+  0x26, 0x2a, 0xdc, 0x0e, 0x0a, 0xc8, 0x23, 0xde, 0x31, 0x6e, 0x27, 0x66, 0x44, 0xb3, 0x44, 0x95,
+  0x16, 0x24, 0x5b, 0xb0, 0x5b, 0x92, 0xd8, 0xe1, 0x6c, 0x5b, 0xe2, 0x13, 0x2b, 0x12, 0x3b, 0x95,
+  0xc5, 0xc8, 0xe8, 0xf4, 0x0d, 0xb0, 0x14, 0x45, 0x92, 0x53, 0x22, 0x90, 0x2c, 0x62, 0x64, 0x2d,
+  0x65, 0xe8, 0x00, 0xcc, 0x34, 0x45, 0x30, 0xb8, 0x59, 0xd8, 0x56, 0x93, 0x0c, 0x29, 0xff, 0x63,
+  0x8d, 0x8f, 0x7e, 0xd9, 0xb8, 0x72, 0x6d, 0x80, 0xf1, 0xe5, 0x80, 0xc6, 0x5b, 0x17, 0x41, 0x3b,
+  0xae, 0xdf, 0x7b, 0x0d, 0x97, 0x46, 0x76, 0xa2, 0xe2, 0x6d, 0xbc, 0x7a, 0x7e, 0xfd, 0x87, 0xcf,
+  0x40, 0xd3, 0xe2, 0xe6, 0xb1, 0x6e, 0xe0, 0x5f, 0xc6, 0x75, 0x6b, 0x00, 0x0a, 0x8f, 0x89, 0x82,
+  0x9b, 0xb8, 0x76, 0xe7, 0xee, 0xe6, 0xc9, 0x0b, 0xa0, 0xac, 0xc5, 0x32, 0x1f, 0xf7, 0x9f, 0x06,
+  0x59, 0xf3, 0x12, 0x78, 0x8a, 0x77, 0xd7, 0xee, 0xdd, 0x6a, 0x5e, 0xfa, 0x8c, 0x97, 0x6c, 0x5e,
+  0x02, 0x9f, 0xeb, 0x0b, 0x36, 0xc2, 0xc8, 0xdb, 0xea, 0x85, 0xc2, 0x09, 0xb6, 0x76, 0xef, 0x2f,
+  0xcd, 0x8f, 0x1e, 0x08, 0x85, 0x3b, 0x79, 0xf0, 0xc8, 0x6f, 0x9f, 0x3f, 0x02, 0xbd, 0xe9, 0x49,
+  0xef, 0xee, 0x1b, 0x54, 0x13, 0x0f, 0x8f, 0x4c, 0x1d, 0x82, 0x74, 0x51, 0x20, 0x89, 0xa7, 0xd5,
+  0x78, 0xee, 0xb1, 0x83, 0x47, 0xf6, 0x3d, 0x73, 0xec, 0xf9, 0xa9, 0xe9, 0xc9, 0x31, 0x30, 0x1d,
+  0x86, 0x50, 0x01, 0xa5, 0x07, 0x65, 0x40, 0xb3, 0xcf, 0x61, 0xff, 0xc1, 0xb1, 0x0a, 0x96, 0xc6,
+  0x4d, 0xff, 0x7b, 0xc1, 0x97, 0xe4, 0xe5, 0x07, 0x83, 0xa5, 0xbd, 0xc2, 0xfb, 0xd1, 0x4a, 0x54,
+  0x6c, 0x44, 0x69, 0x07, 0x66, 0xa4, 0xb9, 0x98, 0x95, 0x66, 0x62, 0x4e, 0x58, 0x86, 0x3d, 0x9a,
+  0x34, 0xe3, 0x7a, 0x35, 0x61, 0xf6, 0xf5, 0x49, 0xb3, 0x6f, 0x97, 0x34, 0xfb, 0xfa, 0xa5, 0xd9,
+  0xb7, 0x5b, 0x5a, 0x73, 0x19, 0xcf, 0x9c, 0xcb, 0x64, 0xd0, 0x25, 0x93, 0xb1, 0x37, 0xdb, 0xa4,
+  0x59, 0xaa, 0x44, 0x17, 0x4f, 0x30, 0x3e, 0xd5, 0xf0, 0x48, 0x31, 0xaa, 0x5b, 0x3e, 0xce, 0x2d,
+  0x31, 0x21, 0x4e, 0xa6, 0x84, 0x88, 0x73, 0xa2, 0x2b, 0x7c, 0x00, 0x57, 0x10, 0xbc, 0xb8, 0x2a,
+  0x5f, 0x48, 0x9f, 0x32, 0x0c, 0x50, 0x58, 0x14, 0xf4, 0x30, 0x76, 0xab, 0x19, 0x93, 0x2b, 0x3c,
+  0x28, 0xca, 0xdf, 0xa2, 0x42, 0xa1, 0x7a, 0xb5, 0x0a, 0x6a, 0x7d, 0x8a, 0xf2, 0xe3, 0xe0, 0xf3,
+  0x54, 0x84, 0x01, 0x14, 0x15, 0xf2, 0x09, 0xc4, 0x79, 0x78, 0xd7, 0xcc, 0x02, 0xb6, 0x10, 0xf7,
+  0x10, 0xdb, 0xc9, 0xcc, 0x04, 0x78, 0xfc, 0xde, 0x48, 0x73, 0x56, 0xf7, 0xa0, 0x15, 0x39, 0xb4,
+  0x22, 0x40, 0xcb, 0x64, 0xe1, 0x17, 0xc1, 0x71, 0xea, 0xcc, 0x14, 0x67, 0x67, 0x00, 0x18, 0x46,
+  0x8d, 0x16, 0x67, 0x30, 0x50, 0x04, 0x64, 0xd9, 0xc9, 0x8a, 0x5e, 0x3c, 0xc8, 0x6f, 0x81, 0x22,
+  0x42, 0xcc, 0xef, 0x60, 0x6b, 0x88, 0x08, 0xfd, 0xe9, 0xfd, 0x3a, 0x1e, 0x28, 0xcb, 0x2f, 0xc6,
+  0x55, 0x69, 0xce, 0xb1, 0xf5, 0x40, 0x85, 0xf0, 0x9c, 0x21, 0x87, 0x22, 0x45, 0x6c, 0xa2, 0x71,
+  0xef, 0x22, 0xc5, 0x39, 0x45, 0xbe, 0x21, 0xb3, 0xc8, 0x67, 0xe4, 0x17, 0xf9, 0xcc, 0x97, 0x03,
+  0xe8, 0x91, 0xb8, 0x06, 0x0d, 0x77, 0xf1, 0x8e, 0xbc, 0xa3, 0xf9, 0xcf, 0xe3, 0xf2, 0x19, 0x39,
+  0x48, 0x79, 0xf6, 0xd2, 0x91, 0x8f, 0x94, 0xe7, 0xf1, 0x59, 0x22, 0x60, 0x0a, 0x28, 0x38, 0xa6,
+  0xa3, 0x38, 0x00, 0x93, 0xbe, 0x28, 0xac, 0xb8, 0x16, 0xc2, 0x2d, 0x0d, 0x8a, 0x58, 0x92, 0xec,
+  0x21, 0xc6, 0x63, 0x54, 0xc2, 0x94, 0x17, 0x47, 0x71, 0xc9, 0x99, 0xd4, 0x1d, 0x9e, 0xb4, 0x33,
+  0x1c, 0x95, 0x3a, 0x62, 0x65, 0xba, 0xbd, 0x0f, 0x66, 0xf2, 0x18, 0x05, 0xaf, 0xe9, 0xa3, 0x24,
+  0xb4, 0x12, 0x73, 0x53, 0x25, 0x2b, 0x2a, 0xae, 0x09, 0x76, 0x24, 0xe4, 0x2d, 0x98, 0xed, 0xf2,
+  0xea, 0xaa, 0x23, 0x72, 0x42, 0xa0, 0x01, 0xf3, 0xc8, 0x5d, 0x19, 0x10, 0x2f, 0x88, 0xc8, 0x28,
+  0x5e, 0x6c, 0x00, 0xfa, 0x30, 0x96, 0x2d, 0x60, 0x3c, 0x9e, 0x23, 0x01, 0xa5, 0xb8, 0x93, 0x47,
+  0x13, 0x5b, 0x04, 0x41, 0x44, 0x6f, 0xb0, 0xa7, 0x23, 0xb8, 0x7b, 0x04, 0xc3, 0x18, 0xa2, 0xe3,
+  0x31, 0x65, 0x53, 0x09, 0xb8, 0xff, 0x33, 0xd0, 0xee, 0x09, 0x56, 0x1c, 0x60, 0xfb, 0xe5, 0xa8,
+  0xd3, 0x2e, 0x5c, 0x30, 0x42, 0xc9, 0x68, 0x83, 0x12, 0xe2, 0xa4, 0x65, 0x4c, 0x5c, 0xe6, 0x07,
+  0x29, 0xf2, 0xd4, 0x61, 0x0a, 0xe4, 0x81, 0xbe, 0x62, 0x3a, 0xd4, 0xae, 0xe6, 0x03, 0x92, 0x1c,
+  0x23, 0x21, 0xf1, 0x4d, 0x31, 0x2a, 0x28, 0x7e, 0x0d, 0xa0, 0x0a, 0xaa, 0x27, 0x1a, 0x14, 0x67,
+  0x37, 0x09, 0x08, 0x37, 0xd5, 0x04, 0xc0, 0xd0, 0xe5, 0x81, 0x2a, 0x98, 0xac, 0x02, 0x66, 0xc7,
+  0xac, 0xe7, 0x70, 0x53, 0x9f, 0x47, 0x5d, 0x1e, 0xcf, 0x09, 0x12, 0x02, 0x37, 0xb7, 0x84, 0xe9,
+  0x50, 0x50, 0xa8, 0x70, 0x70, 0x5f, 0x67, 0xc4, 0x7b, 0xa3, 0x11, 0xe7, 0x73, 0x43, 0x42, 0xc1,
+  0xcd, 0x14, 0x9d, 0x49, 0x99, 0x8d, 0x06, 0xc3, 0xe7, 0x92, 0x07, 0x87, 0x0c, 0x62, 0x5a, 0x6e,
+  0x53, 0xa1, 0xf1, 0x2b, 0x13, 0x23, 0xa1, 0x65, 0x5a, 0xc9, 0x70, 0x18, 0xb7, 0xd2, 0xb4, 0xd2,
+  0x81, 0x76, 0xd8, 0x04, 0x09, 0xc1, 0x27, 0xae, 0x6c, 0x7b, 0x14, 0xde, 0x3a, 0xf7, 0x21, 0x17,
+  0xdd, 0x07, 0x3e, 0xe7, 0x15, 0x30, 0xe3, 0x01, 0xe4, 0xf3, 0xf9, 0xfe, 0x62, 0x71, 0x1b, 0x60,
+  0xb8, 0xb8, 0x90, 0x60, 0x46, 0xe0, 0xad, 0xf3, 0xc0, 0x64, 0xdb, 0x82, 0x19, 0x0f, 0x80, 0x19,
+  0x0f, 0x72, 0x94, 0xde, 0xd7, 0x63, 0x6c, 0x03, 0x0c, 0x17, 0x52, 0x5e, 0xa7, 0xe0, 0x0d, 0x57,
+  0x36, 0x3b, 0x8f, 0x4a, 0x46, 0x19, 0x95, 0x20, 0xa8, 0xf1, 0x00, 0xa8, 0xf1, 0x30, 0xa8, 0x5c,
+  0x31, 0x5f, 0xdc, 0x5d, 0x68, 0x07, 0x2a, 0x3c, 0xc0, 0x14, 0x56, 0xf2, 0xe7, 0xbe, 0xe6, 0x73,
+  0xbf, 0xa6, 0x70, 0xc0, 0xac, 0xaa, 0x02, 0x0b, 0xb6, 0xbe, 0xcc, 0xb9, 0x21, 0x8f, 0x8d, 0x54,
+  0x0a, 0xd6, 0xf2, 0x91, 0x80, 0x0f, 0x50, 0x45, 0x8e, 0xe1, 0x19, 0x29, 0x7e, 0xf1, 0xe9, 0x84,
+  0xb9, 0x62, 0x94, 0x26, 0xd1, 0x51, 0xc4, 0x25, 0xba, 0x8c, 0xbf, 0xcc, 0x96, 0x5f, 0x86, 0xa2,
+  0xf9, 0x94, 0x10, 0x5b, 0xe0, 0x57, 0x81, 0xec, 0x3c, 0xc6, 0x2f, 0x49, 0xcd, 0x2f, 0xb4, 0x66,
+  0x1d, 0x30, 0xe4, 0xd1, 0x76, 0xb4, 0xc1, 0xa1, 0x32, 0xc6, 0xbc, 0xa1, 0xcc, 0x32, 0x82, 0x85,
+  0x0a, 0xe2, 0xd5, 0x5f, 0x41, 0x4a, 0xf1, 0x06, 0x96, 0x07, 0x29, 0x19, 0x1f, 0x17, 0x06, 0x65,
+  0x0e, 0x07, 0xcc, 0xb7, 0xdc, 0x0a, 0x8f, 0x85, 0xb6, 0xe6, 0x22, 0xdc, 0xa7, 0xb1, 0x17, 0x89,
+  0x50, 0x51, 0xbe, 0x6f, 0x36, 0x54, 0x76, 0x41, 0x29, 0x5b, 0xf7, 0xfb, 0xe5, 0xae, 0x70, 0xec,
+  0x5d, 0x7e, 0xab, 0x85, 0xbb, 0x82, 0x8b, 0x4e, 0xd3, 0xf2, 0x56, 0xa2, 0x38, 0xd4, 0xd0, 0x50,
+  0x0e, 0x63, 0xd0, 0x4b, 0x3e, 0x26, 0x64, 0xc9, 0x7c, 0xc9, 0xd0, 0xed, 0x49, 0x8c, 0x1d, 0xf3,
+  0x12, 0xf9, 0x65, 0xa4, 0x46, 0x82, 0xd6, 0xf6, 0x04, 0x89, 0x6b, 0x7a, 0x89, 0xe0, 0x0b, 0xdd,
+  0xe2, 0x58, 0x65, 0x43, 0x2a, 0x16, 0x37, 0x85, 0x83, 0x2d, 0xa2, 0xc6, 0x3e, 0xa5, 0xab, 0x7a,
+  0x01, 0xad, 0xfb, 0x1c, 0xc8, 0x4e, 0x78, 0x9c, 0x44, 0xb5, 0x85, 0x40, 0x7e, 0xc3, 0x72, 0xfd,
+  0x8c, 0x8c, 0x35, 0x48, 0xc5, 0x40, 0x6c, 0x86, 0x3f, 0xee, 0x45, 0x5b, 0x54, 0xa9, 0x5d, 0xb2,
+  0xdc, 0x63, 0x44, 0x49, 0x30, 0x41, 0x09, 0x14, 0xfd, 0x00, 0x57, 0x63, 0xce, 0x01, 0x22, 0x2c,
+  0x4f, 0x9a, 0xe6, 0x3f, 0x7b, 0x95, 0x31, 0xb6, 0x4a, 0x8e, 0x24, 0x5a, 0xb1, 0x64, 0x59, 0x76,
+  0x9c, 0xa0, 0x79, 0x0b, 0xa9, 0x94, 0xbf, 0x87, 0x65, 0x71, 0x0c, 0x39, 0x34, 0xb0, 0x76, 0xd2,
+  0xbe, 0x4f, 0xb5, 0x83, 0x2f, 0xcb, 0x80, 0x75, 0x7e, 0xfa, 0xd2, 0xc6, 0x97, 0x6f, 0xac, 0x7f,
+  0x74, 0x51, 0x72, 0x5d, 0x37, 0x55, 0x5d, 0xbb, 0xf3, 0xb5, 0xdc, 0x5a, 0x87, 0xa6, 0xba, 0xb0,
+  0xdc, 0xe1, 0xe5, 0xe6, 0xc5, 0xc6, 0xf7, 0x37, 0xd7, 0xee, 0x9c, 0x5b, 0xfb, 0xf9, 0xc3, 0x8d,
+  0xab, 0x7f, 0xe3, 0x96, 0x7c, 0xf3, 0xed, 0x33, 0x1e, 0x62, 0x45, 0xd3, 0x26, 0x03, 0xcf, 0x33,
+  0x70, 0x92, 0xcc, 0x5b, 0x53, 0x14, 0x2d, 0x68, 0x5e, 0xa6, 0x42, 0xca, 0x39, 0x9d, 0xd6, 0xab,
+  0x94, 0x6a, 0xa2, 0xb4, 0x5f, 0x84, 0x8e, 0xa2, 0xe0, 0xd4, 0x9a, 0x39, 0x58, 0x29, 0x62, 0x88,
+  0x70, 0x55, 0x63, 0x49, 0xf9, 0x38, 0x0b, 0x82, 0x33, 0x2a, 0x99, 0x8c, 0x37, 0x6f, 0x4c, 0xc3,
+  0xf6, 0x82, 0xbf, 0xe0, 0x03, 0x76, 0x83, 0x5c, 0xea, 0x20, 0x86, 0x07, 0x22, 0x24, 0x3a, 0xd8,
+  0x13, 0x94, 0xdf, 0xde, 0xa4, 0x10, 0xd9, 0x75, 0xc5, 0x4a, 0x75, 0xec, 0x3c, 0x05, 0xc2, 0xc8,
+  0x5e, 0x72, 0x53, 0xc5, 0xd9, 0x41, 0x25, 0x13, 0x27, 0x37, 0x75, 0x6f, 0x86, 0x73, 0xda, 0x6c,
+  0xc8, 0x66, 0x5d, 0xe1, 0x36, 0xeb, 0x0a, 0x8c, 0x22, 0x82, 0x86, 0x27, 0xdf, 0x08, 0x96, 0x30,
+  0x74, 0x35, 0x44, 0x40, 0xc3, 0xa0, 0x71, 0xaa, 0xee, 0x54, 0xd9, 0x64, 0x05, 0xa6, 0x96, 0xa0,
+  0x2c, 0xeb, 0xe6, 0xdd, 0xf4, 0x16, 0x7d, 0xc4, 0x48, 0xa8, 0x70, 0x74, 0xa8, 0x9d, 0x89, 0x82,
+  0x03, 0x80, 0x76, 0xe2, 0x0a, 0x4a, 0x7b, 0x68, 0xb4, 0xe5, 0x02, 0x89, 0xe7, 0x0f, 0x0b, 0x11,
+  0xcb, 0x1b, 0x1b, 0x59, 0x30, 0x60, 0xe7, 0xeb, 0xdc, 0xce, 0x9f, 0xc3, 0x60, 0x01, 0x3e, 0x48,
+  0x86, 0x08, 0xd8, 0xfd, 0x3e, 0xb2, 0xb8, 0xcd, 0x01, 0x28, 0x0b, 0xd6, 0xba, 0x62, 0x48, 0xcf,
+  0x0e, 0x7a, 0xa5, 0x70, 0x6c, 0x97, 0x00, 0x4c, 0xc9, 0x4a, 0x70, 0x64, 0x96, 0xc2, 0x79, 0xc3,
+  0x80, 0x55, 0x82, 0x63, 0xe6, 0xe5, 0xd5, 0xe5, 0xd2, 0x18, 0x8c, 0xfe, 0x0c, 0x99, 0xb5, 0x25,
+  0x8b, 0x0f, 0x36, 0x7f, 0x5b, 0x30, 0xd5, 0x75, 0x32, 0x80, 0x0b, 0x78, 0xce, 0xa4, 0x67, 0x13,
+  0xf4, 0x97, 0x97, 0x56, 0xf2, 0x01, 0xf6, 0x30, 0xe4, 0x64, 0x28, 0x3f, 0xa3, 0xd6, 0xa7, 0x45,
+  0x33, 0x75, 0x83, 0x04, 0x5e, 0xab, 0x26, 0x59, 0x81, 0xbb, 0xff, 0x33, 0x78, 0x93, 0xcb, 0x82,
+  0x39, 0x1b, 0xe2, 0xd7, 0xc7, 0x08, 0x2a, 0xb6, 0x94, 0x40, 0x36, 0xa5, 0xae, 0x25, 0x33, 0x83,
+  0xbc, 0x1f, 0x99, 0x20, 0xe7, 0x55, 0xc9, 0x59, 0xf3, 0x86, 0x14, 0x6b, 0x26, 0x89, 0x20, 0x4f,
+  0xf3, 0xfd, 0x3d, 0x19, 0x23, 0x99, 0x93, 0x2b, 0x48, 0x16, 0x6e, 0x30, 0xa8, 0x22, 0xb9, 0xa1,
+  0xd4, 0x4e, 0xfe, 0xb8, 0xc3, 0x5f, 0xa3, 0xa4, 0xa6, 0x10, 0x1f, 0x8d, 0x2d, 0x0e, 0x08, 0xc1,
+  0xd2, 0xcd, 0x7c, 0x88, 0xf5, 0xc1, 0x50, 0x8f, 0x56, 0x9f, 0x29, 0xd2, 0x86, 0x0a, 0xd0, 0x6a,
+  0x3c, 0x90, 0x41, 0xd2, 0x6c, 0xa7, 0xa8, 0x9a, 0xc4, 0x01, 0x48, 0x42, 0xb7, 0x53, 0x1c, 0x1d,
+  0x78, 0x58, 0xe4, 0x12, 0x19, 0x24, 0x36, 0x1e, 0x8f, 0xc0, 0x50, 0x05, 0xdd, 0x80, 0xe7, 0xdf,
+  0x08, 0x1d, 0x93, 0x12, 0x1d, 0x63, 0x2a, 0xc7, 0x84, 0xa2, 0xc9, 0x78, 0x0a, 0xc1, 0xb5, 0xad,
+  0x45, 0x63, 0x0a, 0xc3, 0x1d, 0x58, 0xf7, 0x71, 0xbc, 0x73, 0x26, 0xa7, 0x7b, 0x75, 0x8a, 0x66,
+  0xa9, 0xe4, 0x67, 0xf6, 0x15, 0xfb, 0x7b, 0x76, 0xef, 0xf6, 0x32, 0xd1, 0xb4, 0xdf, 0x0b, 0x8c,
+  0x8e, 0x80, 0x31, 0xbf, 0x6c, 0x16, 0x0a, 0x60, 0xa2, 0x07, 0x76, 0x1f, 0xcc, 0xf3, 0x89, 0x38,
+  0xcf, 0xf6, 0xa0, 0x28, 0x67, 0xf3, 0x61, 0x5f, 0x74, 0x35, 0xa8, 0xc9, 0x02, 0xbd, 0x7d, 0x1a,
+  0xaa, 0x75, 0xb3, 0x1e, 0x0c, 0xd9, 0xa4, 0x53, 0xbd, 0x62, 0xfa, 0x43, 0xbb, 0x73, 0xc6, 0xbc,
+  0x59, 0x99, 0x80, 0x4a, 0x72, 0x2d, 0x15, 0x13, 0xcb, 0xd6, 0x92, 0x31, 0x6d, 0x21, 0x00, 0x30,
+  0x4d, 0x56, 0x95, 0x0c, 0xc4, 0x4e, 0x64, 0x00, 0x20, 0x9c, 0x72, 0xc1, 0x7c, 0x4e, 0x01, 0x0f,
+  0x14, 0x9f, 0x25, 0x69, 0x9c, 0x26, 0xc8, 0x5c, 0x18, 0xff, 0xa2, 0xd1, 0x8a, 0x07, 0x5f, 0xbd,
+  0x37, 0x3e, 0x10, 0x84, 0xa8, 0x0f, 0x13, 0x29, 0x33, 0x82, 0x37, 0xce, 0x20, 0x59, 0xe8, 0x70,
+  0x49, 0xcc, 0xcf, 0x44, 0x9a, 0x4e, 0xa3, 0x57, 0x54, 0x2c, 0xbb, 0xd3, 0x26, 0x78, 0xbb, 0x4b,
+  0xe9, 0x84, 0x26, 0xf5, 0x59, 0xce, 0x47, 0x8e, 0x56, 0xa8, 0x41, 0x3d, 0x86, 0xe5, 0xd6, 0x52,
+  0xc6, 0x43, 0x2e, 0x13, 0x44, 0x2e, 0x13, 0x40, 0x2e, 0x13, 0x81, 0x5c, 0x04, 0x7a, 0x78, 0xb5,
+  0x48, 0x4c, 0xcd, 0x6d, 0xc5, 0x2f, 0x23, 0xf1, 0xe3, 0xf4, 0x83, 0x1f, 0x05, 0x4d, 0x9a, 0x93,
+  0x3b, 0xb6, 0x54, 0x1a, 0x72, 0xc2, 0x7a, 0xb8, 0x07, 0x04, 0x77, 0x2b, 0x2b, 0xba, 0x29, 0x32,
+  0x26, 0x83, 0xe3, 0x28, 0xd9, 0xd7, 0xe5, 0x16, 0x53, 0x07, 0x96, 0x40, 0xde, 0xe3, 0xbb, 0x40,
+  0x68, 0x21, 0xf0, 0xa1, 0xd4, 0x03, 0x97, 0x17, 0x52, 0x7a, 0x0d, 0x0f, 0x49, 0xb1, 0x46, 0x92,
+  0x43, 0x05, 0x4a, 0x17, 0xec, 0x9b, 0x95, 0x9a, 0x31, 0xe8, 0x49, 0x40, 0x21, 0x41, 0xb0, 0x01,
+  0x41, 0xb1, 0x15, 0x95, 0x7d, 0x3d, 0xb6, 0x3f, 0x80, 0x72, 0x07, 0x26, 0x3b, 0xcd, 0x74, 0xd1,
+  0x54, 0x60, 0x33, 0x01, 0xb4, 0x93, 0x08, 0xf0, 0x2f, 0x18, 0x13, 0x50, 0x0b, 0x94, 0x24, 0x2d,
+  0xb7, 0xab, 0x2c, 0x2f, 0x73, 0xd4, 0xad, 0x08, 0x42, 0x10, 0xa3, 0x6a, 0x96, 0xd0, 0x5b, 0xa0,
+  0x79, 0xad, 0x8b, 0xde, 0x49, 0x00, 0xbc, 0x8b, 0xb8, 0x9a, 0xaa, 0x6e, 0xb1, 0x08, 0xcf, 0x95,
+  0x7a, 0xc2, 0x93, 0x3c, 0xd1, 0xfc, 0x44, 0xfa, 0x4c, 0x21, 0x44, 0x76, 0x6b, 0xcb, 0x22, 0x2c,
+  0x72, 0x5a, 0x98, 0x00, 0x33, 0xc9, 0x28, 0x2d, 0x41, 0x07, 0xc0, 0x8a, 0xec, 0x87, 0xff, 0x12,
+  0x83, 0x91, 0x75, 0x63, 0x8f, 0xef, 0xd6, 0xe7, 0x32, 0xf9, 0xbe, 0xa8, 0x99, 0xe7, 0xf2, 0x2b,
+  0x6d, 0x35, 0xc4, 0x0f, 0xb4, 0x72, 0xc6, 0x87, 0x52, 0xa2, 0xd8, 0x54, 0xa6, 0x0f, 0x59, 0x1d,
+  0x49, 0x6c, 0xe8, 0x4e, 0xcd, 0x36, 0xd4, 0x4a, 0x09, 0x9f, 0xf7, 0xea, 0xa1, 0xc5, 0x09, 0x6f,
+  0xc2, 0xa8, 0x9e, 0x88, 0x67, 0x66, 0xe8, 0x73, 0x4e, 0x70, 0xfd, 0x56, 0x47, 0xde, 0xca, 0xa4,
+  0xd3, 0x60, 0xff, 0x2e, 0x79, 0xab, 0xb6, 0x69, 0x5c, 0xb5, 0x8d, 0xf3, 0xac, 0x40, 0x46, 0x06,
+  0x33, 0xfc, 0xd7, 0x6c, 0x22, 0x3a, 0xba, 0xcc, 0x0f, 0x87, 0xb0, 0xf8, 0xfe, 0xa9, 0xc4, 0x00,
+  0x6b, 0xdc, 0xf8, 0xa9, 0xf9, 0xfe, 0x4d, 0x48, 0x5a, 0x7f, 0xfb, 0xd4, 0xc6, 0xfd, 0x1f, 0x70,
+  0xcb, 0xef, 0x47, 0xcd, 0x8f, 0xaf, 0xe0, 0xb1, 0x10, 0xd6, 0x78, 0xfd, 0xdb, 0xf5, 0xf7, 0xae,
+  0x31, 0x30, 0xb2, 0x21, 0x27, 0x18, 0x5b, 0xe6, 0x88, 0x4f, 0x4d, 0x8c, 0x8d, 0x3e, 0x3f, 0x3d,
+  0x39, 0x32, 0x3a, 0x86, 0xcb, 0xaf, 0xdc, 0xcb, 0xc6, 0x2f, 0x4c, 0x80, 0x7f, 0x57, 0x15, 0x91,
+  0x96, 0xad, 0x22, 0x2f, 0xd2, 0x6b, 0x14, 0xd5, 0xe6, 0x79, 0x50, 0xa1, 0x5d, 0x8c, 0x41, 0x04,
+  0x47, 0x22, 0x2a, 0xed, 0x0f, 0xd5, 0x8a, 0x8f, 0x4f, 0xec, 0x4f, 0x44, 0x38, 0xd3, 0xa1, 0xaa,
+  0xe0, 0xa7, 0xc6, 0x02, 0x7e, 0x2a, 0x1e, 0xd8, 0x89, 0xf0, 0x78, 0xd1, 0x23, 0xf5, 0xe2, 0xbe,
+  0x74, 0xb2, 0x03, 0x07, 0xed, 0x44, 0x3d, 0xe0, 0xa4, 0xca, 0x13, 0x2e, 0xad, 0x81, 0x08, 0x79,
+  0x18, 0x04, 0x63, 0x11, 0xb3, 0x22, 0xea, 0x2b, 0xd3, 0x9e, 0x51, 0x44, 0x90, 0x9a, 0xbe, 0xcf,
+  0xb4, 0xdd, 0x55, 0x3f, 0xcb, 0xe7, 0xa1, 0xf0, 0x71, 0x1a, 0xe2, 0x24, 0x70, 0xdb, 0xa6, 0x3c,
+  0x80, 0xf1, 0xc7, 0x7c, 0xe0, 0xc4, 0x4e, 0x7c, 0x73, 0xd6, 0xd4, 0x84, 0xf6, 0xc4, 0x09, 0xa5,
+  0xd9, 0xdf, 0x00, 0xff, 0x0c, 0xb0, 0x34, 0x6d, 0xd3, 0x52, 0x99, 0x34, 0x08, 0xcb, 0x12, 0xb1,
+  0xe3, 0x00, 0xbe, 0x96, 0xb2, 0x4b, 0x15, 0x97, 0xf4, 0x3a, 0xec, 0xf0, 0xe0, 0xc7, 0x81, 0xf8,
+  0x12, 0x0a, 0xde, 0x36, 0x8b, 0xa2, 0x60, 0x94, 0x5f, 0x67, 0x4a, 0x80, 0x70, 0x75, 0x17, 0xef,
+  0x26, 0xb9, 0x44, 0x4b, 0xbb, 0x31, 0x7e, 0x34, 0x28, 0x26, 0xbd, 0xae, 0xc7, 0xb0, 0xf9, 0x4e,
+  0xb0, 0x71, 0xef, 0x48, 0x08, 0x66, 0xcc, 0xdb, 0xcf, 0xb0, 0x7f, 0x4a, 0xc3, 0x81, 0xd6, 0x1c,
+  0xe3, 0x8f, 0xda, 0x9c, 0x59, 0x39, 0xf0, 0xa2, 0x56, 0x35, 0xf4, 0x45, 0xf1, 0xb3, 0x6f, 0x4e,
+  0xb3, 0xcb, 0x8e, 0x56, 0x98, 0x4b, 0xc3, 0xbf, 0x8c, 0x96, 0x4a, 0xa5, 0x7c, 0x12, 0x2c, 0xe8,
+  0x95, 0x82, 0x42, 0xe3, 0xaa, 0xbf, 0x30, 0xaf, 0x92, 0x36, 0x44, 0x29, 0xbe, 0xef, 0x56, 0xdd,
+  0xbe, 0xe6, 0x6d, 0xad, 0x6b, 0xdc, 0xfe, 0x8e, 0x77, 0xcc, 0x23, 0xa4, 0x3e, 0x53, 0x05, 0xfd,
+  0x3b, 0x2b, 0x36, 0xba, 0x00, 0x69, 0x10, 0x3d, 0x30, 0x00, 0xf1, 0xb3, 0x2d, 0xe4, 0xf8, 0xc4,
+  0xab, 0x33, 0xb9, 0x59, 0x54, 0xab, 0x84, 0x71, 0x28, 0xa7, 0x47, 0xe6, 0xec, 0x9b, 0x0b, 0xe5,
+  0xf4, 0x42, 0x0e, 0x37, 0x2f, 0xf1, 0x26, 0xd9, 0x40, 0x56, 0x1f, 0x56, 0x2a, 0x40, 0x05, 0xd5,
+  0xb1, 0xe2, 0xeb, 0x16, 0x55, 0xb1, 0x92, 0xb6, 0xcb, 0xdf, 0x13, 0x2d, 0x77, 0x27, 0x86, 0xf9,
+  0x51, 0x4a, 0xfd, 0x87, 0x1c, 0x14, 0x45, 0x56, 0x88, 0xd8, 0xb7, 0x58, 0xca, 0xe4, 0xd2, 0x5d,
+  0x12, 0xc5, 0x4d, 0xe1, 0x80, 0xcd, 0x26, 0x78, 0x19, 0xb2, 0xd7, 0x79, 0x81, 0xe3, 0x4f, 0x9c,
+  0x10, 0xe2, 0xb5, 0xce, 0xc0, 0x5f, 0x66, 0x7c, 0x9d, 0x3c, 0x54, 0x2d, 0x25, 0x86, 0x17, 0xdc,
+  0xa8, 0xfa, 0x81, 0x17, 0xf1, 0xc8, 0xe2, 0xe1, 0x29, 0x26, 0x79, 0xde, 0x2f, 0x05, 0xa4, 0x01,
+  0xa6, 0xe7, 0x4d, 0xf0, 0x15, 0x3e, 0xf6, 0x12, 0x0b, 0xaf, 0x23, 0x63, 0xfc, 0x28, 0x34, 0xc9,
+  0xc4, 0x5c, 0xa7, 0x30, 0x82, 0x32, 0xdf, 0x07, 0xff, 0x7f, 0x4c, 0xe9, 0xdf, 0x1e, 0x53, 0x92,
+  0xd0, 0xb9, 0x6d, 0x10, 0xe4, 0xa7, 0x2d, 0x58, 0xc9, 0x13, 0x25, 0xc2, 0xae, 0x08, 0x2f, 0x86,
+  0x77, 0x88, 0x3d, 0xf5, 0x47, 0xc5, 0x9b, 0x32, 0x7d, 0xff, 0x9a, 0x80, 0x13, 0xcd, 0x78, 0x34,
+  0x76, 0x25, 0xbe, 0x84, 0x1e, 0x7a, 0x0c, 0x9c, 0x4b, 0x29, 0xdf, 0x2f, 0x5e, 0x1c, 0x47, 0x8f,
+  0x94, 0x4b, 0x31, 0x56, 0x24, 0xeb, 0x30, 0xde, 0xae, 0x6a, 0x61, 0x4e, 0x46, 0x5e, 0x92, 0x3c,
+  0xa2, 0xe0, 0xc1, 0x22, 0xc3, 0x91, 0x90, 0xc6, 0xe8, 0x55, 0x30, 0x96, 0x85, 0x6f, 0x8f, 0xc5,
+  0x11, 0xf4, 0x30, 0xb6, 0x96, 0x68, 0x3d, 0x90, 0xb0, 0xc2, 0x7d, 0xcf, 0xa2, 0xf4, 0x3b, 0xc7,
+  0x85, 0x27, 0x76, 0x0c, 0x9a, 0x20, 0xce, 0x28, 0x59, 0xf3, 0xf1, 0x22, 0xcc, 0x3b, 0xac, 0x0e,
+  0x3f, 0x7e, 0x1a, 0x00, 0xe5, 0xa9, 0x44, 0xef, 0x6d, 0x05, 0x32, 0xa2, 0xcd, 0xc0, 0xf0, 0x5c,
+  0x86, 0xae, 0xaa, 0xab, 0x68, 0x8b, 0x21, 0xaf, 0x7e, 0x51, 0x6e, 0x51, 0x56, 0xb7, 0x3e, 0xb4,
+  0x0b, 0x61, 0x44, 0x87, 0x2f, 0xea, 0xdc, 0xee, 0xa5, 0x82, 0x4a, 0xb8, 0xa6, 0x64, 0xd1, 0xe6,
+  0x9c, 0x04, 0x9d, 0x59, 0xa1, 0xfb, 0x79, 0x4d, 0x59, 0x80, 0x76, 0x91, 0x2c, 0x98, 0xa1, 0x7c,
+  0x11, 0xb8, 0xd8, 0x43, 0x21, 0x06, 0x5e, 0x1a, 0x60, 0xec, 0x14, 0xb9, 0x01, 0xe7, 0xbe, 0xbd,
+  0x63, 0xcf, 0xfd, 0xb5, 0x96, 0x30, 0xc1, 0xff, 0x48, 0x17, 0xbf, 0x83, 0x9f, 0xeb, 0xf9, 0x59,
+  0x4b, 0x22, 0x12, 0xb4, 0x84, 0x74, 0x59, 0x30, 0xf1, 0x01, 0xcf, 0x94, 0x78, 0xe1, 0x8f, 0x61,
+  0xd6, 0x87, 0xd6, 0x6f, 0x36, 0xcd, 0x06, 0x88, 0x98, 0x1d, 0x22, 0x03, 0xe8, 0xad, 0x2c, 0x25,
+  0x3a, 0xc6, 0x02, 0x22, 0xe3, 0x00, 0x11, 0x31, 0x00, 0xe2, 0x69, 0x3f, 0x33, 0x14, 0x00, 0x50,
+  0xfd, 0x84, 0x29, 0xda, 0xc8, 0x0e, 0xed, 0xb6, 0xfa, 0xe7, 0xf5, 0x28, 0x12, 0xf0, 0xfb, 0xdb,
+  0xdb, 0x52, 0xcf, 0xb5, 0xaa, 0x94, 0x37, 0x03, 0x0e, 0x47, 0x56, 0xc3, 0x5d, 0x0a, 0xb8, 0xf7,
+  0x20, 0x9b, 0xc6, 0x23, 0xda, 0xf8, 0x4c, 0x2f, 0x30, 0xcd, 0xa5, 0xc4, 0xe3, 0x33, 0xb1, 0x88,
+  0xbe, 0x00, 0xca, 0x87, 0xa7, 0x9e, 0xc2, 0x45, 0xf8, 0x21, 0x14, 0x0f, 0x09, 0x7f, 0x5a, 0x14,
+  0x5b, 0x9c, 0xec, 0x95, 0x20, 0xe5, 0x60, 0x5a, 0x43, 0xa1, 0x6d, 0x53, 0x6e, 0x85, 0x4b, 0xc5,
+  0x20, 0xe5, 0x44, 0xa2, 0xe4, 0xd7, 0xad, 0x29, 0x07, 0x0a, 0xbd, 0x08, 0x4a, 0xfa, 0xb8, 0xc6,
+  0x42, 0x55, 0x31, 0x78, 0xa0, 0xfa, 0x8f, 0xdb, 0x88, 0x19, 0x54, 0x55, 0x31, 0xca, 0x05, 0xc3,
+  0x23, 0x45, 0x0d, 0x32, 0xa9, 0x5c, 0x87, 0x88, 0x81, 0xc7, 0xb4, 0x8b, 0x3c, 0x22, 0xb8, 0x08,
+  0x22, 0xc4, 0xa9, 0xfa, 0xc2, 0x16, 0x52, 0x5a, 0x63, 0xc8, 0x48, 0x6a, 0xa4, 0xef, 0x22, 0x06,
+  0xe3, 0xaa, 0x5c, 0xa8, 0x03, 0xb3, 0xac, 0x4a, 0xe7, 0x1e, 0xeb, 0xcf, 0x2c, 0x06, 0x3d, 0xfb,
+  0x45, 0xb9, 0x99, 0x3e, 0x48, 0xf4, 0x55, 0xd5, 0xb5, 0xf7, 0xc9, 0xae, 0x86, 0x59, 0x1e, 0xc1,
+  0x09, 0xdf, 0x62, 0x12, 0x47, 0xfa, 0xe8, 0xff, 0x0f, 0x7b, 0xe8, 0xde, 0xb2, 0xa1, 0x13, 0x30,
+  0xfa, 0x64, 0x48, 0x1e, 0xe8, 0x60, 0xd8, 0x68, 0xc7, 0xe8, 0x95, 0xbc, 0x91, 0xaa, 0x58, 0xcb,
+  0x50, 0x2a, 0x19, 0xdc, 0xaf, 0xb3, 0x87, 0xb6, 0x6c, 0x82, 0xd0, 0x0a, 0x6e, 0x7d, 0x1a, 0x08,
+  0x6f, 0x6e, 0x22, 0xe2, 0x53, 0x4b, 0x3e, 0x21, 0xf3, 0x44, 0xc8, 0xc8, 0xa5, 0xcb, 0x10, 0x9e,
+  0xb5, 0x6a, 0x41, 0x77, 0x8d, 0x83, 0x95, 0x82, 0x99, 0xd7, 0x5d, 0xcb, 0x96, 0xd8, 0xb6, 0xb5,
+  0xca, 0xe9, 0xde, 0xcf, 0x16, 0xab, 0x9c, 0x6c, 0x68, 0x75, 0x7f, 0x0c, 0xff, 0x40, 0x41, 0x47,
+  0x28, 0x76, 0x07, 0x28, 0x7c, 0x6f, 0xc3, 0x36, 0x80, 0xac, 0x76, 0x00, 0xb2, 0xaa, 0x2f, 0x6b,
+  0x62, 0x51, 0xb0, 0x23, 0x8c, 0xf9, 0x0e, 0x30, 0xf8, 0x5e, 0x85, 0x2c, 0x67, 0xfe, 0xb6, 0x50,
+  0xfc, 0x1b, 0x1b, 0x5b, 0x40, 0x1d, 0x17, 0x0e, 0x86, 0xba, 0x5f, 0x28, 0x9b, 0xa8, 0xff, 0x7a,
+  0xf3, 0xf8, 0xe0, 0x56, 0x10, 0xab, 0x66, 0xa1, 0x23, 0xa1, 0x0b, 0x5b, 0xf6, 0xce, 0xbb, 0x6c,
+  0xb1, 0x33, 0x5a, 0x7c, 0x27, 0x45, 0x2e, 0x51, 0xc7, 0xcb, 0x18, 0xb7, 0xc6, 0x0b, 0xb7, 0x14,
+  0x77, 0x06, 0x88, 0x25, 0xb4, 0x1e, 0x84, 0xb7, 0x35, 0xb4, 0x7c, 0x39, 0x12, 0x3b, 0x7f, 0x7f,
+  0x54, 0x1d, 0x0c, 0x14, 0xe5, 0x7d, 0xbc, 0xbe, 0x35, 0x4c, 0x3d, 0xef, 0xb6, 0x87, 0x89, 0x9b,
+  0x25, 0x54, 0x98, 0xb8, 0xeb, 0x01, 0x61, 0x76, 0x02, 0x4a, 0x77, 0x1b, 0x6d, 0x6b, 0x6c, 0xd9,
+  0x36, 0x06, 0x57, 0xdc, 0x5e, 0xd4, 0x19, 0x1e, 0x1e, 0x09, 0x41, 0x4e, 0x21, 0x4c, 0x03, 0xc9,
+  0xe3, 0x94, 0xfc, 0x6c, 0xe7, 0x36, 0xc4, 0x7d, 0x45, 0x9d, 0xdb, 0xa0, 0x9d, 0x1a, 0x99, 0x96,
+  0x36, 0x68, 0xd7, 0x05, 0x26, 0x97, 0x47, 0x3a, 0x37, 0x22, 0x6e, 0x28, 0x6a, 0x69, 0x44, 0x50,
+  0x64, 0x61, 0x92, 0x14, 0x10, 0x1d, 0x4a, 0x41, 0x81, 0xfa, 0x9b, 0x10, 0xc5, 0xca, 0xd5, 0xa8,
+  0xd6, 0xf1, 0x78, 0x0b, 0x25, 0x8f, 0xf2, 0x93, 0x01, 0x03, 0xa1, 0x5a, 0x0b, 0x93, 0x5a, 0xba,
+  0xb5, 0xd2, 0xc2, 0x38, 0xa5, 0x8e, 0xb2, 0xf8, 0xc6, 0x9b, 0x37, 0xd6, 0xcf, 0x9c, 0x62, 0x2d,
+  0x2d, 0x41, 0x76, 0x77, 0x4b, 0x3b, 0x90, 0x98, 0x38, 0xee, 0x1d, 0x23, 0xe6, 0x19, 0x74, 0xae,
+  0x47, 0xea, 0x5f, 0x3a, 0xc0, 0x14, 0x0e, 0x0c, 0x35, 0x3f, 0xb9, 0xb5, 0xfe, 0xd7, 0xbb, 0x9b,
+  0x7f, 0xbe, 0xb5, 0x71, 0xfb, 0x55, 0xa1, 0x53, 0x78, 0x39, 0xda, 0x9d, 0x7e, 0x04, 0xec, 0x06,
+  0x2c, 0xc5, 0x3f, 0xd0, 0x88, 0x5f, 0x28, 0x8c, 0x85, 0x8e, 0xaf, 0xf1, 0x76, 0xf8, 0xd1, 0xa2,
+  0x8e, 0x0d, 0x35, 0x6e, 0x7f, 0xc7, 0xaf, 0x5c, 0xd9, 0xaa, 0x15, 0xc3, 0xb6, 0xa3, 0x1b, 0xc1,
+  0x03, 0x4b, 0x9d, 0x9b, 0xf8, 0xe5, 0x75, 0x7e, 0x07, 0xe3, 0xc3, 0x76, 0xa4, 0x13, 0x4c, 0xba,
+  0xce, 0x11, 0x4f, 0x59, 0x6c, 0x01, 0xd3, 0x12, 0x10, 0x71, 0x00, 0xf8, 0x21, 0xaf, 0x48, 0x4e,
+  0xa2, 0x11, 0xc1, 0x00, 0xdf, 0xde, 0xb1, 0x23, 0xa3, 0x07, 0x30, 0xbe, 0xa7, 0xf4, 0x0e, 0xd3,
+  0xf1, 0x7a, 0x77, 0x0a, 0xfb, 0x4d, 0x1e, 0x3d, 0xc2, 0x43, 0x84, 0x02, 0x9a, 0xda, 0x66, 0x08,
+  0x96, 0xd2, 0xab, 0x56, 0x80, 0xc1, 0x4c, 0x1f, 0xdb, 0x84, 0xba, 0x87, 0x70, 0xab, 0x1d, 0x91,
+  0xb1, 0x7c, 0xae, 0xe0, 0x9f, 0x6c, 0x03, 0x1b, 0x22, 0x87, 0xcb, 0xbd, 0x6d, 0x36, 0x2d, 0xf2,
+  0xa8, 0x2d, 0x78, 0x0b, 0x07, 0x34, 0x36, 0xfa, 0x7b, 0xf8, 0xf7, 0x9c, 0xac, 0x38, 0x91, 0x43,
+  0x5f, 0x6e, 0x45, 0x5b, 0xd5, 0x5e, 0x24, 0xb5, 0x1e, 0x3f, 0x41, 0xcf, 0x75, 0x0f, 0xb2, 0x6d,
+  0xb9, 0xbf, 0xc7, 0x22, 0x55, 0x8d, 0xe9, 0x62, 0xb7, 0xa5, 0x68, 0x72, 0x88, 0xfb, 0x91, 0x96,
+  0x13, 0xd7, 0xc1, 0x58, 0x74, 0xf8, 0xab, 0x63, 0x56, 0xe0, 0x75, 0x50, 0x2e, 0x0e, 0x4c, 0xe4,
+  0xe2, 0xd5, 0x14, 0xda, 0xce, 0xa9, 0xd5, 0xa7, 0xf3, 0x18, 0x5d, 0x48, 0xbd, 0xf8, 0xb4, 0xc3,
+  0x5f, 0x71, 0x01, 0x0e, 0x5f, 0xf3, 0xb8, 0x63, 0x42, 0x69, 0xed, 0xb9, 0x7f, 0xb6, 0x35, 0x68,
+  0x68, 0xa7, 0xd2, 0x90, 0xc6, 0x92, 0x98, 0xd8, 0xae, 0xb9, 0xff, 0xf5, 0x2f, 0x68, 0x2e, 0xc9,
+  0x3b, 0x84, 0xcd, 0xc9, 0x86, 0xa0, 0xbb, 0xf8, 0xfa, 0xa2, 0xda, 0x5a, 0xd5, 0xb6, 0x5e, 0x00,
+  0x9b, 0x92, 0x1a, 0x0c, 0xb4, 0x26, 0x37, 0x00, 0xe4, 0xd2, 0x78, 0xdf, 0x6e, 0xbc, 0x07, 0x3c,
+  0xc9, 0x9d, 0xa2, 0xb2, 0xb7, 0x00, 0xbf, 0x32, 0x00, 0x23, 0x47, 0xc9, 0x2b, 0xb4, 0x64, 0xae,
+  0xe3, 0x0e, 0xb3, 0x55, 0x48, 0x7c, 0x8e, 0x37, 0x2f, 0x13, 0xa1, 0x39, 0xbf, 0x45, 0xbc, 0x89,
+  0x8a, 0x2f, 0x7a, 0x00, 0xae, 0xc9, 0x1c, 0x78, 0x66, 0x3d, 0xe4, 0xa2, 0x41, 0x97, 0x20, 0x21,
+  0xea, 0x3d, 0xa9, 0x26, 0x24, 0x03, 0x29, 0x21, 0x28, 0xc9, 0x30, 0x98, 0x64, 0x0b, 0x9c, 0x64,
+  0x2b, 0x20, 0x4c, 0xf2, 0x97, 0x29, 0xf4, 0x15, 0x8a, 0x93, 0xd1, 0xaa, 0x8c, 0x33, 0x00, 0x05,
+  0xe9, 0x2b, 0x48, 0x50, 0xc7, 0xc0, 0x97, 0x3e, 0xf9, 0x96, 0x1f, 0x88, 0x3d, 0x5e, 0xec, 0xe9,
+  0xc9, 0xe5, 0xfa, 0x62, 0x7c, 0x69, 0xa4, 0xb5, 0x6c, 0x5a, 0xeb, 0xf3, 0xcb, 0xf6, 0xe4, 0xf5,
+  0x62, 0x6f, 0xba, 0x43, 0x59, 0x2c, 0x2d, 0xca, 0x66, 0x33, 0xbb, 0xfb, 0x8a, 0xb9, 0x18, 0xad,
+  0x9d, 0xa8, 0x07, 0xce, 0xf0, 0x86, 0xc6, 0x5c, 0x41, 0x58, 0xac, 0xc7, 0xfc, 0xa9, 0x25, 0x03,
+  0x92, 0xe2, 0x95, 0x7f, 0xb7, 0x55, 0x4c, 0x4c, 0x35, 0x42, 0x8a, 0x72, 0xe2, 0x80, 0x5f, 0xce,
+  0x0b, 0x4e, 0x76, 0xa8, 0xe7, 0x87, 0x4f, 0x47, 0x71, 0xca, 0x1d, 0xa3, 0x9d, 0x1a, 0xe4, 0xeb,
+  0x8e, 0xe2, 0xa4, 0x38, 0xc0, 0xdf, 0xb3, 0x28, 0x25, 0x44, 0xf8, 0x56, 0x2f, 0x14, 0xe8, 0x44,
+  0xeb, 0x38, 0xd8, 0x44, 0x46, 0x05, 0x9c, 0xed, 0x18, 0x47, 0x3c, 0x26, 0x77, 0xf5, 0x9f, 0x50,
+  0x7a, 0x82, 0x1f, 0x5a, 0x55, 0xc2, 0xe3, 0xd1, 0x41, 0x73, 0xf2, 0x35, 0x94, 0x3a, 0x21, 0xaf,
+  0x63, 0x1c, 0x9c, 0xaf, 0x78, 0x15, 0xfc, 0x98, 0x6a, 0x56, 0x2c, 0x40, 0x89, 0xcd, 0x91, 0x43,
+  0x19, 0xe1, 0x89, 0xa0, 0x20, 0x0a, 0xb9, 0xb3, 0x9e, 0x6f, 0xc5, 0x33, 0x55, 0x67, 0xd6, 0x73,
+  0x71, 0x78, 0x56, 0xc8, 0x9d, 0xe5, 0x89, 0x32, 0x16, 0x92, 0x21, 0x41, 0x92, 0x49, 0xad, 0x26,
+  0x82, 0xb0, 0x30, 0x2f, 0x4b, 0x79, 0xd9, 0x40, 0x9e, 0xef, 0x61, 0xb6, 0x1e, 0x25, 0xf4, 0x46,
+  0x96, 0x17, 0x0d, 0x87, 0x74, 0x51, 0x52, 0xaa, 0x1b, 0xfe, 0x3c, 0x01, 0xcf, 0xaf, 0xe8, 0x11,
+  0x81, 0xc4, 0x89, 0x83, 0x18, 0x3d, 0xeb, 0x57, 0x42, 0x63, 0xb6, 0x57, 0x90, 0xae, 0xef, 0x69,
+  0x5b, 0x6e, 0xd5, 0x2b, 0x07, 0x7e, 0x44, 0xfb, 0x62, 0xde, 0xa7, 0x17, 0x49, 0x64, 0xa8, 0x0e,
+  0x2c, 0x5d, 0x5c, 0x83, 0x5b, 0x86, 0x40, 0x3a, 0x43, 0x0e, 0xf4, 0x5d, 0xf8, 0x95, 0x22, 0xf1,
+  0x7f, 0xc5, 0x21, 0x2d, 0x69, 0x07, 0x13, 0x9f, 0xa3, 0xc4, 0x55, 0x6f, 0xf9, 0xe7, 0xfc, 0xc5,
+  0xc6, 0xf9, 0x73, 0xff, 0xf8, 0xf9, 0x43, 0x12, 0xba, 0x8d, 0xeb, 0x9f, 0xac, 0xbf, 0x7d, 0x13,
+  0xcf, 0xe1, 0x5c, 0xb9, 0x8b, 0x37, 0x76, 0xbd, 0x7b, 0xfa, 0x1f, 0x3f, 0xbf, 0xb5, 0xf9, 0xc1,
+  0xc9, 0x8d, 0x4f, 0xee, 0xe2, 0x79, 0x66, 0x06, 0x39, 0x8d, 0xf3, 0xdf, 0x37, 0xcf, 0x9c, 0xdd,
+  0x3c, 0xf9, 0x86, 0x97, 0xbf, 0xfe, 0xf7, 0x2f, 0x1b, 0xe7, 0x6f, 0x37, 0x6e, 0xfc, 0xb4, 0x79,
+  0xff, 0x82, 0xda, 0xd2, 0xef, 0xb1, 0xa5, 0x74, 0x2a, 0xdb, 0x1f, 0x81, 0x40, 0x3a, 0xd5, 0x23,
+  0x93, 0x85, 0x70, 0x73, 0xbd, 0x5b, 0x26, 0x50, 0x1e, 0xf8, 0x8e, 0x26, 0xee, 0xac, 0xf0, 0x7c,
+  0x4d, 0xce, 0x79, 0x5c, 0x82, 0xc6, 0x3d, 0xc2, 0x50, 0x99, 0x94, 0x93, 0xc0, 0xd0, 0x56, 0x74,
+  0x9e, 0x81, 0x79, 0xf4, 0x94, 0x47, 0xfb, 0x59, 0x19, 0x55, 0x0c, 0xeb, 0xe1, 0xd7, 0xc6, 0x68,
+  0x01, 0x47, 0x50, 0xb7, 0x15, 0x08, 0x64, 0xf0, 0x4a, 0x33, 0x33, 0x69, 0x2d, 0x33, 0xab, 0xcd,
+  0x64, 0xb4, 0x2c, 0xfc, 0xcd, 0x6a, 0x39, 0xf8, 0x9b, 0xd3, 0xd2, 0xf0, 0xb7, 0x47, 0xeb, 0x85,
+  0xbf, 0xbd, 0x5a, 0x1f, 0xfc, 0xed, 0xd3, 0x76, 0xc1, 0xdf, 0x5d, 0x5a, 0x0f, 0xfc, 0x4d, 0xd3,
+  0xdf, 0x0c, 0xe5, 0x66, 0x29, 0x37, 0x07, 0xb9, 0xe1, 0x63, 0x15, 0x55, 0xdd, 0xb4, 0x83, 0xbd,
+  0x5c, 0x9a, 0xc1, 0xb4, 0x99, 0xf4, 0xec, 0xac, 0xc6, 0xc4, 0x73, 0x06, 0x9f, 0x31, 0xae, 0x29,
+  0x36, 0x6d, 0x67, 0x52, 0x99, 0x36, 0x2b, 0xe7, 0xea, 0x75, 0x59, 0xa0, 0x2e, 0x1a, 0xe7, 0xde,
+  0x5f, 0xbb, 0x73, 0xd2, 0xbb, 0xe6, 0xaa, 0xe5, 0xf4, 0x15, 0xbf, 0x34, 0xab, 0x71, 0xf9, 0x1a,
+  0xe3, 0x77, 0x6e, 0xc1, 0x38, 0x7f, 0xc3, 0xcf, 0xb1, 0x0e, 0xc2, 0xe3, 0x3d, 0x0e, 0xa7, 0xe5,
+  0xae, 0xac, 0x8b, 0xfc, 0xee, 0x0e, 0x7e, 0x20, 0x1a, 0x6f, 0xed, 0x38, 0xd3, 0xbc, 0x78, 0x93,
+  0xbf, 0x35, 0xcf, 0x9c, 0xdb, 0x3c, 0x75, 0x6e, 0xfd, 0xde, 0x9f, 0xf9, 0x01, 0xb1, 0xee, 0xdc,
+  0xbe, 0xee, 0xe6, 0x5b, 0xa7, 0xd6, 0x3f, 0xbf, 0x2b, 0x44, 0x7e, 0xc5, 0x70, 0x8f, 0xf1, 0x96,
+  0xc4, 0xed, 0x28, 0xf4, 0x12, 0x3f, 0x3a, 0x39, 0x9e, 0xca, 0xdb, 0x06, 0x4c, 0x89, 0x67, 0xe6,
+  0x70, 0x04, 0xe0, 0x3d, 0x8e, 0xd9, 0x7b, 0x4b, 0xd6, 0x5c, 0x1c, 0xa9, 0xdf, 0xd6, 0x0e, 0xf2,
+  0x6f, 0x11, 0x0b, 0xba, 0x0a, 0x40, 0x30, 0xef, 0xd2, 0x05, 0x7e, 0xaf, 0x98, 0x0e, 0x82, 0x97,
+  0xee, 0x38, 0xc0, 0x8b, 0x4f, 0xe4, 0xc1, 0xa6, 0x65, 0xe7, 0x99, 0xc0, 0x0e, 0x1b, 0xda, 0x72,
+  0x03, 0x4e, 0xc5, 0x04, 0xc8, 0x09, 0xb3, 0x32, 0x1f, 0xcc, 0x08, 0x08, 0x50, 0xb9, 0xc1, 0x80,
+  0x42, 0x27, 0xcf, 0x4f, 0x8c, 0x4d, 0x1e, 0x7c, 0x66, 0xdf, 0xf3, 0x87, 0x71, 0x97, 0x41, 0x36,
+  0x2d, 0xa6, 0x18, 0x3f, 0xb1, 0x76, 0xe6, 0x4f, 0x8d, 0xb7, 0x5e, 0xdf, 0xbc, 0xf4, 0xc3, 0xe6,
+  0x87, 0xef, 0xd1, 0x99, 0x74, 0xbc, 0x52, 0xec, 0xee, 0x97, 0xb8, 0x98, 0xd1, 0xfc, 0xf8, 0x0a,
+  0xdf, 0x6f, 0xbb, 0x63, 0x87, 0x47, 0x97, 0xd4, 0x3f, 0x71, 0x93, 0x06, 0xbf, 0x5c, 0x42, 0x9a,
+  0xe4, 0x91, 0xdd, 0xc0, 0x0c, 0xbd, 0x5a, 0x2d, 0xad, 0xee, 0xc7, 0xb2, 0xf1, 0x72, 0xa7, 0xdb,
+  0x2f, 0xe8, 0x7e, 0x19, 0x09, 0xcd, 0x23, 0x94, 0xbf, 0xa5, 0x06, 0xef, 0x6b, 0x88, 0xf2, 0x2a,
+  0xe8, 0xa3, 0x4b, 0x31, 0xa5, 0x4c, 0x7b, 0xeb, 0xdc, 0x5b, 0xf7, 0x3f, 0xba, 0x57, 0xc3, 0x6b,
+  0x59, 0xc2, 0xd4, 0xf4, 0xee, 0x67, 0x09, 0x1e, 0x13, 0x6f, 0x8f, 0x33, 0xbf, 0xd9, 0xa6, 0x05,
+  0x69, 0xa5, 0xf7, 0x51, 0x58, 0x37, 0x2f, 0x7e, 0xd3, 0xf8, 0xf9, 0x24, 0x30, 0x2e, 0xe0, 0x9e,
+  0x4a, 0xa5, 0xb6, 0xc0, 0xdd, 0x73, 0x88, 0xe8, 0x3a, 0x84, 0x36, 0xf7, 0x03, 0xf9, 0x03, 0x1a,
+  0x7d, 0x03, 0x8f, 0xb8, 0xf4, 0x44, 0xc3, 0xeb, 0x4e, 0xc0, 0x0d, 0x5d, 0x76, 0x06, 0xba, 0xc1,
+  0x85, 0x2c, 0x59, 0x79, 0x3a, 0x04, 0x9e, 0x5a, 0x80, 0x4a, 0x18, 0x24, 0xae, 0x0f, 0xf4, 0x67,
+  0xba, 0x8f, 0xb7, 0x84, 0x00, 0x03, 0x43, 0x48, 0xed, 0x95, 0x53, 0xfc, 0x7e, 0x16, 0x29, 0x58,
+  0xf8, 0xf6, 0x00, 0x8c, 0x28, 0x26, 0x7c, 0x56, 0x01, 0x2b, 0x97, 0x6a, 0xd2, 0x09, 0x05, 0x7a,
+  0x57, 0xd8, 0x48, 0xe4, 0x4d, 0x1b, 0x38, 0xbd, 0x5c, 0x7b, 0x95, 0xd2, 0xfc, 0xfc, 0x45, 0xcf,
+  0x9d, 0x0c, 0x9c, 0xdc, 0x83, 0x0c, 0x8d, 0x51, 0xae, 0x18, 0xcf, 0xe0, 0xb9, 0xc0, 0x96, 0x50,
+  0x64, 0xcb, 0xd8, 0xe9, 0xb8, 0x24, 0xb0, 0x65, 0xc4, 0x72, 0x98, 0x22, 0x96, 0x3e, 0x6b, 0xab,
+  0xe7, 0xec, 0xe4, 0x4a, 0x46, 0xe0, 0xac, 0x61, 0x39, 0x85, 0x17, 0xa7, 0x28, 0xdd, 0x53, 0xef,
+  0xb5, 0x79, 0xe9, 0x25, 0x86, 0x0d, 0xd3, 0x8f, 0xcb, 0x7f, 0xb0, 0x7b, 0xc1, 0xf9, 0x1d, 0xd8,
+  0x14, 0x45, 0xa4, 0x96, 0xf7, 0xb6, 0xfd, 0xb1, 0x66, 0x38, 0xee, 0x48, 0xc5, 0x2c, 0xd3, 0x58,
+  0xf1, 0x61, 0xa0, 0x12, 0xfe, 0x42, 0xae, 0x32, 0xf9, 0xa2, 0xe7, 0xa3, 0x3f, 0x8d, 0xb6, 0xe0,
+  0x14, 0xba, 0x83, 0x46, 0x6c, 0xaf, 0x95, 0x97, 0x7f, 0x3d, 0x46, 0x98, 0xaa, 0x2b, 0x86, 0x85,
+  0xe0, 0x56, 0x1c, 0x16, 0x08, 0x12, 0x4b, 0xac, 0x02, 0x26, 0x9f, 0x44, 0xab, 0xcd, 0x66, 0x1e,
+  0x3a, 0xf4, 0x1c, 0xd8, 0x5f, 0xe0, 0x1d, 0x88, 0xf4, 0x4c, 0x28, 0x4c, 0x69, 0x0d, 0xf2, 0x12,
+  0xe5, 0x1c, 0xba, 0x7e, 0xcb, 0xb0, 0x97, 0xf4, 0x52, 0x3c, 0x1e, 0x12, 0x62, 0x4e, 0xc7, 0xeb,
+  0x56, 0xbc, 0x1b, 0x9a, 0xb9, 0xb3, 0xed, 0x84, 0x27, 0xeb, 0x36, 0x83, 0xdb, 0x7e, 0x54, 0x48,
+  0x9e, 0xd7, 0xac, 0xb3, 0x03, 0x2f, 0xca, 0x37, 0x62, 0x12, 0xc8, 0x65, 0x2f, 0x81, 0x9a, 0xbb,
+  0x0a, 0x12, 0x98, 0xa9, 0x39, 0xf5, 0xe3, 0xfc, 0x3a, 0x08, 0xfe, 0x13, 0x38, 0xf3, 0x49, 0x87,
+  0x58, 0xeb, 0x1a, 0xe7, 0xc6, 0x41, 0xd2, 0xbf, 0x23, 0x1a, 0x0f, 0x4c, 0x53, 0x60, 0x19, 0x03,
+  0xc3, 0x18, 0x3e, 0xe5, 0x01, 0x18, 0x0d, 0x7d, 0x7e, 0x4d, 0x84, 0xef, 0x28, 0xde, 0xeb, 0xf0,
+  0xa3, 0x64, 0x74, 0x75, 0x63, 0x81, 0x6e, 0x28, 0x2d, 0x27, 0x34, 0x3a, 0xf1, 0x45, 0xe7, 0xb5,
+  0xe8, 0xb4, 0x15, 0x9d, 0x95, 0xa2, 0x58, 0x42, 0x68, 0xc2, 0xf3, 0x69, 0x2b, 0x76, 0xfa, 0xa8,
+  0x16, 0x29, 0x50, 0x65, 0x26, 0x33, 0x3b, 0xe8, 0xa5, 0x92, 0xf9, 0x89, 0x89, 0x59, 0x25, 0x11,
+  0xcd, 0x38, 0x4c, 0xcb, 0x29, 0x69, 0x80, 0x2a, 0xa5, 0xf5, 0x28, 0x69, 0x1c, 0x75, 0x4a, 0xee,
+  0x9d, 0xe5, 0xcb, 0x3c, 0x7e, 0x26, 0x05, 0x31, 0x30, 0xab, 0xaf, 0x25, 0x4b, 0xdc, 0x5c, 0x89,
+  0x99, 0xbb, 0x14, 0x70, 0x74, 0x7d, 0x25, 0x26, 0xf6, 0x2b, 0x89, 0xfc, 0x06, 0x4b, 0x4c, 0xdd,
+  0x3d, 0x2b, 0x2e, 0x90, 0x48, 0xa5, 0xd5, 0x56, 0x1c, 0x0e, 0x28, 0x93, 0x8e, 0xca, 0xa6, 0x2b,
+  0x2f, 0x29, 0x5b, 0xed, 0x34, 0xdd, 0x81, 0x49, 0xa9, 0x6a, 0xaf, 0xe9, 0x52, 0x4c, 0x4a, 0xcd,
+  0x05, 0x53, 0x45, 0x59, 0xb5, 0xe7, 0x3c, 0x7e, 0x43, 0xc9, 0x7e, 0xcf, 0x5b, 0xc4, 0xae, 0x2f,
+  0x20, 0xab, 0xea, 0xf2, 0x0b, 0x55, 0x9e, 0xc2, 0x6b, 0x0e, 0x00, 0x82, 0x09, 0x2a, 0xe3, 0x48,
+  0x1c, 0xe8, 0xdf, 0x3f, 0x8b, 0xf7, 0xd9, 0x24, 0x71, 0x17, 0x1b, 0xbd, 0xf1, 0x6f, 0x63, 0x52,
+  0x5c, 0x8b, 0x3e, 0xde, 0x3b, 0xa4, 0xd6, 0xa3, 0xab, 0x0c, 0x81, 0x2b, 0x79, 0xf4, 0xaf, 0x79,
+  0xe6, 0x6f, 0xcd, 0xf3, 0xe7, 0x37, 0x7e, 0xbc, 0xbd, 0x71, 0xff, 0xef, 0x60, 0x43, 0xad, 0xdd,
+  0xfb, 0x7c, 0x00, 0xb8, 0xd4, 0x2f, 0x5e, 0xc7, 0x3b, 0xbc, 0x55, 0x16, 0x95, 0xa1, 0xdd, 0x56,
+  0x22, 0x60, 0x64, 0xb7, 0x95, 0x08, 0x74, 0x3d, 0x68, 0x0b, 0x11, 0xe8, 0xbe, 0x50, 0x41, 0x03,
+  0x65, 0x70, 0xcb, 0x55, 0x51, 0xb6, 0x2f, 0x98, 0x2a, 0xca, 0xee, 0x8a, 0x24, 0x63, 0xb6, 0x2f,
+  0x92, 0x8c, 0xbe, 0x6e, 0x92, 0x77, 0x61, 0xb6, 0x5e, 0x64, 0x76, 0x98, 0x2e, 0x32, 0x53, 0x97,
+  0x50, 0xe9, 0x46, 0x29, 0xe5, 0xa6, 0x04, 0xa9, 0x6f, 0x54, 0x8e, 0xc0, 0xbd, 0x64, 0x20, 0x77,
+  0xe2, 0x38, 0x1d, 0xc2, 0x05, 0xc6, 0x83, 0x05, 0xb2, 0xc1, 0x02, 0x92, 0x4f, 0xfc, 0x02, 0xb9,
+  0x96, 0x02, 0x21, 0x08, 0x3d, 0xc1, 0x02, 0x92, 0xf4, 0xa1, 0xad, 0x6e, 0xa1, 0x22, 0xe3, 0xe1,
+  0x22, 0x7d, 0x21, 0x44, 0xc5, 0xa0, 0xa8, 0x45, 0x76, 0xb5, 0x14, 0x69, 0x81, 0xd2, 0x1f, 0x2c,
+  0x22, 0x87, 0x4b, 0x2d, 0xb2, 0xbb, 0xa5, 0x48, 0x0b, 0x14, 0x98, 0x6e, 0x7c, 0x39, 0xaa, 0xde,
+  0xee, 0x7e, 0xb9, 0x89, 0x63, 0xca, 0xb8, 0x80, 0xf0, 0x83, 0xf7, 0xa5, 0xb9, 0x9a, 0x43, 0x7f,
+  0x0e, 0x9b, 0x15, 0x6d, 0xc9, 0xca, 0x6b, 0xb6, 0x59, 0x71, 0x35, 0x07, 0x1e, 0x4c, 0xcc, 0x99,
+  0xab, 0x81, 0xcd, 0xe4, 0x1e, 0xd6, 0xb5, 0xbc, 0x55, 0xae, 0x6a, 0x18, 0xf6, 0xd4, 0x4a, 0x66,
+  0xd9, 0x74, 0xe9, 0x32, 0xb2, 0x2d, 0x87, 0x57, 0x2c, 0x6d, 0x42, 0xad, 0x20, 0xed, 0xbd, 0xce,
+  0xc8, 0x83, 0x64, 0x9d, 0x6f, 0x02, 0xd3, 0x5d, 0x4f, 0xa1, 0xe0, 0x27, 0x6b, 0xdd, 0xe8, 0x95,
+  0x0b, 0xe4, 0x1a, 0xbe, 0x00, 0xc2, 0x64, 0x02, 0x38, 0x6f, 0xe9, 0x44, 0xfd, 0xc9, 0xe3, 0x4a,
+  0x4d, 0x31, 0x6f, 0x8f, 0x97, 0xcd, 0x8a, 0x57, 0x2c, 0x4b, 0xf5, 0x9e, 0x05, 0x75, 0xf2, 0xac,
+  0x95, 0xf7, 0x52, 0x73, 0x5e, 0xea, 0xa4, 0x97, 0x06, 0x3e, 0x61, 0x2e, 0x51, 0xff, 0xdf, 0x7f,
+  0x85, 0xc4, 0x83, 0x5e, 0x62, 0x1f, 0x15, 0x1c, 0x81, 0xb4, 0xcd, 0xab, 0xaf, 0xe1, 0xc5, 0xf7,
+  0x4f, 0x9c, 0xc0, 0x51, 0xaf, 0x97, 0x31, 0x69, 0xe3, 0xca, 0x17, 0x8d, 0x97, 0x1f, 0xb0, 0xff,
+  0xba, 0x24, 0x4b, 0xf7, 0x73, 0x24, 0xa1, 0xf0, 0x07, 0x17, 0xf0, 0x3a, 0x78, 0x2c, 0x0c, 0x23,
+  0x57, 0x57, 0x90, 0x54, 0xad, 0x56, 0x22, 0x1e, 0x88, 0x96, 0xac, 0x1f, 0x7c, 0x46, 0x0b, 0x16,
+  0x03, 0xd3, 0x9c, 0xae, 0x43, 0x7c, 0x97, 0x76, 0x64, 0x60, 0x3a, 0xb6, 0x05, 0x3f, 0x4c, 0x1f,
+  0x08, 0xf2, 0x03, 0xbc, 0x63, 0x70, 0x6a, 0x92, 0xfe, 0x82, 0x3e, 0x2b, 0xcf, 0x4d, 0xe2, 0x9f,
+  0x71, 0x1c, 0xf3, 0x49, 0xfc, 0x33, 0xae, 0x99, 0x59, 0x77, 0xf2, 0x49, 0xfc, 0x3b, 0xfe, 0xa4,
+  0x96, 0xd7, 0x4b, 0x63, 0xb6, 0x3d, 0x29, 0x7e, 0xc7, 0xb7, 0x39, 0xdb, 0x69, 0xf5, 0x27, 0xc4,
+  0xb9, 0x21, 0xe6, 0x5e, 0x68, 0xe1, 0x6d, 0x6f, 0xbe, 0x6f, 0x67, 0xc9, 0x49, 0x8e, 0x71, 0xf3,
+  0xda, 0x95, 0xc6, 0x27, 0x67, 0xd7, 0xef, 0xbd, 0xbf, 0x7e, 0xef, 0x35, 0xf1, 0x61, 0x8d, 0x00,
+  0xd9, 0x7b, 0x67, 0x71, 0xe1, 0x07, 0x07, 0x90, 0x8f, 0xd5, 0xc1, 0x5f, 0xbf, 0x73, 0xe5, 0xe0,
+  0x51, 0x46, 0xff, 0x6c, 0xfd, 0x49, 0x48, 0x6f, 0x7e, 0x76, 0xa5, 0xf9, 0xcd, 0x5f, 0x36, 0x6e,
+  0xdc, 0x68, 0xdc, 0xbe, 0x4e, 0xf9, 0xbb, 0x45, 0x3e, 0x8e, 0xdb, 0xe8, 0xf1, 0xc1, 0x8e, 0x24,
+  0x9e, 0x0a, 0x91, 0x78, 0x4a, 0x03, 0x01, 0x6b, 0x15, 0x0c, 0x47, 0xb3, 0x6a, 0xee, 0x51, 0xc7,
+  0x28, 0xe0, 0xef, 0x01, 0x73, 0x7e, 0x41, 0x03, 0xc3, 0xb4, 0x66, 0xec, 0xb3, 0xad, 0xaa, 0xa3,
+  0x9d, 0xe0, 0x41, 0x45, 0x30, 0x26, 0x16, 0x79, 0xb2, 0xe6, 0xe0, 0x2b, 0x5e, 0x23, 0x5b, 0x85,
+  0x1a, 0x4e, 0xc9, 0x5a, 0xd6, 0xf0, 0xae, 0x27, 0x30, 0xe6, 0x8e, 0x3a, 0x75, 0xdc, 0x59, 0xbc,
+  0xbd, 0xa9, 0x68, 0x5b, 0xcb, 0xea, 0x9d, 0x82, 0x81, 0x63, 0x7c, 0xbd, 0x78, 0x8c, 0x6f, 0x27,
+  0xeb, 0x03, 0x13, 0xac, 0xea, 0x6d, 0x38, 0xa1, 0x13, 0x65, 0xbb, 0xfc, 0x3d, 0x27, 0x08, 0x80,
+  0x5f, 0x3c, 0x79, 0xfc, 0x71, 0xa4, 0x80, 0x39, 0x5b, 0xa7, 0x9f, 0x9d, 0x19, 0xae, 0x2b, 0x62,
+  0x99, 0x18, 0x32, 0x23, 0xb1, 0x20, 0x8b, 0x37, 0x2f, 0x7d, 0x36, 0x32, 0x7a, 0x28, 0x11, 0xab,
+  0x0f, 0x30, 0x7e, 0xf7, 0x27, 0xe3, 0x85, 0xb3, 0xb3, 0x38, 0x01, 0x1a, 0xe7, 0xdf, 0x11, 0xef,
+  0x39, 0x7a, 0x07, 0x5b, 0x4e, 0xbc, 0xf7, 0xd0, 0x7b, 0xf3, 0x75, 0xf9, 0xde, 0xcb, 0xdf, 0x2f,
+  0x9f, 0xdc, 0x7c, 0xff, 0x81, 0x48, 0x82, 0x31, 0xfb, 0xf5, 0x47, 0xe7, 0x78, 0x60, 0x6b, 0x0a,
+  0x77, 0x0e, 0xe5, 0xe8, 0x6f, 0xbe, 0xfc, 0x45, 0xf3, 0xc7, 0xb3, 0xeb, 0x3f, 0x5f, 0xc4, 0x8b,
+  0xc5, 0x69, 0xb4, 0x00, 0x0a, 0x5e, 0x12, 0x0e, 0x2d, 0x9f, 0xba, 0xbb, 0xfe, 0xb7, 0x0f, 0x14,
+  0x94, 0x00, 0xa1, 0xbd, 0x2c, 0xde, 0xf8, 0xfe, 0x66, 0xe3, 0xe4, 0xcf, 0x94, 0x00, 0x18, 0xed,
+  0x4d, 0x20, 0xb7, 0x50, 0x19, 0xc0, 0xac, 0xf1, 0xf3, 0xab, 0x94, 0x01, 0xa8, 0xfd, 0xa1, 0x72,
+  0x1c, 0xe8, 0x44, 0x94, 0xe0, 0x9b, 0x7b, 0xff, 0x20, 0x76, 0x9f, 0xb7, 0x65, 0x82, 0xdf, 0x85,
+  0x98, 0x00, 0xde, 0xed, 0x15, 0xcd, 0x36, 0x30, 0x58, 0x02, 0xc3, 0xe9, 0xf2, 0x7b, 0xd6, 0x1c,
+  0x0d, 0x6f, 0x81, 0x9c, 0x32, 0xfe, 0xa8, 0x19, 0xf9, 0x05, 0x6b, 0xda, 0xd1, 0x16, 0xac, 0x52,
+  0xe1, 0xb0, 0xa3, 0x99, 0xc2, 0x14, 0x3f, 0x6c, 0xe8, 0x15, 0xff, 0x45, 0x5f, 0xd1, 0x5e, 0x30,
+  0x5d, 0x78, 0xc1, 0x27, 0x01, 0xe1, 0xb0, 0xb3, 0x4d, 0x3e, 0x78, 0xc1, 0xea, 0x78, 0x37, 0x24,
+  0xff, 0x94, 0x71, 0x88, 0x75, 0x5c, 0x5a, 0xfc, 0x50, 0x4f, 0xca, 0x85, 0x6d, 0x79, 0xbc, 0xc2,
+  0x25, 0xbd, 0xb2, 0x6b, 0x3f, 0xff, 0x5f, 0x82, 0x36, 0xa4, 0x7a, 0x32, 0x1f, 0x94, 0x69, 0x30,
+  0xa1, 0x2f, 0xa8, 0x04, 0x28, 0x42, 0xd0, 0xa2, 0xa2, 0x89, 0xa9, 0x00, 0x1d, 0xbc, 0x9c, 0x17,
+  0x3c, 0x4d, 0x44, 0x42, 0x5e, 0x19, 0x8d, 0xcf, 0x7b, 0xf0, 0x72, 0x9f, 0x34, 0x07, 0x03, 0xa5,
+  0xda, 0x5e, 0x9a, 0x84, 0x43, 0x42, 0x0d, 0x24, 0xa8, 0x58, 0x48, 0x7f, 0xe0, 0xe7, 0x98, 0x9f,
+  0x38, 0x01, 0xf0, 0xea, 0x65, 0xe7, 0xb8, 0x0f, 0x4c, 0x15, 0xc3, 0x41, 0xd3, 0x03, 0x1c, 0xda,
+  0x74, 0x5b, 0x99, 0xeb, 0x03, 0xf0, 0x05, 0xd1, 0x7b, 0xb7, 0x3c, 0x0e, 0x04, 0x3e, 0xff, 0xe9,
+  0xdb, 0xc6, 0xdd, 0xf3, 0x0a, 0x4f, 0xf1, 0xe9, 0xb0, 0x71, 0xeb, 0xf5, 0xe6, 0xa5, 0x5b, 0x92,
+  0xfb, 0x90, 0xf7, 0x28, 0xea, 0x14, 0x16, 0x48, 0x65, 0x07, 0x18, 0xf5, 0xe3, 0x53, 0xdd, 0x74,
+  0xfb, 0xfa, 0x57, 0xc8, 0xa3, 0xcd, 0x37, 0x2f, 0xe2, 0x27, 0x69, 0x85, 0x60, 0x82, 0x7c, 0x09,
+  0x8b, 0x7f, 0x5a, 0xc5, 0xd3, 0x30, 0xa2, 0x73, 0x6d, 0xb9, 0x74, 0xdf, 0x78, 0x90, 0x4b, 0xe1,
+  0x7d, 0x0a, 0x38, 0x2b, 0xbf, 0x88, 0x8c, 0xe9, 0x82, 0x08, 0x5a, 0x34, 0x49, 0xfa, 0x80, 0xe0,
+  0x19, 0x87, 0xf7, 0xa3, 0x8e, 0x66, 0xd0, 0x8d, 0x9c, 0x1a, 0xfa, 0xea, 0xe0, 0x27, 0xcd, 0x0f,
+  0x54, 0x40, 0x12, 0x31, 0x68, 0x1e, 0xab, 0x8e, 0x69, 0x65, 0x5e, 0x0f, 0xca, 0xc9, 0x9a, 0x2e,
+  0xf9, 0x53, 0xf3, 0x47, 0xb7, 0xcb, 0xa6, 0x85, 0x52, 0x27, 0x2e, 0xa5, 0x2f, 0x65, 0xc7, 0x94,
+  0xa3, 0x8a, 0xd5, 0x19, 0x29, 0x85, 0xa6, 0x62, 0xe1, 0x6d, 0x72, 0x65, 0xd3, 0x71, 0x5a, 0x2c,
+  0x44, 0x5c, 0x92, 0x8b, 0xb0, 0x08, 0x41, 0xcb, 0x94, 0xda, 0xb2, 0x12, 0x65, 0x86, 0x18, 0x88,
+  0xbe, 0xb9, 0xfd, 0xc4, 0x09, 0x6c, 0x43, 0xea, 0x71, 0x2a, 0xa6, 0x72, 0x10, 0x21, 0xb0, 0x35,
+  0xdf, 0x50, 0x3d, 0x0c, 0x11, 0x82, 0x0f, 0x9e, 0x72, 0xe8, 0xac, 0xcf, 0x71, 0xbc, 0x5a, 0x4b,
+  0xe1, 0x93, 0x07, 0x20, 0x92, 0x6e, 0x2a, 0x7c, 0xb2, 0x71, 0xfb, 0x7b, 0x59, 0xa2, 0x47, 0x0a,
+  0x4a, 0x60, 0x8d, 0xc6, 0xbd, 0x5b, 0x50, 0x54, 0x2a, 0x3a, 0x10, 0x96, 0x5c, 0xc4, 0x36, 0x3e,
+  0xff, 0x76, 0xed, 0xee, 0xd9, 0xb5, 0x7b, 0xb7, 0x24, 0x63, 0x91, 0x38, 0xf3, 0x4e, 0x58, 0xcb,
+  0x83, 0x1a, 0xfd, 0xde, 0x5d, 0x70, 0x0e, 0xfa, 0xff, 0x8f, 0x39, 0x29, 0xd0, 0x35, 0x82, 0x51,
+  0x06, 0xd2, 0xc0, 0x27, 0xf2, 0x60, 0x83, 0x1c, 0x80, 0x7a, 0xf0, 0x8a, 0x62, 0x79, 0x5d, 0xab,
+  0x50, 0x16, 0x02, 0x7d, 0x60, 0x4e, 0x8e, 0x26, 0x1f, 0xa6, 0x74, 0x8c, 0x5f, 0xbd, 0x88, 0x1d,
+  0x22, 0x4a, 0x40, 0x57, 0xf0, 0x4a, 0x35, 0x2a, 0xb1, 0x93, 0xc5, 0xa0, 0x5b, 0xb1, 0xba, 0xec,
+  0x29, 0xf6, 0xe0, 0xbf, 0xdf, 0xb8, 0x20, 0x3b, 0xc4, 0x84, 0xe6, 0x56, 0xb4, 0x80, 0xf0, 0x44,
+  0x64, 0xcb, 0xde, 0x35, 0xc8, 0xb8, 0xaf, 0xd7, 0x4b, 0x6d, 0xb9, 0x02, 0x99, 0x0f, 0xa8, 0x98,
+  0xaa, 0xf1, 0x10, 0xf5, 0x5f, 0x7a, 0x89, 0x89, 0x1b, 0xdb, 0x40, 0xc8, 0xc3, 0x8f, 0x07, 0xc6,
+  0x97, 0xfc, 0x90, 0xaa, 0xd6, 0x5a, 0x70, 0xdd, 0x6a, 0xa0, 0x5a, 0x7c, 0xfd, 0x95, 0x9f, 0x1a,
+  0xa7, 0xee, 0x35, 0xef, 0xbc, 0xbe, 0xf9, 0xd1, 0xad, 0x44, 0xac, 0xe3, 0x14, 0x9c, 0x0c, 0x4d,
+  0x41, 0x78, 0x37, 0x0b, 0x1a, 0xde, 0x5b, 0xa9, 0xf1, 0xab, 0x2a, 0x35, 0x7e, 0x31, 0xa5, 0x26,
+  0x2e, 0xa1, 0xd4, 0x0a, 0x35, 0x1b, 0xfe, 0x8a, 0x5b, 0x26, 0x35, 0xef, 0x62, 0x41, 0xcd, 0xbb,
+  0x40, 0x52, 0x5c, 0x16, 0x29, 0x2f, 0x86, 0xd4, 0xf8, 0xb5, 0x8f, 0xdc, 0xd8, 0x8a, 0xba, 0x20,
+  0xb4, 0x23, 0x7a, 0x07, 0xa6, 0x83, 0xe8, 0xc1, 0x7b, 0x15, 0xf4, 0x01, 0x62, 0xe3, 0xa2, 0xb3,
+  0xb0, 0xea, 0x02, 0x12, 0x7c, 0xf9, 0xc5, 0x40, 0xbc, 0xf2, 0x0b, 0xb5, 0x0a, 0x48, 0x0f, 0x5f,
+  0x60, 0xe0, 0x24, 0xc0, 0xf3, 0x89, 0xff, 0x06, 0x01, 0x10, 0x1e, 0x02, 0x98, 0x37, 0x7f, 0xa8,
+  0xf0, 0x5b, 0x63, 0xbd, 0xc9, 0x23, 0x35, 0xbb, 0x9c, 0x2b, 0x82, 0x1d, 0x81, 0x9b, 0x1a, 0x1f,
+  0x5f, 0xa2, 0x89, 0xf3, 0x29, 0x08, 0xdd, 0x96, 0xe9, 0xc3, 0xb9, 0x4c, 0x9d, 0x78, 0x30, 0x6d,
+  0x80, 0x37, 0x3b, 0x8b, 0xd3, 0x89, 0xfd, 0x21, 0x67, 0x6b, 0xbf, 0xc6, 0x57, 0x7e, 0x81, 0x30,
+  0xb8, 0xc3, 0x6c, 0xde, 0xd0, 0x2a, 0x40, 0x10, 0xf8, 0x87, 0x7a, 0xbd, 0xba, 0x7b, 0x37, 0xd2,
+  0x09, 0x6d, 0x39, 0x16, 0x87, 0xd6, 0x12, 0x8f, 0x66, 0xd1, 0xd1, 0xda, 0x22, 0x10, 0x38, 0x70,
+  0x95, 0x74, 0xc0, 0xcc, 0xcb, 0x72, 0x33, 0xaf, 0xb7, 0xd5, 0xcc, 0xeb, 0x8b, 0x34, 0xf3, 0x84,
+  0x95, 0x37, 0xc0, 0xf0, 0x16, 0x4a, 0x6e, 0xe9, 0xd5, 0xe9, 0x9b, 0xb2, 0xbe, 0x29, 0x87, 0x1d,
+  0x18, 0xf2, 0x2d, 0x39, 0xe8, 0xca, 0x90, 0x6f, 0xc7, 0xe1, 0x67, 0x67, 0x3d, 0x2b, 0x2e, 0x38,
+  0x53, 0x11, 0x30, 0x17, 0x04, 0x88, 0x32, 0xcc, 0x17, 0x81, 0xb9, 0x94, 0x41, 0x26, 0xbf, 0xc9,
+  0x82, 0xac, 0xd2, 0xe0, 0x1e, 0x64, 0xb9, 0x25, 0xa3, 0xd8, 0xf9, 0x9e, 0x6a, 0xab, 0xa8, 0x30,
+  0x08, 0xbe, 0x76, 0x34, 0x10, 0xb0, 0xf5, 0xb0, 0xda, 0x00, 0xf7, 0xa3, 0xa0, 0xaa, 0x0d, 0x2c,
+  0x43, 0xd7, 0x46, 0x3c, 0xad, 0xfa, 0x27, 0x94, 0x8a, 0x76, 0x41, 0x37, 0x74, 0x2a, 0x10, 0xc5,
+  0xa0, 0xc3, 0x19, 0xfe, 0xb1, 0x66, 0x44, 0x21, 0xa4, 0x3b, 0x46, 0x27, 0x8e, 0x32, 0x5c, 0x3a,
+  0xd0, 0x0b, 0xca, 0x01, 0x5c, 0x70, 0x3b, 0x80, 0x8a, 0x90, 0x4e, 0x90, 0xb9, 0xf0, 0x3b, 0x1e,
+  0x80, 0xd2, 0x62, 0x9c, 0x28, 0x98, 0xe4, 0xc8, 0x42, 0xc9, 0xf2, 0x4d, 0xc2, 0x9d, 0x94, 0x4d,
+  0xdd, 0x27, 0x8c, 0x67, 0xab, 0xa8, 0x46, 0x03, 0xce, 0x90, 0x87, 0xb7, 0x76, 0xc7, 0x43, 0x52,
+  0x02, 0xde, 0x8d, 0x8a, 0x76, 0x02, 0x78, 0xbc, 0x37, 0x2d, 0xf9, 0x9c, 0x6c, 0x86, 0xfa, 0x7f,
+  0x5d, 0xea, 0x1b, 0xc0, 0xef, 0xff, 0xb0, 0xc9, 0xee, 0x71, 0x8d, 0x4d, 0x8e, 0x4d, 0x4d, 0xc8,
+  0xa7, 0x91, 0x7d, 0xf8, 0xf4, 0x50, 0x33, 0xa1, 0xd4, 0x39, 0x8a, 0x50, 0x0a, 0x44, 0x11, 0xc4,
+  0x37, 0x35, 0x50, 0xe2, 0x9b, 0x7c, 0xf1, 0x58, 0xf0, 0x5c, 0x56, 0x7c, 0x70, 0xa2, 0x57, 0x63,
+  0xbb, 0xe4, 0x63, 0xa0, 0x0e, 0xae, 0xeb, 0xd0, 0x8c, 0x8b, 0x11, 0xe2, 0x31, 0x8d, 0xd1, 0x03,
+  0xde, 0x88, 0x15, 0xe3, 0x3d, 0xf0, 0x9e, 0x44, 0x1a, 0xf6, 0xc5, 0x7b, 0x1a, 0x8f, 0xc9, 0x99,
+  0x0a, 0x8e, 0x7e, 0x98, 0x1b, 0x7d, 0x03, 0x46, 0x71, 0xa3, 0xf0, 0x1b, 0x52, 0x31, 0xbf, 0x4e,
+  0x98, 0x7d, 0x46, 0x8e, 0x08, 0x56, 0xf1, 0x6e, 0x0b, 0xf1, 0x38, 0x70, 0x1e, 0x38, 0x09, 0xd9,
+  0x52, 0x63, 0x4a, 0x52, 0x86, 0x92, 0x12, 0x0a, 0x47, 0x95, 0x94, 0xb8, 0x08, 0xf5, 0x8e, 0xaf,
+  0xaa, 0x57, 0x34, 0x66, 0x2a, 0xbb, 0x16, 0xbc, 0xf8, 0x3f, 0x7e, 0x03, 0x24, 0xee, 0x9f, 0xf5,
+  0x17, 0xfb, 0x00, 0x40, 0x4e, 0x54, 0x84, 0x90, 0xc0, 0x73, 0x62, 0x20, 0x05, 0x7a, 0xd3, 0xf4,
+  0x9c, 0xf1, 0x24, 0x82, 0x43, 0x32, 0x98, 0xcb, 0x03, 0x87, 0x6c, 0x17, 0x6e, 0x8e, 0xd0, 0x6b,
+  0x8f, 0x17, 0x01, 0xa9, 0x27, 0x82, 0xca, 0xd5, 0x57, 0xa1, 0xfc, 0x14, 0x6f, 0xf3, 0xed, 0xab,
+  0x9b, 0xef, 0x9e, 0xde, 0x42, 0x91, 0x4e, 0x3d, 0x1b, 0xe4, 0x41, 0x78, 0x9f, 0x9e, 0x3c, 0x38,
+  0x21, 0xd5, 0x27, 0x7d, 0xf6, 0x9a, 0x47, 0xb2, 0x34, 0xfc, 0xa6, 0x2a, 0xe9, 0xa8, 0xdf, 0xea,
+  0xd5, 0xa3, 0x0e, 0x99, 0xaf, 0x50, 0x7a, 0x74, 0x7c, 0x72, 0x9b, 0x7c, 0xe7, 0x2c, 0x75, 0x5c,
+  0x10, 0x59, 0x52, 0xb8, 0xce, 0x59, 0xea, 0x28, 0x80, 0xfc, 0xe1, 0x47, 0x5c, 0x15, 0x13, 0x16,
+  0xea, 0x85, 0x86, 0x1d, 0x0b, 0x48, 0xb5, 0xe6, 0x09, 0x06, 0x28, 0xd6, 0x61, 0xc1, 0x53, 0x02,
+  0x92, 0x13, 0xbd, 0x71, 0xfd, 0x4c, 0xe3, 0xf5, 0x6b, 0xeb, 0x1f, 0xbd, 0xb3, 0xfe, 0xf1, 0x5f,
+  0x1a, 0xa7, 0x4f, 0x35, 0x2f, 0x7e, 0xb3, 0xf1, 0xcb, 0x9f, 0xc0, 0x33, 0x1e, 0xf0, 0xd4, 0xe5,
+  0x90, 0x67, 0x64, 0xc6, 0x37, 0x3f, 0xb8, 0x20, 0x5d, 0x63, 0x18, 0xa9, 0xc4, 0x1f, 0x2a, 0xfc,
+  0xd3, 0x1f, 0x9e, 0x31, 0xc6, 0xfd, 0x6a, 0xa1, 0x39, 0x1f, 0xbc, 0x0a, 0x76, 0x9c, 0xe2, 0xbd,
+  0x70, 0xfd, 0xf9, 0x87, 0x4a, 0xf3, 0xad, 0x33, 0x6c, 0xca, 0xd5, 0x2b, 0x05, 0xdc, 0xb9, 0xb0,
+  0xf9, 0xde, 0xcb, 0xc7, 0x23, 0x2d, 0xc7, 0x96, 0xce, 0xc6, 0xa6, 0x46, 0xf6, 0x8f, 0xc5, 0x3a,
+  0x76, 0x52, 0x91, 0x67, 0x6d, 0x59, 0x62, 0xff, 0x44, 0x90, 0x25, 0xe0, 0x1d, 0x8f, 0x6d, 0x8b,
+  0xe5, 0x1f, 0x74, 0x70, 0xf8, 0x87, 0xda, 0xc0, 0x9a, 0x72, 0xf7, 0xdb, 0x7a, 0x9e, 0xb3, 0xc7,
+  0x61, 0x5d, 0x2b, 0x19, 0x7a, 0x61, 0xdb, 0x9e, 0x75, 0xb1, 0xe3, 0xa7, 0x13, 0x8a, 0xd5, 0x16,
+  0x19, 0x54, 0x32, 0x82, 0x1a, 0x46, 0x09, 0x18, 0x17, 0xdb, 0xdf, 0x02, 0x0c, 0x59, 0x41, 0x22,
+  0x11, 0x18, 0xb9, 0x04, 0x81, 0x27, 0x40, 0x58, 0x12, 0xb4, 0x0a, 0x24, 0xa2, 0xdb, 0x87, 0x62,
+  0x84, 0xd2, 0x7e, 0xe3, 0x57, 0x57, 0x89, 0xa8, 0x56, 0x16, 0x04, 0xf5, 0x37, 0xb7, 0x7a, 0xdb,
+  0x7b, 0x79, 0xab, 0x92, 0x7d, 0xf8, 0xf6, 0xe3, 0xcd, 0xab, 0xaf, 0x35, 0x7f, 0x3c, 0xcb, 0x1e,
+  0x17, 0xea, 0x42, 0x7e, 0x07, 0x4d, 0x70, 0xd0, 0xaf, 0x37, 0x61, 0xa4, 0xdf, 0xdd, 0x3c, 0xf9,
+  0x29, 0x86, 0xde, 0xa4, 0x19, 0x7f, 0xb3, 0x1b, 0x4c, 0xa9, 0xbf, 0xbc, 0x2f, 0x93, 0x7a, 0xa8,
+  0xd8, 0xe6, 0x17, 0xdf, 0x36, 0xde, 0x7d, 0xcb, 0x63, 0xa7, 0xb5, 0x3b, 0x6f, 0x02, 0xc7, 0x31,
+  0x2f, 0x38, 0xa7, 0xfa, 0x28, 0xf1, 0x40, 0x57, 0x9b, 0x37, 0xde, 0x83, 0x26, 0x00, 0x58, 0xe3,
+  0xf4, 0xe7, 0xb8, 0x83, 0xe5, 0xfc, 0x85, 0xc6, 0x19, 0xf4, 0x85, 0xd4, 0xae, 0x6f, 0x7c, 0xf5,
+  0x4a, 0xe3, 0xc6, 0xa7, 0xa8, 0xd8, 0xde, 0x78, 0xbd, 0x79, 0xf9, 0xeb, 0x8d, 0x5b, 0x6f, 0x6e,
+  0x3c, 0x38, 0xc5, 0xf1, 0x87, 0xba, 0xe0, 0x4e, 0x9f, 0xbf, 0xb1, 0xf1, 0xea, 0x7d, 0x8c, 0xef,
+  0x9d, 0xfe, 0x3c, 0xb1, 0x85, 0x72, 0x9b, 0x3a, 0x1a, 0x12, 0x2c, 0x47, 0x89, 0x8b, 0x70, 0x57,
+  0x31, 0x37, 0xca, 0xb9, 0xd9, 0x5d, 0xab, 0x82, 0x95, 0x87, 0x87, 0xc5, 0x81, 0x7f, 0x70, 0xc1,
+  0x04, 0x3f, 0x2f, 0x7d, 0x98, 0xa4, 0xcc, 0x98, 0x6d, 0x6f, 0x57, 0xb0, 0xd4, 0x3a, 0x0a, 0x96,
+  0x5a, 0x0b, 0x2b, 0xd5, 0xaa, 0xed, 0x96, 0x38, 0x6a, 0x6d, 0x19, 0x09, 0xb2, 0xa4, 0xd9, 0x8c,
+  0x7d, 0x50, 0xd6, 0x1d, 0x29, 0x2f, 0xc8, 0x64, 0xd0, 0x80, 0xa4, 0xfb, 0xd1, 0x09, 0xc5, 0xaa,
+  0xae, 0x55, 0x05, 0xa9, 0xd5, 0xe4, 0xff, 0xbe, 0x7c, 0xe9, 0xb8, 0x07, 0x47, 0xe5, 0x36, 0x80,
+  0xb2, 0x47, 0xf5, 0x83, 0x65, 0x3c, 0x1b, 0xab, 0x71, 0xf1, 0x37, 0xb2, 0xf7, 0x99, 0xc9, 0xe9,
+  0x58, 0xa7, 0xa8, 0xb6, 0x44, 0xcf, 0x8f, 0xb0, 0xdc, 0x68, 0x7e, 0x72, 0x6b, 0xe3, 0xd4, 0xd7,
+  0xeb, 0x7f, 0xf3, 0xb9, 0x91, 0xc5, 0x05, 0x2e, 0x89, 0x01, 0xb6, 0xf1, 0xe3, 0x6d, 0x50, 0x22,
+  0x3e, 0x13, 0xb2, 0xf5, 0xf7, 0xae, 0xf1, 0x70, 0x8b, 0xdf, 0x29, 0x78, 0x02, 0x75, 0x53, 0x76,
+  0xa8, 0x29, 0x60, 0x14, 0xfc, 0xba, 0xe9, 0xb5, 0xef, 0x63, 0x74, 0x1f, 0x80, 0x94, 0x7e, 0xbd,
+  0x2d, 0xec, 0x18, 0x0c, 0x69, 0xf9, 0x8c, 0xf9, 0xd1, 0x77, 0xeb, 0x77, 0x1f, 0x78, 0x2c, 0xec,
+  0xb0, 0xb5, 0xbb, 0x9f, 0x37, 0xdf, 0xfe, 0x42, 0x13, 0x42, 0x72, 0xe3, 0xf6, 0xa7, 0x1b, 0x77,
+  0xbe, 0x56, 0x62, 0xca, 0xbb, 0x10, 0x2b, 0x04, 0x3c, 0xc0, 0x5d, 0x47, 0x01, 0xfe, 0xb8, 0xd4,
+  0x7d, 0x20, 0xa1, 0xcf, 0x5d, 0xe5, 0xfd, 0xe1, 0x44, 0xc2, 0x5b, 0x56, 0xc9, 0x7d, 0xfe, 0xea,
+  0xb5, 0xc6, 0xe9, 0x77, 0x79, 0x73, 0x1c, 0xf3, 0x97, 0x41, 0xab, 0x9e, 0x6b, 0x5c, 0xfd, 0x64,
+  0xfd, 0xa3, 0x37, 0x63, 0x75, 0x0d, 0x3f, 0x72, 0x81, 0xe2, 0x99, 0x4b, 0xde, 0xf5, 0xf7, 0x3e,
+  0x6d, 0xbe, 0x7f, 0x3a, 0xb1, 0x45, 0xd0, 0x7a, 0x4c, 0x1b, 0x3b, 0xb2, 0x2f, 0x14, 0xb8, 0xe6,
+  0x69, 0x42, 0x81, 0x72, 0xbf, 0xb3, 0x82, 0x17, 0x5c, 0x8c, 0x94, 0xac, 0xca, 0x3c, 0x3e, 0x8c,
+  0xda, 0x96, 0xe3, 0xe0, 0xc3, 0x84, 0x63, 0x22, 0xa7, 0x7b, 0xef, 0xcf, 0x6e, 0x93, 0xe1, 0xe9,
+  0xb3, 0x2c, 0xed, 0x03, 0xfc, 0x86, 0xc2, 0xf0, 0xb8, 0x0a, 0xdd, 0x86, 0xa3, 0x71, 0x01, 0x21,
+  0xac, 0x2c, 0x0f, 0x79, 0x5c, 0xf9, 0xeb, 0xb7, 0x72, 0x44, 0xca, 0xc7, 0xbd, 0xf2, 0x01, 0x63,
+  0xda, 0x23, 0xf0, 0xbe, 0x67, 0x8e, 0x8c, 0xc5, 0xb6, 0x90, 0x88, 0xd8, 0x98, 0x27, 0x11, 0xef,
+  0x5f, 0xdb, 0x78, 0xf0, 0x13, 0xff, 0x0e, 0x87, 0xcf, 0x7a, 0xd0, 0x72, 0x3c, 0x14, 0x75, 0xe2,
+  0x6b, 0xe2, 0x09, 0xe5, 0x5e, 0x9d, 0xba, 0xa3, 0xb2, 0xd4, 0x71, 0xbc, 0x55, 0xa2, 0xf9, 0x1d,
+  0xed, 0x02, 0x94, 0x3c, 0x57, 0x66, 0xcd, 0x6b, 0x5f, 0x37, 0x2e, 0xbc, 0xe3, 0x31, 0x54, 0x99,
+  0x6d, 0x9c, 0xf6, 0x12, 0x76, 0x71, 0x21, 0xea, 0x0b, 0x5a, 0x0c, 0x04, 0x96, 0xbb, 0x1d, 0x4f,
+  0x27, 0x2b, 0x95, 0xfb, 0xbd, 0xbe, 0x77, 0x1a, 0xff, 0xf0, 0xd8, 0xa3, 0x90, 0xc3, 0x80, 0x03,
+  0x9e, 0x30, 0xa8, 0xc2, 0xf8, 0xae, 0xd8, 0xda, 0xaa, 0x8d, 0x4f, 0xb6, 0xa6, 0x13, 0x03, 0xe4,
+  0x69, 0xb4, 0x0d, 0x1c, 0xfb, 0xa5, 0x49, 0xa3, 0xa8, 0x2d, 0xf1, 0x85, 0x8b, 0xc2, 0xff, 0x90,
+  0xb1, 0xa7, 0x00, 0x68, 0x99, 0x3f, 0x66, 0x66, 0xe5, 0x49, 0xac, 0x96, 0xd1, 0x0f, 0x98, 0x13,
+  0xad, 0x83, 0xcb, 0x67, 0x6d, 0x68, 0x48, 0xb3, 0x6d, 0x86, 0x74, 0x80, 0xad, 0xdd, 0x3f, 0xd7,
+  0xf8, 0xea, 0x01, 0xe7, 0x05, 0x90, 0x3a, 0x9a, 0x54, 0x78, 0x9a, 0x17, 0x95, 0xbb, 0x99, 0x60,
+  0x8d, 0xf3, 0xaf, 0x6c, 0x9c, 0x7c, 0x95, 0x17, 0xea, 0x93, 0x79, 0xbb, 0xe4, 0x43, 0x3f, 0x15,
+  0x0a, 0x70, 0x87, 0x10, 0x1a, 0x0a, 0x83, 0xec, 0x0e, 0x33, 0x88, 0xe8, 0xad, 0xc2, 0x21, 0xbc,
+  0xd3, 0xc0, 0x0f, 0x4b, 0xfc, 0x35, 0x27, 0x97, 0xb0, 0xb2, 0x82, 0x53, 0x94, 0xd5, 0x90, 0x0c,
+  0x2d, 0x72, 0x08, 0xc1, 0xb3, 0x76, 0xe7, 0x9b, 0xe6, 0x37, 0x57, 0xb7, 0x10, 0x18, 0x63, 0x93,
+  0x93, 0xa1, 0x15, 0x7f, 0x0b, 0xc6, 0x07, 0xe7, 0x49, 0x3c, 0xd6, 0x78, 0xe7, 0xfe, 0xda, 0xbd,
+  0xcf, 0xf1, 0xe6, 0xd1, 0xb3, 0xef, 0xae, 0xdf, 0xfb, 0x78, 0x00, 0x5c, 0xa1, 0x42, 0x67, 0x1d,
+  0x3b, 0xb1, 0xcd, 0xdd, 0x03, 0x7c, 0xf7, 0xd2, 0x84, 0x59, 0x38, 0x7a, 0x90, 0xaf, 0xfe, 0xd2,
+  0xe4, 0xd5, 0x98, 0x58, 0xfd, 0xef, 0x68, 0x0c, 0xaa, 0x2b, 0x32, 0xa1, 0xcb, 0x78, 0xd4, 0x86,
+  0xb6, 0x00, 0x33, 0x32, 0xdd, 0x02, 0x66, 0xa4, 0xe6, 0x5a, 0xd3, 0xb5, 0x8a, 0x41, 0x5f, 0x66,
+  0xeb, 0x54, 0x77, 0x74, 0x9b, 0xbd, 0xec, 0x78, 0xa0, 0x71, 0x99, 0x8e, 0x1d, 0x44, 0x1d, 0xe6,
+  0xe3, 0x1a, 0x70, 0xfe, 0xf8, 0x76, 0x80, 0x2c, 0x18, 0x46, 0x29, 0x1a, 0x06, 0x79, 0x6c, 0x42,
+  0x5a, 0x04, 0x76, 0x81, 0x88, 0x4b, 0xa2, 0x50, 0xa7, 0xd4, 0xaa, 0x13, 0xb6, 0x55, 0x34, 0x4b,
+  0x72, 0x8b, 0x1d, 0x08, 0x0c, 0xb0, 0xdf, 0xf0, 0xf3, 0x80, 0xef, 0x5d, 0x53, 0x95, 0x13, 0x8b,
+  0x37, 0x4f, 0x5f, 0x14, 0xec, 0xc4, 0x1a, 0xa7, 0x3f, 0x00, 0x95, 0x86, 0x9f, 0xe9, 0x55, 0xb4,
+  0x15, 0xde, 0x5c, 0x7b, 0x6e, 0xed, 0xa7, 0xb3, 0x6b, 0x77, 0xbf, 0x5c, 0x7f, 0xed, 0xd6, 0x8e,
+  0x87, 0x36, 0x84, 0x68, 0x3b, 0x6a, 0x8b, 0x45, 0xa3, 0x2a, 0x4b, 0x30, 0xd7, 0x32, 0x24, 0xc9,
+  0xe1, 0x21, 0x2d, 0x2a, 0xb5, 0x58, 0x40, 0x1d, 0x21, 0x4c, 0x8c, 0x8f, 0x1c, 0x21, 0x08, 0x98,
+  0x10, 0xbe, 0xd7, 0x0a, 0xbf, 0x4b, 0xe7, 0xcc, 0xfb, 0xbb, 0x62, 0xf8, 0x16, 0xd6, 0xc4, 0x56,
+  0xbb, 0x04, 0xe9, 0xfb, 0x77, 0x30, 0x2d, 0xa0, 0xd1, 0x01, 0x06, 0x00, 0x98, 0xff, 0xdd, 0x8e,
+  0xe6, 0x3b, 0xa7, 0x9a, 0x1f, 0xbf, 0xb1, 0xf1, 0xe3, 0x4d, 0xf5, 0x4b, 0x85, 0x03, 0x0c, 0x5c,
+  0xec, 0xa1, 0xd8, 0xef, 0x62, 0x6c, 0x26, 0x93, 0x4a, 0x65, 0x67, 0x87, 0xf0, 0xeb, 0xa7, 0x33,
+  0xb9, 0x54, 0xaa, 0x6f, 0x76, 0xc8, 0xbb, 0x12, 0x0a, 0x4c, 0x8e, 0x99, 0x5d, 0xa9, 0x54, 0xff,
+  0xec, 0xd0, 0x0a, 0x9b, 0xd9, 0x9d, 0x4a, 0x81, 0x4c, 0x18, 0x5a, 0x65, 0xf1, 0xf1, 0xb1, 0x04,
+  0xed, 0x1d, 0xbf, 0xfe, 0xcb, 0xda, 0x9d, 0xbb, 0x7c, 0xbf, 0x20, 0x7e, 0x86, 0x79, 0xf3, 0xe4,
+  0x49, 0xfe, 0xe1, 0x65, 0xf6, 0x3b, 0x6e, 0xd0, 0x92, 0xa8, 0x17, 0xdb, 0xa4, 0x7f, 0xf7, 0xcc,
+  0x73, 0xcf, 0xef, 0x3d, 0x78, 0x64, 0x64, 0xf2, 0xb9, 0xd0, 0xfe, 0x69, 0xcc, 0x98, 0x1c, 0x9b,
+  0x18, 0x1b, 0x99, 0xe6, 0x9b, 0xa7, 0x7b, 0xe5, 0xe6, 0x69, 0xfc, 0x2e, 0xd7, 0x7b, 0xd7, 0xd7,
+  0x1e, 0x7c, 0x4c, 0xdf, 0x7c, 0xc6, 0xa8, 0x2a, 0xcb, 0xf2, 0x6f, 0x83, 0x9c, 0x6b, 0x9c, 0x7f,
+  0x47, 0xf9, 0x56, 0x24, 0x7e, 0x52, 0x9e, 0x16, 0xab, 0x1a, 0x17, 0xde, 0x06, 0xf3, 0xad, 0xf1,
+  0xe6, 0xb5, 0x8d, 0x2b, 0x37, 0x1b, 0xa7, 0xce, 0xd3, 0x96, 0x6d, 0xb1, 0xf0, 0xe7, 0x7d, 0xb6,
+  0x02, 0xde, 0x47, 0x6b, 0x36, 0x7d, 0x95, 0x63, 0x85, 0x7f, 0xac, 0x8d, 0xfe, 0x2e, 0x18, 0xa5,
+  0x82, 0xf8, 0xdc, 0x1a, 0x1e, 0x45, 0x08, 0x8c, 0xc7, 0xef, 0xac, 0x55, 0x07, 0x83, 0x62, 0xfc,
+  0x22, 0x03, 0x1a, 0x18, 0x0f, 0x6a, 0x5c, 0x3c, 0xd1, 0xad, 0xb8, 0xb8, 0x74, 0x89, 0xcb, 0x96,
+  0xca, 0x09, 0x0e, 0x27, 0x74, 0x33, 0x68, 0xe7, 0xf5, 0x4e, 0x6f, 0xf7, 0xa8, 0x4f, 0xad, 0x04,
+  0x7d, 0x6e, 0x01, 0xb7, 0x48, 0xff, 0x4e, 0x7b, 0xe2, 0x04, 0x6f, 0xad, 0x0e, 0x4f, 0xae, 0x83,
+  0x7f, 0x57, 0xf0, 0xcf, 0x2a, 0xc6, 0x44, 0xe5, 0x56, 0x50, 0x7f, 0x8b, 0xa8, 0x64, 0x9c, 0xf0,
+  0x05, 0x39, 0x2d, 0xdf, 0x08, 0xc6, 0x17, 0xba, 0x67, 0x6b, 0x2f, 0x7d, 0x57, 0x30, 0x9e, 0xc9,
+  0xf0, 0x13, 0x0f, 0x4b, 0x78, 0x29, 0x92, 0xf8, 0x32, 0xb0, 0x86, 0x5f, 0x05, 0x1e, 0x09, 0x26,
+  0x67, 0xfa, 0xf0, 0x9b, 0x44, 0x1c, 0x25, 0xe5, 0x8b, 0xbe, 0x5e, 0x7e, 0x2e, 0x1b, 0xcf, 0x41,
+  0xba, 0x13, 0xce, 0xe3, 0x9f, 0x65, 0xdd, 0x45, 0x97, 0x6a, 0x44, 0xe5, 0xec, 0x06, 0x32, 0x2b,
+  0x39, 0x0f, 0xc3, 0xf8, 0x4b, 0xe2, 0xdb, 0x88, 0xf4, 0xa1, 0xc4, 0x25, 0xe5, 0x43, 0x89, 0xf5,
+  0x36, 0x1b, 0x52, 0x91, 0x52, 0x9c, 0x25, 0x52, 0xc8, 0x02, 0x89, 0xe0, 0x80, 0x8b, 0x9c, 0x15,
+  0x4d, 0xb0, 0x0d, 0x9d, 0x2f, 0x02, 0xd0, 0x01, 0x9e, 0x45, 0x19, 0x2d, 0xcf, 0x13, 0x76, 0xf4,
+  0xdc, 0x6d, 0xe5, 0x53, 0x87, 0xb6, 0xd9, 0xb1, 0xa4, 0xa9, 0x94, 0x2c, 0x74, 0x2c, 0xa9, 0x1c,
+  0x02, 0x5d, 0xea, 0xd8, 0xfa, 0x92, 0xd2, 0xfa, 0x52, 0xc7, 0xd6, 0x97, 0x94, 0xd6, 0x97, 0x3a,
+  0xb6, 0xbe, 0x44, 0xad, 0x87, 0x2f, 0x7c, 0x10, 0xda, 0x54, 0x63, 0x26, 0xaa, 0x69, 0xbe, 0x65,
+  0xba, 0x9a, 0xa2, 0x78, 0x19, 0x1a, 0xc7, 0x83, 0x80, 0x68, 0x78, 0x4b, 0xaf, 0xb2, 0x4f, 0x47,
+  0x35, 0x80, 0xf8, 0x17, 0x45, 0xbc, 0xaa, 0x78, 0xf5, 0x8e, 0xd9, 0xbe, 0xaa, 0xd9, 0x52, 0xb5,
+  0xe0, 0x55, 0x2d, 0x40, 0xd5, 0x42, 0xfb, 0xaa, 0x85, 0x84, 0x72, 0x25, 0x65, 0xe7, 0x2b, 0x00,
+  0xda, 0x9d, 0x7c, 0x6f, 0xd7, 0x07, 0x6e, 0x84, 0xb5, 0xc1, 0x32, 0x9c, 0x19, 0xc0, 0x03, 0xa3,
+  0x72, 0xaa, 0x6e, 0xb0, 0x2a, 0x40, 0xd9, 0xd1, 0x05, 0xbc, 0x25, 0x5a, 0xa8, 0xc9, 0x4e, 0x84,
+  0x94, 0x24, 0x0f, 0x13, 0xa5, 0x13, 0x05, 0x25, 0xad, 0x5b, 0xea, 0x74, 0x20, 0x9d, 0x24, 0x72,
+  0x98, 0x82, 0x5c, 0x68, 0xe1, 0x75, 0x8e, 0x12, 0x13, 0x94, 0x55, 0xb2, 0x05, 0x7a, 0x16, 0x35,
+  0xc5, 0xe5, 0x8e, 0x50, 0xcc, 0xaa, 0x98, 0x95, 0x6a, 0x8d, 0x5f, 0x24, 0xaf, 0xbe, 0x14, 0x94,
+  0x17, 0x85, 0x0a, 0xde, 0xf7, 0x38, 0x17, 0x8d, 0x55, 0x87, 0x44, 0xfa, 0xf2, 0x00, 0x7e, 0x10,
+  0x13, 0xff, 0x38, 0xf8, 0xa7, 0x30, 0x90, 0xf6, 0x0f, 0xc3, 0x42, 0xa1, 0xc3, 0xf4, 0x55, 0x52,
+  0xa4, 0x5c, 0x6c, 0x39, 0x36, 0x00, 0xff, 0x34, 0x16, 0xd3, 0xe1, 0x41, 0xc7, 0x07, 0x07, 0x1e,
+  0x1c, 0x7c, 0x28, 0xc0, 0x03, 0x88, 0x14, 0x2c, 0x05, 0x62, 0xd1, 0x5a, 0x3e, 0x5a, 0x95, 0x65,
+  0xe9, 0x75, 0x9f, 0xb5, 0x5c, 0x91, 0x45, 0x29, 0x61, 0x1c, 0xaf, 0xa9, 0x11, 0x40, 0x28, 0x61,
+  0x92, 0x0c, 0x2a, 0x04, 0x12, 0x3c, 0x20, 0xc2, 0xa7, 0xc7, 0x21, 0x40, 0x56, 0x8c, 0x9f, 0x77,
+  0x8b, 0x2f, 0xbf, 0x6c, 0xc7, 0xbb, 0x82, 0x0b, 0xfb, 0x93, 0x5a, 0x4e, 0x40, 0xe2, 0x4e, 0xb1,
+  0xc3, 0xda, 0x4b, 0x75, 0x30, 0x35, 0x19, 0x4e, 0xd5, 0x13, 0x00, 0xa7, 0x25, 0xb5, 0x80, 0xa9,
+  0x1c, 0x42, 0x67, 0x96, 0x5e, 0x06, 0x86, 0x0e, 0xb8, 0x30, 0x50, 0x9d, 0x2d, 0xe3, 0x62, 0xb5,
+  0x40, 0x05, 0xad, 0x16, 0xc6, 0x97, 0x8f, 0xf9, 0x97, 0x12, 0xb7, 0x9a, 0x24, 0x4e, 0x14, 0x44,
+  0xc7, 0x87, 0xe8, 0x3c, 0x34, 0x44, 0x3d, 0x0a, 0xa2, 0xee, 0x43, 0xd4, 0x1f, 0x1a, 0x62, 0x21,
+  0x0a, 0x62, 0xc1, 0x87, 0x58, 0x88, 0x82, 0xb8, 0x43, 0xd9, 0xff, 0x84, 0xa7, 0x74, 0xf1, 0x34,
+  0x76, 0x9f, 0x72, 0x66, 0x13, 0x92, 0xd1, 0xc2, 0xc1, 0xf3, 0xd8, 0xfc, 0x28, 0xe7, 0xc3, 0xdf,
+  0xfb, 0x11, 0x27, 0x18, 0x4f, 0xb3, 0x9e, 0x54, 0x9a, 0x3b, 0x85, 0xa9, 0x74, 0x40, 0x2c, 0x08,
+  0xc7, 0x33, 0x68, 0xc9, 0x20, 0x3a, 0x64, 0xcc, 0x60, 0x65, 0x69, 0xcf, 0x3c, 0xf6, 0x98, 0x1c,
+  0xbf, 0x97, 0x5e, 0x62, 0x82, 0x4a, 0xf2, 0xc9, 0xf1, 0x9e, 0x0a, 0xe2, 0x06, 0xf7, 0xb0, 0xea,
+  0xfb, 0x3d, 0xa9, 0xbd, 0xe7, 0xb8, 0x1d, 0xd9, 0xf6, 0xc4, 0x31, 0x80, 0x28, 0xe0, 0x8c, 0xd0,
+  0x5a, 0x0f, 0xab, 0xd1, 0xa7, 0x92, 0x69, 0xd6, 0xcd, 0x18, 0x29, 0x78, 0x98, 0x15, 0x4d, 0x7a,
+  0x09, 0xd0, 0xab, 0x71, 0x6b, 0xd9, 0xb0, 0x47, 0xc1, 0x50, 0x8e, 0x27, 0x66, 0x3d, 0xe6, 0x55,
+  0xbf, 0xe3, 0xfc, 0x18, 0xe2, 0x88, 0xb7, 0x4f, 0x79, 0xd1, 0x7d, 0x91, 0x20, 0x6f, 0x87, 0xf3,
+  0xdd, 0x38, 0x3e, 0xb3, 0x22, 0xe3, 0xf8, 0xd4, 0x1c, 0xb7, 0xc2, 0xff, 0x18, 0x43, 0x34, 0x94,
+  0x84, 0xff, 0xf4, 0x96, 0x49, 0x48, 0x66, 0xe1, 0xce, 0x9f, 0xc1, 0xb6, 0xb5, 0x8d, 0x70, 0xed,
+  0x31, 0x91, 0x90, 0xf7, 0xcc, 0xfc, 0xa9, 0xaa, 0x9e, 0x37, 0x42, 0x30, 0xc7, 0x04, 0xcc, 0x1d,
+  0x74, 0xd7, 0x55, 0x27, 0x62, 0xd6, 0xaa, 0xff, 0x16, 0x52, 0xfa, 0x44, 0x4b, 0xab, 0x9e, 0xaf,
+  0x4f, 0x32, 0x81, 0x1a, 0x8a, 0x24, 0x9d, 0xfb, 0x9f, 0x81, 0x73, 0x83, 0x61, 0xb7, 0xcd, 0xf3,
+  0x51, 0x7d, 0x4f, 0xc5, 0xaf, 0x16, 0xec, 0xfb, 0xc8, 0xef, 0x03, 0x04, 0x55, 0x86, 0x16, 0xfa,
+  0x56, 0x34, 0xed, 0x72, 0x3c, 0xc6, 0x3f, 0x40, 0x2b, 0x8c, 0xf7, 0x9b, 0xaf, 0x36, 0xce, 0xbf,
+  0xf2, 0x8f, 0x9f, 0x3f, 0xf5, 0x0c, 0xfc, 0xc6, 0xcd, 0x37, 0x78, 0x16, 0xb8, 0x76, 0xe8, 0xe8,
+  0x5d, 0xb8, 0xd1, 0x78, 0xf9, 0xf2, 0xfa, 0xdd, 0x2f, 0x7b, 0x93, 0x99, 0x74, 0xe3, 0xf4, 0x1b,
+  0x9b, 0xef, 0x7e, 0xfa, 0x7f, 0x4e, 0xbe, 0x12, 0x4b, 0x04, 0x2f, 0x50, 0x14, 0x6d, 0x4f, 0x7b,
+  0x84, 0x6f, 0x39, 0x7f, 0xa0, 0xb8, 0xd9, 0xd2, 0xe9, 0x04, 0x67, 0xbc, 0xba, 0x00, 0x14, 0xd4,
+  0xf2, 0x35, 0xfb, 0x59, 0xbd, 0x84, 0x0b, 0x7b, 0x7a, 0xa9, 0xdb, 0xb5, 0x5c, 0x78, 0x9e, 0x33,
+  0x1c, 0xf7, 0x59, 0xf1, 0x7b, 0xd8, 0x28, 0x98, 0x7a, 0x45, 0x2b, 0x58, 0x15, 0x43, 0xe4, 0xf2,
+  0xfd, 0x2b, 0x3b, 0x42, 0x7e, 0x78, 0x6d, 0x8e, 0x7f, 0x45, 0x3e, 0x9e, 0x4b, 0x84, 0x9c, 0x72,
+  0x51, 0x6c, 0x81, 0x7f, 0x00, 0xa5, 0x0a, 0xce, 0x98, 0x72, 0xed, 0x2a, 0x35, 0xae, 0x1c, 0xea,
+  0x91, 0xc7, 0xc1, 0x4d, 0x5d, 0x3d, 0xd5, 0x23, 0x8f, 0x9d, 0x10, 0x5a, 0xca, 0xc9, 0x1e, 0x3f,
+  0x9d, 0xa3, 0xa9, 0x1c, 0xf0, 0xf1, 0x76, 0x3d, 0xcc, 0xdb, 0x06, 0xdf, 0xcc, 0x36, 0xd3, 0xab,
+  0x64, 0xf0, 0x4e, 0xc8, 0xe3, 0x3d, 0xb4, 0x03, 0x29, 0x70, 0xf7, 0x68, 0xc5, 0xe8, 0xb8, 0x99,
+  0x46, 0x77, 0x93, 0x54, 0x46, 0xed, 0xe1, 0x16, 0x37, 0x2f, 0x43, 0x15, 0x71, 0xf3, 0xb2, 0x72,
+  0x4d, 0x4e, 0xcd, 0x51, 0xa3, 0xa7, 0x80, 0x86, 0x9a, 0x38, 0x35, 0xfd, 0x8c, 0xbf, 0xae, 0x19,
+  0xc5, 0xa9, 0xb4, 0x05, 0xbe, 0xe5, 0x12, 0xe7, 0x98, 0xca, 0x5c, 0x31, 0xbf, 0x54, 0x30, 0x72,
+  0x07, 0xc8, 0xe6, 0x41, 0x28, 0xfb, 0xeb, 0xa9, 0x2d, 0xe8, 0xf8, 0x62, 0x88, 0xba, 0xda, 0x69,
+  0x8f, 0x5f, 0x27, 0x32, 0xe1, 0xb8, 0xb7, 0x5e, 0x0a, 0x8d, 0xdf, 0x99, 0x3e, 0x7d, 0xe1, 0xb1,
+  0x6d, 0x81, 0xc0, 0x6b, 0xc1, 0x5b, 0x00, 0xd0, 0x77, 0xb2, 0xb7, 0xae, 0x4b, 0x9c, 0xf4, 0xc8,
+  0xb5, 0xe7, 0x74, 0x6c, 0x99, 0x77, 0x5c, 0x5e, 0x87, 0x11, 0x03, 0x35, 0xf5, 0xa4, 0x57, 0x1b,
+  0x04, 0xdb, 0x88, 0x3b, 0x6e, 0xcd, 0xc7, 0x63, 0x9c, 0xde, 0xbc, 0x5f, 0x03, 0xec, 0x50, 0x75,
+  0x28, 0x26, 0x37, 0x4c, 0xb6, 0xb7, 0x52, 0x71, 0x05, 0x85, 0x1d, 0x2a, 0xb4, 0x14, 0x8d, 0x30,
+  0x34, 0xa3, 0x37, 0x0e, 0xfa, 0xcd, 0x37, 0x6e, 0x7f, 0xd7, 0x3c, 0x73, 0x16, 0x25, 0xc7, 0xcb,
+  0x97, 0x9b, 0xdf, 0x5c, 0x8d, 0x05, 0xb6, 0x00, 0xf9, 0xd2, 0x82, 0xee, 0x08, 0x0a, 0xf0, 0x92,
+  0x3c, 0x9d, 0x19, 0xc1, 0x48, 0x1c, 0x94, 0xc2, 0x48, 0x91, 0x6c, 0xe4, 0xc8, 0x6b, 0x32, 0xdb,
+  0xb3, 0x49, 0x50, 0x0a, 0x08, 0xdb, 0x94, 0xc5, 0x0e, 0x81, 0xb9, 0x89, 0x7f, 0xd9, 0xfa, 0x77,
+  0x97, 0xa0, 0x15, 0xb4, 0x2a, 0x0f, 0x15, 0x28, 0xa9, 0xa0, 0x26, 0x55, 0x9f, 0xf6, 0x8a, 0xfd,
+  0x22, 0xd2, 0x7e, 0x6b, 0x9b, 0x54, 0x70, 0xfd, 0xfe, 0x3b, 0xcd, 0xcf, 0x7e, 0x6e, 0x5e, 0xb8,
+  0xbc, 0xfe, 0xc3, 0xd5, 0x18, 0xd7, 0xed, 0x0f, 0xcf, 0x8c, 0x12, 0xa9, 0x19, 0x7a, 0x20, 0x69,
+  0x40, 0x4f, 0x5b, 0x41, 0x8b, 0xe2, 0x4b, 0x2e, 0xd0, 0xb6, 0xaa, 0x19, 0xcd, 0x95, 0x94, 0xba,
+  0x55, 0x55, 0x14, 0x76, 0x2d, 0x35, 0x85, 0x64, 0xdc, 0xaa, 0xae, 0x93, 0xb7, 0x6c, 0x23, 0xb2,
+  0xb2, 0x10, 0x9f, 0x7c, 0x41, 0x6f, 0x4b, 0x2a, 0x82, 0x50, 0x6d, 0x25, 0xa2, 0x90, 0xb4, 0xea,
+  0x60, 0x43, 0xd2, 0x84, 0xf8, 0x5c, 0x9c, 0xcc, 0x96, 0xba, 0xa1, 0x3b, 0xe6, 0x1d, 0xd5, 0xf5,
+  0x8a, 0xc9, 0x3d, 0xa8, 0x28, 0x82, 0xb2, 0xa1, 0x60, 0x6f, 0xde, 0xbb, 0xee, 0x1a, 0x3f, 0xb4,
+  0x45, 0x57, 0xaf, 0x2a, 0xab, 0x0a, 0x12, 0x02, 0x6d, 0x36, 0xeb, 0x66, 0x11, 0x19, 0x19, 0xfc,
+  0x1a, 0x08, 0x6e, 0x2f, 0x4b, 0x6f, 0x15, 0x28, 0x6e, 0x33, 0xed, 0x11, 0x03, 0x20, 0xcf, 0x93,
+  0xfe, 0x4d, 0x5b, 0xbe, 0xd0, 0x0c, 0x44, 0xaa, 0x87, 0xfc, 0x40, 0xb5, 0x37, 0x3b, 0xb9, 0xf2,
+  0xdb, 0x29, 0xa4, 0x7b, 0x84, 0x9a, 0xf6, 0x4a, 0xf2, 0x0f, 0x50, 0xfb, 0xd6, 0x50, 0xc9, 0x9a,
+  0xdf, 0x42, 0xa9, 0x94, 0x70, 0x30, 0x7c, 0x2d, 0x24, 0x2e, 0x0d, 0xf5, 0x6a, 0xf0, 0xab, 0x26,
+  0x44, 0xa5, 0x78, 0xac, 0x60, 0x2e, 0xf1, 0xd2, 0x58, 0x2e, 0xcc, 0x7f, 0xf0, 0xc6, 0xef, 0x56,
+  0x9e, 0x4f, 0xf1, 0x83, 0xef, 0xa3, 0x0b, 0x66, 0xa9, 0x10, 0xc7, 0xa2, 0x09, 0x99, 0xa1, 0x7e,
+  0x45, 0xd9, 0x7f, 0x97, 0x17, 0xfa, 0xf0, 0x5b, 0xbd, 0xf8, 0xdd, 0x00, 0x78, 0xbb, 0x4e, 0xa7,
+  0xe3, 0xe3, 0x7b, 0xba, 0xf9, 0x1d, 0x15, 0xc3, 0xf0, 0x84, 0x9f, 0x94, 0xc6, 0xdf, 0x05, 0xb7,
+  0x5c, 0x1a, 0xde, 0xf1, 0x7f, 0x01, 0xe8, 0x4d, 0x24, 0x23, 0x60, 0xc5, 0x00, 0x00,
 };
-
-let ws;
-let rowCount = 0;
-let runId = 0;
-let runActive = false;
-let runPendingStart = false;
-let runStartMs = 0;
-let runStartDist = 0;
-let runLastMs = 0;
-let lastClosedRunId = 0;
-let runStats = null;
-let prevDiag = true;
-let prevFallen = false;
-let prevBench = false;
-let pendingCloseReason = '';
-
-function fmt(v, n=2) {
-  const x = Number(v);
-  return Number.isFinite(x) ? x.toFixed(n) : '--';
-}
-
-function addRunMarker(text, run, cls='run-marker') {
-  const tr = document.createElement('tr');
-  tr.className = `${cls} run-${run}`;
-  tr.innerHTML = `<td colspan="28">${text}</td>`;
-  tableBody.appendChild(tr);
-}
-
-function startRun() {
-  runId += 1;
-  runActive = true;
-  pendingCloseReason = '';
-  runPendingStart = true;
-  runStartMs = 0;
-  runStartDist = state.dist;
-  runLastMs = 0;
-  runStats = { maxPitch: 0, maxPid: 0, maxSpeed: 0, rows: 0 };
-  addRunMarker(`RUN ${runId} START | waiting first sample... | pitch=${fmt(state.pitch,2)} | pid=${fmt(state.pid,1)}`, runId);
-}
-
-function closeRun(reason, ms = 0) {
-  if (!runActive) return;
-  const endMs = runLastMs || ms || runStartMs;
-  const duration = Math.max(0, endMs - runStartMs);
-  const deltaDist = state.dist - runStartDist;
-  addRunMarker(
-    `RUN ${runId} END(${reason}) | duration=${duration}ms | rows=${runStats.rows} | max|pitch|=${fmt(runStats.maxPitch,2)}deg | max|pid|=${fmt(runStats.maxPid,1)} | max|speed|=${fmt(runStats.maxSpeed,3)}m/s | dist=${fmt(deltaDist,4)}m`,
-    runId,
-    'run-marker run-end'
-  );
-  runActive = false;
-  runPendingStart = false;
-  pendingCloseReason = '';
-  lastClosedRunId = runId;
-  runStats = null;
-}
-
-function addTableRow(s) {
-  if (!runActive) return;
-  if (runPendingStart) {
-    runStartMs = s.ms;
-    runLastMs = s.ms;
-    runStartDist = s.dist;
-    runPendingStart = false;
-  }
-
-  rowCount += 1;
-  runStats.rows += 1;
-  runStats.maxPitch = Math.max(runStats.maxPitch, Math.abs(s.pitch));
-  runStats.maxPid = Math.max(runStats.maxPid, Math.abs(s.pid));
-  runStats.maxSpeed = Math.max(runStats.maxSpeed, Math.abs(s.speed));
-
-  const ageMs = runStartMs ? (s.ms - runStartMs) : 0;
-  const dtMs = runLastMs ? (s.ms - runLastMs) : 0;
-  runLastMs = s.ms;
-
-  const tr = document.createElement('tr');
-  tr.className = `run-${runId}`;
-  tr.innerHTML = `
-    <td>${rowCount}</td>
-    <td>${runId}</td>
-    <td>${s.ms}</td>
-    <td>${ageMs}</td>
-    <td>${dtMs}</td>
-    <td>${fmt(s.pitch,2)}</td>
-    <td>${fmt(s.target,2)}</td>
-    <td>${fmt(s.gyro,2)}</td>
-    <td>${fmt(s.pid,1)}</td>
-    <td>${fmt(s.ctrlDt,2)}</td>
-    <td>${fmt(s.uRaw,1)}</td>
-    <td>${fmt(s.uClamp,1)}</td>
-    <td>${fmt(s.uDz,0)}</td>
-    <td>${s.uSendR}</td>
-    <td>${s.uSendL}</td>
-    <td>${s.cmdR}</td>
-    <td>${s.cmdL}</td>
-    <td>${s.actR}</td>
-    <td>${s.actL}</td>
-    <td>${fmt(s.speed,3)}</td>
-    <td>${fmt(s.dist,4)}</td>
-    <td>${fmt(s.vinR,2)}</td>
-    <td>${fmt(s.vinL,2)}</td>
-    <td>${fmt(s.curR,1)}</td>
-    <td>${fmt(s.curL,1)}</td>
-    <td>${fmt(s.tmpR,1)}</td>
-    <td>${fmt(s.tmpL,1)}</td>
-    <td>${s.bench ? 'BENCH' : (s.fallen ? 'FALLEN' : (s.diag ? 'DIAG' : 'RUN'))}</td>
-  `;
-  const stickBottom = tableWrap.scrollTop + tableWrap.clientHeight >= tableWrap.scrollHeight - 32;
-  tableBody.appendChild(tr);
-  if (stickBottom) tableWrap.scrollTop = tableWrap.scrollHeight;
-}
-
-function clearTable() {
-  tableBody.innerHTML = '';
-  rowCount = 0;
-  runId = 0;
-  runActive = false;
-  runPendingStart = false;
-  pendingCloseReason = '';
-  runStats = null;
-  lastClosedRunId = 0;
-}
-
-function copyTextWithFallback(text) {
-  if (navigator.clipboard && window.isSecureContext) {
-    return navigator.clipboard.writeText(text).then(() => true).catch(() => false);
-  }
-
-  return new Promise((resolve) => {
-    try {
-      const ta = document.createElement('textarea');
-      ta.value = text;
-      ta.setAttribute('readonly', '');
-      ta.style.position = 'fixed';
-      ta.style.top = '-9999px';
-      ta.style.left = '-9999px';
-      document.body.appendChild(ta);
-      ta.focus();
-      ta.select();
-      const ok = document.execCommand('copy');
-      document.body.removeChild(ta);
-      resolve(!!ok);
-    } catch (e) {
-      resolve(false);
-    }
-  });
-}
-
-function copyRows(rows, title) {
-  if (!rows.length) return;
-  const out = [];
-  if (title) out.push(`# ${title}`);
-  rows.forEach((tr) => {
-    if (tr.classList.contains('run-marker')) {
-      out.push(`\n${tr.innerText}\n`);
-    } else {
-      out.push(Array.from(tr.children).map((td) => td.innerText).join('\t'));
-    }
-  });
-  const text = out.join('\n');
-  copyTextWithFallback(text).then((ok) => {
-    if (ok) {
-      alert('已复制到剪贴板');
-    } else {
-      alert('当前环境禁止剪贴板访问，请在 HTTPS 页面或现代浏览器中重试');
-    }
-  });
-}
-
-function copyTable() {
-  copyRows(Array.from(tableBody.children), 'All runs');
-}
-
-function copyLastRun() {
-  const target = runActive ? runId : lastClosedRunId;
-  if (!target) return;
-  const rows = Array.from(tableBody.children).filter((tr) => tr.classList.contains(`run-${target}`));
-  copyRows(rows, `Run ${target}`);
-}
-
-const HISTORY = 180;
-const labels = Array(HISTORY).fill('');
-
-function mkChart(id, datasets, yAxes) {
-  const ctx = document.getElementById(id).getContext('2d');
-  return new Chart(ctx, {
-    type: 'line',
-    data: { labels: labels.slice(), datasets },
-    options: {
-      responsive: true,
-      maintainAspectRatio: false,
-      animation: false,
-      interaction: { intersect: false, mode: 'index' },
-      scales: yAxes,
-      plugins: {
-        legend: { labels: { color: '#9ab1c6', boxWidth: 10, font: { size: 10 } } }
-      },
-      elements: { point: { radius: 0 } }
-    }
-  });
-}
-
-const chartAngle = mkChart('chart-angle', [
-  { label: 'Pitch', data: Array(HISTORY).fill(0), borderColor: '#4fc3f7', tension: 0.25, borderWidth: 1.6, yAxisID: 'y' },
-  { label: 'Target', data: Array(HISTORY).fill(0), borderColor: '#ffc857', tension: 0.25, borderWidth: 1.4, yAxisID: 'y' },
-  { label: 'Roll', data: Array(HISTORY).fill(0), borderColor: '#f687b3', tension: 0.25, borderWidth: 1.2, yAxisID: 'y' }
-], {
-  x: { display: false },
-  y: { grid: { color: '#1f2b3a' }, ticks: { color: '#6f8499', font: { size: 10 } } }
-});
-
-const chartCtrl = mkChart('chart-ctrl', [
-  { label: 'PID', data: Array(HISTORY).fill(0), borderColor: '#ffc857', tension: 0.2, borderWidth: 1.5, yAxisID: 'y' },
-  { label: 'Gyro', data: Array(HISTORY).fill(0), borderColor: '#4fc3f7', tension: 0.2, borderWidth: 1.2, yAxisID: 'y' },
-  { label: 'Speed(m/s)', data: Array(HISTORY).fill(0), borderColor: '#72e4b6', tension: 0.2, borderWidth: 1.2, yAxisID: 'y1' }
-], {
-  x: { display: false },
-  y: { grid: { color: '#1f2b3a' }, ticks: { color: '#6f8499', font: { size: 10 } } },
-  y1: { position: 'right', grid: { drawOnChartArea: false }, ticks: { color: '#6f8499', font: { size: 10 } } }
-});
-
-const chartMotor = mkChart('chart-motor', [
-  { label: 'CmdR', data: Array(HISTORY).fill(0), borderColor: '#4fc3f7', tension: 0.2, borderWidth: 1.3, yAxisID: 'y' },
-  { label: 'CmdL', data: Array(HISTORY).fill(0), borderColor: '#7cc8ff', tension: 0.2, borderWidth: 1.3, yAxisID: 'y' },
-  { label: 'ActR', data: Array(HISTORY).fill(0), borderColor: '#ffc857', tension: 0.2, borderWidth: 1.2, yAxisID: 'y' },
-  { label: 'ActL', data: Array(HISTORY).fill(0), borderColor: '#f6a64e', tension: 0.2, borderWidth: 1.2, yAxisID: 'y' },
-  { label: 'CurR(mA)', data: Array(HISTORY).fill(0), borderColor: '#72e4b6', tension: 0.2, borderWidth: 1.1, yAxisID: 'y1' },
-  { label: 'CurL(mA)', data: Array(HISTORY).fill(0), borderColor: '#3fcf9d', tension: 0.2, borderWidth: 1.1, yAxisID: 'y1' }
-], {
-  x: { display: false },
-  y: { grid: { color: '#1f2b3a' }, ticks: { color: '#6f8499', font: { size: 10 } } },
-  y1: { position: 'right', grid: { drawOnChartArea: false }, ticks: { color: '#6f8499', font: { size: 10 } } }
-});
-
-function pushChart(chart, values) {
-  chart.data.datasets.forEach((ds, i) => {
-    ds.data.push(values[i]);
-    ds.data.shift();
-  });
-  chart.update('none');
-}
-
-function updateIndicators() {
-  document.getElementById('val-p').textContent = fmt(state.pitch, 2);
-  document.getElementById('val-r').textContent = fmt(state.roll, 2);
-  document.getElementById('val-y').textContent = fmt(state.yaw, 1);
-  document.getElementById('val-g').textContent = fmt(state.gyro, 2);
-
-  document.getElementById('kpi-target').textContent = `${fmt(state.target,2)}°`;
-  document.getElementById('kpi-pid').textContent = fmt(state.pid, 1);
-  document.getElementById('kpi-speed').textContent = `${fmt(state.speed,3)} m/s`;
-  document.getElementById('kpi-dist').textContent = `${fmt(state.dist,4)} m`;
-  document.getElementById('kpi-cmd').textContent = `${state.cmdR} / ${state.cmdL}`;
-  document.getElementById('kpi-act').textContent = `${state.actR} / ${state.actL}`;
-
-  document.getElementById('t-val').textContent = `${fmt(state.target, 2)}°`;
-  document.getElementById('vin-val').textContent = `${fmt(state.vinR,2)} / ${fmt(state.vinL,2)} V`;
-  document.getElementById('cur-val').textContent = `${fmt(state.curR,1)} / ${fmt(state.curL,1)} mA`;
-  document.getElementById('tmp-val').textContent = `${fmt(state.tmpR,1)} / ${fmt(state.tmpL,1)} C`;
-
-  if (state.bench) {
-    botSt.textContent = '架空阶跃';
-    botSt.className = 'badge warn';
-  } else if (state.fallen) {
-    botSt.textContent = '已跌倒';
-    botSt.className = 'badge err';
-  } else if (state.diag) {
-    botSt.textContent = '待启动';
-    botSt.className = 'badge warn';
-  } else {
-    botSt.textContent = '平衡中';
-    botSt.className = 'badge on';
-  }
-
-  modeSt.textContent = state.bench ? 'BENCH' : (state.diag ? 'DIAG' : 'RUN');
-  modeSt.className = state.bench ? 'badge warn' : (state.diag ? 'badge warn' : 'badge on');
-}
-
-const canvas = document.getElementById('c3d');
-const ctx3d = canvas.getContext('2d');
-let W, H, CX, CY;
-const P3 = (x,y,z) => ({x,y,z});
-const rotX = (p, a) => { const c=Math.cos(a), s=Math.sin(a); return P3(p.x, p.y*c - p.z*s, p.y*s + p.z*c); };
-const rotY = (p, a) => { const c=Math.cos(a), s=Math.sin(a); return P3(p.x*c + p.z*s, p.y, -p.x*s + p.z*c); };
-const rotZ = (p, a) => { const c=Math.cos(a), s=Math.sin(a); return P3(p.x*c - p.y*s, p.x*s + p.y*c, p.z); };
-const project = (p) => { const scale = 300 / (420 + p.z); return { x: CX + p.x * scale, y: CY - p.y * scale }; };
-const box = [
-  P3(-30, 40, 10), P3(30, 40, 10), P3(30, -40, 10), P3(-30, -40, 10),
-  P3(-30, 40, -10), P3(30, 40, -10), P3(30, -40, -10), P3(-30, -40, -10)
-];
-const axes = [
-  {s:P3(0,0,0), e:P3(60,0,0), c:'#f44336'},
-  {s:P3(0,0,0), e:P3(0,60,0), c:'#4caf50'},
-  {s:P3(0,0,0), e:P3(0,0,60), c:'#2196f3'}
-];
-
-function resize3d() {
-  W = canvas.width = canvas.parentElement.clientWidth;
-  H = canvas.height = canvas.parentElement.clientHeight;
-  CX = W * 0.5;
-  CY = H * 0.52;
-}
-window.addEventListener('resize', resize3d);
-resize3d();
-
-function drawLine(p1, p2, color, width=1) {
-  ctx3d.strokeStyle = color;
-  ctx3d.lineWidth = width;
-  ctx3d.beginPath();
-  ctx3d.moveTo(p1.x, p1.y);
-  ctx3d.lineTo(p2.x, p2.y);
-  ctx3d.stroke();
-}
-
-function render3d() {
-  ctx3d.clearRect(0, 0, W, H);
-  const p = state.pitch * Math.PI / 180;
-  const r = state.roll * Math.PI / 180;
-  const y = state.yaw * Math.PI / 180;
-  const transform = (pt) => {
-    let t = rotX(pt, p);
-    t = rotZ(t, -r);
-    t = rotY(t, -y);   // 取反：rotY 实现为顺时针，陀螺 yaw 为右手逆时针，符号对齐
-    t = rotX(t, 0.28);
-    t = rotY(t, 0.48);
-    return t;
-  };
-  axes.forEach((axis) => drawLine(project(transform(axis.s)), project(transform(axis.e)), axis.c, 2));
-  const v = box.map((pt) => project(transform(pt)));
-  [[0,1],[1,2],[2,3],[3,0],[4,5],[5,6],[6,7],[7,4],[0,4],[1,5],[2,6],[3,7]]
-    .forEach((pair) => drawLine(v[pair[0]], v[pair[1]], '#6fc8ff', 1.1));
-  requestAnimationFrame(render3d);
-}
-render3d();
-
-function connect() {
-  ws = new WebSocket(`ws://${location.hostname}:81/`);
-  ws.onopen = () => {
-    wsSt.textContent = '已连接';
-    wsSt.className = 'badge on';
-  };
-  ws.onclose = () => {
-    wsSt.textContent = '断开重连...';
-    wsSt.className = 'badge err';
-    setTimeout(connect, 1500);
-  };
-
-  ws.onmessage = (e) => {
-    const d = e.data;
-
-    if (d.startsWith('A,')) {
-      const p = d.split(',');
-      state.pitch = parseFloat(p[1]);
-      state.roll = parseFloat(p[2]);
-      state.yaw = parseFloat(p[3]);
-      state.pid = parseFloat(p[4]);
-      state.fallen = p[5] === '1';
-      state.diag = p[6] === '1';
-      state.target = parseFloat(p[7]);
-      state.gyro = parseFloat(p[8]);
-      state.speed = parseFloat(p[9]) / 1000.0;
-      state.dist = parseFloat(p[10]) / 1000.0;
-      state.cmdR = parseInt(p[11]);
-      state.cmdL = parseInt(p[12]);
-      state.actR = parseInt(p[13]);
-      state.actL = parseInt(p[14]);
-      state.bench = p[15] === '1';
-
-      // BENCH 模式也记录完整 run（用于静态阶跃实验）
-      if (!runActive && state.bench && !prevBench) {
-        startRun();
-      }
-      if (!runActive && !state.bench && !state.diag && !state.fallen && (prevDiag || prevFallen)) {
-        startRun();
-      }
-
-      // BENCH 退出时结束 run
-      if (runActive && prevBench && !state.bench) {
-        pendingCloseReason = 'BENCH_STOP';
-      }
-      // 平衡 run 的结束条件（不含 BENCH）
-      if (runActive && !state.bench && (state.fallen || state.diag) && !(prevDiag && state.diag)) {
-        pendingCloseReason = state.fallen ? 'FALLEN' : 'STOP';
-      }
-      prevDiag = state.diag;
-      prevFallen = state.fallen;
-      prevBench = state.bench;
-
-      pushChart(chartAngle, [state.pitch, state.target, state.roll]);
-      pushChart(chartCtrl, [state.pid, state.gyro, state.speed]);
-      pushChart(chartMotor, [state.cmdR, state.cmdL, state.actR, state.actL, state.curR, state.curL]);
-
-      updateIndicators();
-
-    } else if (d.startsWith('T,')) {
-      const p = d.split(',');
-      const sample = {
-        ms: parseInt(p[1]),
-        pitch: parseFloat(p[2]),
-        target: parseFloat(p[3]),
-        gyro: parseFloat(p[4]),
-        pid: parseFloat(p[5]),
-        cmdR: parseInt(p[6]),
-        cmdL: parseInt(p[7]),
-        actR: parseInt(p[8]),
-        actL: parseInt(p[9]),
-        speed: parseFloat(p[10]),
-        dist: parseFloat(p[11]),
-        vinR: parseFloat(p[12]),
-        vinL: parseFloat(p[13]),
-        curR: parseFloat(p[14]),
-        curL: parseFloat(p[15]),
-        tmpR: parseFloat(p[16]),
-        tmpL: parseFloat(p[17]),
-        fallen: p[18] === '1',
-        diag: p[19] === '1',
-        ctrlDt: p[20] ? parseFloat(p[20]) : 0,
-        uRaw: p[21] ? parseFloat(p[21]) : 0,
-        uClamp: p[22] ? parseFloat(p[22]) : 0,
-        uDz: p[23] ? parseFloat(p[23]) : 0,
-        uSendR: p[24] ? parseInt(p[24]) : 0,
-        uSendL: p[25] ? parseInt(p[25]) : 0,
-        bench: p[26] === '1'
-      };
-      state.vinR = sample.vinR;
-      state.vinL = sample.vinL;
-      state.curR = sample.curR;
-      state.curL = sample.curL;
-      state.tmpR = sample.tmpR;
-      state.tmpL = sample.tmpL;
-      state.bench = sample.bench;
-      addTableRow(sample);
-
-      // 先写入最后一个采样点，再结束本次闭环，避免终点样本丢失
-      if (runActive && pendingCloseReason && (sample.fallen || sample.diag)) {
-        closeRun(pendingCloseReason, sample.ms);
-      }
-      updateIndicators();
-
-    } else if (d.startsWith('M,')) {
-      const p = d.split(',');
-      state.cmdR = parseInt(p[1]);
-      state.cmdL = parseInt(p[2]);
-      state.actR = parseInt(p[3]);
-      state.actL = parseInt(p[4]);
-      state.vinR = parseFloat(p[5]);
-      state.vinL = parseFloat(p[6]);
-      state.curR = parseFloat(p[7]);
-      state.curL = parseFloat(p[8]);
-      state.tmpR = parseFloat(p[9]);
-      state.tmpL = parseFloat(p[10]);
-
-      const vAvg = (state.vinR + state.vinL) * 0.5;
-      document.getElementById('bat-st').textContent = `${fmt(vAvg,2)} V`;
-      document.getElementById('bat-st').className = vAvg < 10 ? 'badge err' : 'badge';
-      updateIndicators();
-
-    } else if (d.startsWith('P,')) {
-      const p = d.split(',');
-      updatePidUI(p[1], p[2], p[3]);
-
-    } else if (d.startsWith('AT,')) {
-      handleAutoTune(d);
-
-    } else if (d.startsWith('C,')) {
-      const p = d.split(',');
-      document.getElementById('kpi-weight').textContent = `${p[1]} g`;
-      document.getElementById('kpi-wheel').textContent = `${p[2]} mm`;
-    }
-  };
-}
-
-function send(msg) {
-  if (ws && ws.readyState === 1) ws.send(msg);
-}
-
-
-const rp = document.getElementById('rp');
-const ri = document.getElementById('ri');
-const rd = document.getElementById('rd');
-const vp = document.getElementById('vp');
-const vi = document.getElementById('vi');
-const vd = document.getElementById('vd');
-
-function updatePidUI(p, i, d) {
-  rp.value = p; vp.textContent = parseFloat(p).toFixed(1);
-  ri.value = i; vi.textContent = parseFloat(i).toFixed(1);
-  rd.value = d; vd.textContent = parseFloat(d).toFixed(2);
-  document.getElementById('k-val').textContent = `${parseFloat(p).toFixed(1)}, ${parseFloat(i).toFixed(1)}, ${parseFloat(d).toFixed(2)}`;
-}
-
-function onPidChange() {
-  vp.textContent = parseFloat(rp.value).toFixed(1);
-  vi.textContent = parseFloat(ri.value).toFixed(1);
-  vd.textContent = parseFloat(rd.value).toFixed(2);
-  send(`P,${rp.value},${ri.value},${rd.value}`);
-}
-rp.oninput = ri.oninput = rd.oninput = onPidChange;
-
-const keys = { w:0, a:0, s:0, d:0 };
-const keyMap = {
-  'w':'w', 'a':'a', 's':'s', 'd':'d',
-  'ArrowUp':'w', 'ArrowDown':'s', 'ArrowLeft':'a', 'ArrowRight':'d'
-};
-
-function updateKeys() {
-  let x = 0, y = 0;
-  if (keys.w) y += 1;
-  if (keys.s) y -= 1;
-  if (keys.a) x -= 1;
-  if (keys.d) x += 1;
-
-  document.getElementById('k-w').className = 'key w' + (keys.w ? ' active' : '');
-  document.getElementById('k-s').className = 'key s' + (keys.s ? ' active' : '');
-  document.getElementById('k-a').className = 'key a' + (keys.a ? ' active' : '');
-  document.getElementById('k-d').className = 'key d' + (keys.d ? ' active' : '');
-
-  const joyX = x * 60;
-  const joyY = y * 80;
-  document.getElementById('t-val').textContent = `${(joyY * 4.0 / 100.0).toFixed(2)}°`;
-  send(`J,${joyX},${joyY}`);
-}
-
-window.addEventListener('keydown', (e) => {
-  const k = keyMap[e.key] || keyMap[e.key.toLowerCase()];
-  if (k) {
-    if (!keys[k]) {
-      keys[k] = 1;
-      updateKeys();
-    }
-  } else if (e.key === 'q' || e.key === 'Q') {
-    send('S');
-  } else if (e.key === 'e' || e.key === 'E' || e.code === 'Space') {
-    send('E');
-  }
-});
-
-window.addEventListener('keyup', (e) => {
-  const k = keyMap[e.key] || keyMap[e.key.toLowerCase()];
-  if (k) {
-    keys[k] = 0;
-    updateKeys();
-  }
-});
-
-let autoTuning = false;
-
-function toggleAutoTune() {
-  if (autoTuning) {
-    send('AX');
-  } else {
-    if (!confirm('开始自动调参？机器人将自动反复启停约5-10分钟。')) return;
-    send('AT');
-  }
-}
-
-function handleAutoTune(d) {
-  // AT,phase,curVal,trial/total,bestVal,bestMedian,done/total,status
-  const p = d.substring(3).split(',');
-  const phase = p[0];
-  const curVal = p[1];
-  const trial = p[2];
-  const bestVal = p[3];
-  const bestMedian = p[4];
-  const progress = p[5];
-  const status = p[6] || '';
-
-  const panel = document.getElementById('at-panel');
-  const btn = document.getElementById('at-btn');
-
-  if (status === 'DONE' || status === 'STOP') {
-    autoTuning = false;
-    btn.textContent = '自动调参';
-    btn.className = 'btn cal';
-    if (status === 'DONE') {
-      panel.style.display = '';
-      document.getElementById('at-phase').textContent = '完成!';
-      document.getElementById('at-cur').textContent = '--';
-      document.getElementById('at-trial').textContent = '--';
-      document.getElementById('at-bar').style.width = '100%';
-      addAtLog('调参完成: Kp=' + parseFloat(rp.value).toFixed(1) + ' Kd=' + parseFloat(rd.value).toFixed(2));
-    } else {
-      addAtLog('已手动停止');
-    }
-    return;
-  }
-
-  autoTuning = true;
-  btn.textContent = '停止调参';
-  btn.className = 'btn stop';
-  panel.style.display = '';
-
-  const phaseMap = { 'Kp': 'Kp 粗调', 'Kd': 'Kd 粗调', 'Kp*': 'Kp 精调', 'Grid': '网格搜索' };
-  document.getElementById('at-phase').textContent = phaseMap[phase] || phase;
-  document.getElementById('at-cur').textContent = curVal;
-  document.getElementById('at-trial').textContent = trial;
-  document.getElementById('at-best').textContent = bestVal;
-  document.getElementById('at-score').textContent = bestMedian + 'ms';
-  document.getElementById('at-prog').textContent = progress;
-
-  const progParts = progress.split('/');
-  if (progParts.length === 2) {
-    const pct = Math.min(100, (parseInt(progParts[0]) / parseInt(progParts[1])) * 100);
-    document.getElementById('at-bar').style.width = pct + '%';
-  }
-
-  if (status.startsWith('=')) {
-    addAtLog(phase + status);
-  }
-}
-
-function addAtLog(text) {
-  const log = document.getElementById('at-log');
-  const line = document.createElement('div');
-  line.textContent = text;
-  log.appendChild(line);
-  log.scrollTop = log.scrollHeight;
-}
-
-connect();
-</script>
-</body>
-</html>
-)rawliteral";
@@ -1,5 +1,10 @@
 #pragma once
+/**
+ * web_ui_page.h — 内置控制页面 (gzip, 由 tools/gen_web_ui.py 从 web_ui/index.html 生成)
+ */
 
 #include <Arduino.h>
 
-extern const char WEB_INDEX_HTML[] PROGMEM;
+extern const char    WEB_INDEX_ETAG[];   // 含引号, 可直接用作 ETag 头
+extern const size_t  WEB_INDEX_GZ_LEN;
+extern const uint8_t WEB_INDEX_GZ[] PROGMEM;
@@ -0,0 +1,193 @@
+#!/usr/bin/env python3
+"""
+drive_test.py — 轨迹跟踪驾驶测试 (主机端)
+
+连接机器人 WebSocket (端口 81), 把预设路径或脚本下发到固件轨迹队列
+(motion_control.cpp), TG 开始执行, 接收 TE 跟踪误差采样直到 TE,END,
+打印沿程/横向/航向/速度 RMS。路径超过队列长度时按 TE 采样中的队列余量流式追加。
+
+命令 (固件侧):
+  TV,tMs,v,w     定时点: 段内时间 ms, 线速度 mm/s, 角速度 °/s (段内线性插值)
+  TW,x,y,v       航点: TG 时位姿为原点, x 沿 linearSpeed 正方向 mm, 巡航速度 mm/s
+  TG / TX        开始 / 中止并清空
+
+预设路径 (--pattern):
+  line     直线往返              square   正方形航点 (--size 边长)
+  circle   绕圆 (--size 半径)     figure8  两个反向圆
+  slalom   正弦角速度蛇行
+
+脚本文件 (--script) 每行一条 TV/TW 命令, # 开头为注释。
+--repeat N 连续跑 N 次 (闭合路径回到起点), 最后给出各项 RMS 的均值, 便于比较控制参数。
+
+依赖: websocket-client
+用法: python3 tools/drive_test.py 192.168.1.50 --pattern square --size 600 --speed 250
+      python3 tools/drive_test.py 192.168.1.50 --script path.txt --csv run.csv
+"""
+
+import argparse
+import math
+import os
+import re
+import sys
+import time
+
+import websocket
+
+CONFIG_H = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "sketch_feb13a", "config.h")
+TE_FIELDS = ["seq", "t_ms", "x", "y", "psi", "xr", "yr", "psir", "along", "cross", "e_psi", "v_ref", "v", "queued"]
+END_FIELDS = ["reason", "dur_ms", "n", "rms_along", "rms_cross", "rms_psi", "max_cross", "rms_v"]
+
+
+def queue_len(path):
+    pat = re.compile(r"^#define\s+MC_QUEUE_LEN\s+(\d+)")
+    with open(path, encoding="utf-8") as f:
+        for line in f:
+            m = pat.match(line)
+            if m:
+                return int(m.group(1))
+    sys.exit("config.h 缺少 MC_QUEUE_LEN")
+
+
+def timed(points):
+    return [f"TV,{int(round(t))},{v:.0f},{w:.1f}" for t, v, w in points]
+
+
+def pattern_cmds(name, speed, size, ramp_ms=500):
+    if name == "line":
+        cruise = size / speed * 1000.0
+        pts = []
+        t = 0.0
+        for v in (speed, -speed):
+            pts += [(t, 0, 0), (t + ramp_ms, v, 0), (t + ramp_ms + cruise, v, 0), (t + 2 * ramp_ms + cruise, 0, 0)]
+            t += 2 * ramp_ms + cruise + 500
+        return timed(pts)
+    if name == "square":
+        return [f"TW,{x:.0f},{y:.0f},{speed:.0f}" for x, y in ((size, 0), (size, size), (0, size), (0, 0))]
+    if name in ("circle", "figure8"):
+        w = math.degrees(speed / size)
+        lap = 360.0 / w * 1000.0
+        pts = [(0, 0, 0)]
+        t = 0.0
+        for sign in ((1,) if name == "circle" else (1, -1)):
+            pts += [(t + ramp_ms, speed, sign * w), (t + ramp_ms + lap, speed, sign * w)]
+            t += lap
+        pts.append((t + 2 * ramp_ms, 0, 0))
+        return timed(pts)
+    if name == "slalom":
+        period_ms, amp, n = 2000.0, 60.0, 4
+        pts = [(0, 0, 0), (ramp_ms, speed, 0)]
+        for k in range(1, int(n * period_ms / 100) + 1):
+            t = ramp_ms + k * 100.0
+            pts.append((t, speed, amp * math.sin(2 * math.pi * k * 100.0 / period_ms)))
+        pts.append((pts[-1][0] + ramp_ms, 0, 0))
+        return timed(pts)
+    sys.exit(f"未知路径 {name}")
+
+
+def script_cmds(path):
+    cmds = []
+    with open(path, encoding="utf-8") as f:
+        for line in f:
+            line = line.strip()
+            if not line or line.startswith("#"):
+                continue
+            if not (line.startswith("TV,") or line.startswith("TW,")):
+                sys.exit(f"脚本只接受 TV/TW 命令: {line}")
+            cmds.append(line)
+    return cmds
+
+
+def run_once(ws, cmds, qlen, timeout_s):
+    """下发并执行一次, 返回 (采样列表, 结束统计)。"""
+    ws.send("TX")
+    pending = list(cmds)
+    first = min(len(pending), qlen)
+    for c in pending[:first]:
+        ws.send(c)
+    pending = pending[first:]
+    ws.send("TG")
+
+    samples = []
+    deadline = time.time() + timeout_s
+    while time.time() < deadline:
+        try:
+            op, data = ws.recv_data()
+        except websocket.WebSocketTimeoutException:
+            continue
+        if op != websocket.ABNF.OPCODE_TEXT:
+            continue
+        text = data.decode("utf-8", "replace")
+        if text.startswith("ERR,T"):
+            ws.send("TX")
+            raise SystemExit(f"robot rejected command: {text}")
+        if not text.startswith("TE,"):
+            continue
+        p = text.split(",")
+        if p[1] == "END":
+            end = dict(zip(END_FIELDS, [p[2]] + [float(x) for x in p[3:]]))
+            return samples, end
+        s = dict(zip(TE_FIELDS, (float(x) for x in p[1:])))
+        samples.append(s)
+        # 流式追加: 只补到半队, 上一批可能尚未计入本次采样的队列长度
+        room = qlen // 2 - int(s["queued"])
+        for c in pending[:max(0, room)]:
+            ws.send(c)
+        pending = pending[max(0, room):]
+    ws.send("TX")
+    raise SystemExit("timeout waiting for TE,END")
+
+
+def write_csv(path, runs):
+    with open(path, "w") as f:
+        f.write("run," + ",".join(TE_FIELDS) + "\n")
+        for i, (samples, _) in enumerate(runs):
+            for s in samples:
+                f.write(f"{i}," + ",".join(f"{s[k]:g}" for k in TE_FIELDS) + "\n")
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("host")
+    src = ap.add_mutually_exclusive_group()
+    src.add_argument("--pattern", default="square", choices=["line", "square", "circle", "figure8", "slalom"])
+    src.add_argument("--script", help="TV/TW 命令脚本")
+    ap.add_argument("--speed", type=float, default=200.0, help="巡航速度 mm/s")
+    ap.add_argument("--size", type=float, default=500.0, help="边长 / 半径 / 直线长度 mm")
+    ap.add_argument("--repeat", type=int, default=1)
+    ap.add_argument("--csv", help="保存 TE 采样")
+    ap.add_argument("--timeout", type=float, default=120.0, help="单次运行超时 (s)")
+    ap.add_argument("--config", default=CONFIG_H)
+    args = ap.parse_args()
+
+    cmds = script_cmds(args.script) if args.script else pattern_cmds(args.pattern, args.speed, args.size)
+    qlen = queue_len(args.config)
+    print(f"{len(cmds)} commands, queue {qlen}", file=sys.stderr)
+
+    ws = websocket.create_connection(f"ws://{args.host}:81/", timeout=5)
+    runs = []
+    try:
+        for i in range(args.repeat):
+            samples, end = run_once(ws, cmds, qlen, args.timeout)
+            runs.append((samples, end))
+            print(f"run {i}: {end['reason']:4s} {end['dur_ms'] / 1000:6.1f}s  "
+                  f"rms along {end['rms_along']:6.1f}mm  cross {end['rms_cross']:6.1f}mm  "
+                  f"psi {end['rms_psi']:5.2f}°  v {end['rms_v']:6.1f}mm/s  max cross {end['max_cross']:6.1f}mm")
+            if end["reason"] != "DONE":
+                break
+            time.sleep(1.0)
+    finally:
+        ws.close()
+
+    if args.csv:
+        write_csv(args.csv, runs)
+        print(f"written {args.csv}", file=sys.stderr)
+    done = [e for _, e in runs if e["reason"] == "DONE"]
+    if len(done) > 1:
+        mean = {k: sum(e[k] for e in done) / len(done) for k in ("rms_along", "rms_cross", "rms_psi", "rms_v")}
+        print(f"mean of {len(done)}: along {mean['rms_along']:.1f}mm  cross {mean['rms_cross']:.1f}mm  "
+              f"psi {mean['rms_psi']:.2f}°  v {mean['rms_v']:.1f}mm/s")
+    sys.exit(0 if len(done) == len(runs) == args.repeat else 1)
+
+
+if __name__ == "__main__":
+    main()
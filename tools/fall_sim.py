@@ -0,0 +1,234 @@
+#!/usr/bin/env python3
+"""
+fall_sim.py — 跌倒预测离线验证: 倒立摆仿真对比旧角度判据与相平面预测 (无需硬件)
+
+模型与固件一致, 参数读 sketch_feb13a/config.h:
+  θ'' = ω0²·(θ - I/G)              G = PEND_GRAVITY_MA_PER_DEG, ω0 = 真实固有频率 (--omega0)
+  I   = 指令电流经一拍延迟 + 一阶滞后 (--motor-tau-ms), 限幅 --limit-ma (默认 CURRENT_MODE_LIMIT_MA)
+  指令 = (Kp·θ + Kd·gyroLPF)·CURRENT_MODE_GAIN_MA_PER_RPM, 500Hz
+  支架 前 -13° / 后 +15°: 触及时记录冲击角速度, 之后停在支架上 (控制器继续出力)
+
+扰动: 静止起步后施加一段角速度冲击 (推一下), 幅度从小到大扫描, 正反两个方向。
+每个扰动跑两遍: 只用旧判据 (|θ| > FALL_ANGLE 连续 FALL_CONFIRM_COUNT 拍) / 加上预测器。
+
+输出:
+  误判    旧判据下能站稳, 预测器却判定跌倒的次数 (必须为 0)
+  漏判    旧判据判定跌倒而预测器没有提前判定的次数
+  提前量  预测判定比旧判据确认提前的时间 (向前倒停在支架上的单独计数)
+  浪费电流 从预测判定时刻起到断电为止的 ∫|I|dt (A·s), 旧判据 vs 预测斜坡
+  断电阶跃 切断时刻的电流 (mA): 旧判据从饱和电流直接切 0, 预测器斜坡后切
+  冲击    触及支架时的角速度 (°/s)
+
+    python3 tools/fall_sim.py
+    python3 tools/fall_sim.py --omega0 13.5 --latency-ms 8      # 模型失配时的鲁棒性
+    python3 tools/fall_sim.py --limit-ma 400                    # 热限流/电源预算收紧后
+"""
+
+import argparse
+import os
+import re
+import sys
+
+CONFIG_H = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "sketch_feb13a", "config.h")
+DT = 0.002
+STAND_FWD, STAND_BACK = -13.0, 15.0
+
+
+def load_config(path):
+    vals = {}
+    pat = re.compile(r"^#define\s+(\w+)\s+\(?\s*([-0-9.]+)f?\s*\)?")
+    with open(path, encoding="utf-8") as f:
+        for line in f:
+            m = pat.match(line)
+            if m:
+                try:
+                    vals[m.group(1)] = float(m.group(2))
+                except ValueError:
+                    pass
+    return vals
+
+
+class Predictor:
+    """fall_predict.cpp 的逐行移植。"""
+
+    def __init__(self, c):
+        self.c = c
+        self.sat = 0.0
+        self.outside = 0
+        self.deep = 0
+        self.ramp_t = None
+        self.margin = 0.0
+
+    def update(self, t, pitch, rate, cmd_ma, limit_ma):
+        c = self.c
+        if self.ramp_t is not None:
+            k = 1.0 - (t - self.ramp_t) * 1000.0 / c["FP_RAMP_MS"]
+            return max(k, 0.0)
+        self.sat += ((1.0 if cmd_ma >= limit_ma * c["FP_SAT_LEVEL"] else 0.0) - self.sat) * c["FP_SAT_ALPHA"]
+        theta_s = limit_ma / c["PEND_GRAVITY_MA_PER_DEG"]
+        x = pitch + rate * (1.0 / c["PEND_OMEGA0"] + c["FP_LATENCY_S"])
+        self.margin = theta_s - abs(x)
+        self.outside = self.outside + 1 if self.margin < -c["FP_MARGIN_SOFT_DEG"] else 0
+        self.deep = self.deep + 1 if self.margin < -c["FP_MARGIN_HARD_DEG"] else 0
+        soft = self.outside >= c["FP_CONFIRM_TICKS"] and self.sat >= c["FP_SAT_MIN"]
+        hard = self.deep >= c["FP_CONFIRM_TICKS"]
+        if soft or hard:
+            self.ramp_t = t
+        return 1.0
+
+
+def run(c, args, kick_dps, kick_ms, use_fp, charge_from=0.0):
+    kp, kd = c["DEFAULT_KP"], c["DEFAULT_KD"]
+    gain, lim = c["CURRENT_MODE_GAIN_MA_PER_RPM"], args.limit_ma
+    g_ma = c["PEND_GRAVITY_MA_PER_DEG"]
+    w2 = args.omega0 ** 2
+    delay_n = max(1, int(round(args.latency_ms / 1000.0 / DT)))
+    alpha_m = DT / (args.motor_tau_ms / 1000.0 + DT)
+
+    theta, omega, gyro_f, cur = args.theta0, 0.0, 0.0, 0.0
+    queue = [0.0] * delay_n
+    fp = Predictor(c) if use_fp else None
+    confirm = 0
+    res = {"fallen_t": None, "predict_t": None, "impact": None, "charge": 0.0, "cut_ma": None}
+    t = 0.0
+    while t < args.seconds:
+        # 传感与控制 (与 balanceControl 同顺序)
+        gyro_f = c["GYRO_LPF_ALPHA"] * gyro_f + (1 - c["GYRO_LPF_ALPHA"]) * omega
+        cmd = 0.0
+        if res["fallen_t"] is None:
+            # 斜坡期间旧判据仍有效, 先成立者断电
+            confirm = confirm + 1 if abs(theta) > c["FALL_ANGLE"] else 0
+            if confirm >= c["FALL_CONFIRM_COUNT"]:
+                res["fallen_t"] = t
+                res["cut_ma"] = abs(cur)
+            else:
+                out = max(-c["OUTPUT_LIMIT"], min(c["OUTPUT_LIMIT"], kp * theta + kd * gyro_f))
+                if fp:
+                    k = fp.update(t, theta, gyro_f, abs(out) * gain, lim)
+                    if fp.ramp_t is not None and res["predict_t"] is None:
+                        res["predict_t"] = t
+                    if k <= 0:
+                        res["fallen_t"] = t
+                        res["cut_ma"] = abs(cur)
+                    if k < 1.0:
+                        # 与 balanceControl 相同: 先限到电流上限再缩放
+                        out_lim = lim / gain
+                        out = max(-out_lim, min(out_lim, out)) * k
+                cmd = max(-lim, min(lim, out * gain)) if res["fallen_t"] is None else 0.0
+
+        # 执行器: 延迟 + 一阶滞后
+        queue.append(cmd)
+        cur += (queue.pop(0) - cur) * alpha_m
+
+        # 动力学 (扰动: 前 kick_ms 内施加角加速度, 积分后约为 kick_dps 的角速度冲击)
+        acc = w2 * (theta - cur / g_ma)
+        if t < kick_ms / 1000.0:
+            acc += kick_dps / (kick_ms / 1000.0)
+        omega += acc * DT
+        theta += omega * DT
+        if t >= charge_from:
+            res["charge"] += abs(cur) * DT
+        t += DT
+
+        # 支架: 触及后停在限位上 (控制器若未判定跌倒会继续顶着支架出力)
+        if theta <= STAND_FWD or theta >= STAND_BACK:
+            if res["impact"] is None:
+                res["impact"] = abs(omega)
+            theta = max(STAND_FWD, min(STAND_BACK, theta))
+            omega = 0.0
+    res["end_theta"] = theta
+    res["end_cur"] = cur
+    return res
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("--config", default=CONFIG_H)
+    ap.add_argument("--omega0", type=float, default=None, help="真实固有频率 rad/s (默认 = PEND_OMEGA0)")
+    ap.add_argument("--latency-ms", type=float, default=4.0, help="指令到电流开始变化的延迟")
+    ap.add_argument("--motor-tau-ms", type=float, default=3.0, help="电流环一阶时间常数")
+    ap.add_argument("--limit-ma", type=float, default=None,
+                    help="电流上限 (默认 CURRENT_MODE_LIMIT_MA; 热限流/电源预算收紧时更低)")
+    ap.add_argument("--theta0", type=float, default=0.0)
+    ap.add_argument("--seconds", type=float, default=2.0)
+    ap.add_argument("--kick-ms", type=float, default=20.0)
+    ap.add_argument("--kick-max", type=float, default=1200.0, help="扫描的最大冲击角速度 °/s")
+    ap.add_argument("--kick-step", type=float, default=10.0)
+    ap.add_argument("-v", "--verbose", action="store_true")
+    args = ap.parse_args()
+
+    c = load_config(args.config)
+    if args.omega0 is None:
+        args.omega0 = c["PEND_OMEGA0"]
+    if args.limit_ma is None:
+        args.limit_ma = c["CURRENT_MODE_LIMIT_MA"]
+
+    false_pos, missed, falls = 0, 0, 0
+    leads, waste_old, waste_fp, imp_old, imp_fp = [], [], [], [], []
+    old_cut, fp_cut, stuck = [], [], 0
+    k = args.kick_step
+    kicks = []
+    while k <= args.kick_max:
+        kicks += [k, -k]
+        k += args.kick_step
+
+    for kick in kicks:
+        a = run(c, args, kick, args.kick_ms, False)
+        b = run(c, args, kick, args.kick_ms, True)
+        old_fell = a["fallen_t"] is not None or a["impact"] is not None
+        if not old_fell:
+            if b["predict_t"] is not None:
+                false_pos += 1
+                print(f"  误判: kick {kick:+.0f}°/s 旧判据下站稳, 预测器在 {b['predict_t'] * 1000:.0f}ms 判定")
+            continue
+        falls += 1
+        if b["predict_t"] is None:
+            missed += 1
+            if args.verbose:
+                print(f"  未提前: kick {kick:+.0f}°/s")
+            continue
+        # 向前倒停在 -13° 支架上永远到不了 FALL_ANGLE: 旧判据顶着支架出力到仿真结束,
+        # 不计入提前量, 单独计数 (浪费电流按整个仿真窗口算)
+        t_p = b["predict_t"]
+        if a["fallen_t"] is not None:
+            leads.append((a["fallen_t"] - t_p) * 1000.0)
+        else:
+            stuck += 1
+        # 断电时的电流阶跃: 旧判据在确认时刻从当前电流直接切到 0 (卡在支架上则一直顶着)
+        old_cut.append(a["cut_ma"] if a["cut_ma"] is not None else abs(a["end_cur"]))
+        fp_cut.append(b["cut_ma"] or 0.0)
+        # 浪费电流: 从预测判定时刻起的 ∫|I|dt
+        ra = run(c, args, kick, args.kick_ms, False, t_p)["charge"] / 1000.0
+        rb = run(c, args, kick, args.kick_ms, True, t_p)["charge"] / 1000.0
+        waste_old.append(ra)
+        waste_fp.append(rb)
+        if a["impact"] is not None:
+            imp_old.append(a["impact"])
+        if b["impact"] is not None:
+            imp_fp.append(b["impact"])
+        if args.verbose:
+            lead = f"{(a['fallen_t'] - t_p) * 1000.0:6.0f}ms" if a["fallen_t"] is not None else "  支架上"
+            print(f"  kick {kick:+5.0f}°/s  提前 {lead}  浪费 {ra:6.3f} → {rb:6.3f} A·s  "
+                  f"断电阶跃 {old_cut[-1]:5.0f} → {fp_cut[-1]:4.0f} mA  "
+                  f"冲击 {a['impact'] or 0:4.0f} → {b['impact'] or 0:4.0f} °/s")
+
+    def avg(xs):
+        return sum(xs) / len(xs) if xs else float("nan")
+
+    print(f"ω0={args.omega0:.1f}rad/s (预测器 {c['PEND_OMEGA0']:.1f})  延迟 {args.latency_ms:.0f}ms  "
+          f"上限 {args.limit_ma:.0f}mA  "
+          f"扰动 {len(kicks)} 个, 跌倒 {falls}")
+    print(f"误判 {false_pos}   未提前判定 {missed}/{falls}")
+    if leads:
+        print(f"提前量   min {min(leads):6.0f}  avg {avg(leads):6.0f}  max {max(leads):6.0f} ms"
+              f"   (另有 {stuck} 次旧判据停在支架上一直出力)")
+    if waste_old:
+        print(f"浪费电流 旧 {avg(waste_old):6.3f}  →  预测 {avg(waste_fp):6.3f} A·s (平均, 单电机)")
+        print(f"断电阶跃 旧 {avg(old_cut):6.0f}  →  预测 {avg(fp_cut):6.0f} mA (平均)")
+    if imp_old or imp_fp:
+        print(f"支架冲击 旧 {avg(imp_old):6.0f}  →  预测 {avg(imp_fp):6.0f} °/s (平均)")
+    sys.exit(1 if false_pos else 0)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,47 @@
+#!/usr/bin/env python3
+"""
+gen_web_ui.py — 把 sketch_feb13a/web_ui/index.html 压缩成固件内置页面
+
+输出 sketch_feb13a/web_ui_page.cpp: gzip 字节数组 (PROGMEM) + ETag (内容哈希)。
+修改页面后运行一次再编译固件:
+
+    python3 tools/gen_web_ui.py
+
+gzip 头的 mtime 固定为 0, 同一页面总是生成同一字节序列 (ETag 稳定, 便于 diff)。
+"""
+
+import gzip
+import hashlib
+import os
+import sys
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "sketch_feb13a")
+SRC = os.path.join(ROOT, "web_ui", "index.html")
+OUT = os.path.join(ROOT, "web_ui_page.cpp")
+
+
+def main():
+    with open(SRC, "rb") as f:
+        html = f.read()
+    gz = gzip.compress(html, compresslevel=9, mtime=0)
+    etag = hashlib.sha256(html).hexdigest()[:16]
+
+    lines = [
+        "// 由 tools/gen_web_ui.py 从 web_ui/index.html 生成, 请勿手改",
+        f"// 原始 {len(html)} 字节 → gzip {len(gz)} 字节",
+        "#include \"web_ui_page.h\"",
+        "",
+        f"const char WEB_INDEX_ETAG[] = \"\\\"{etag}\\\"\";",
+        f"const size_t WEB_INDEX_GZ_LEN = {len(gz)};",
+        "const uint8_t WEB_INDEX_GZ[] PROGMEM = {",
+    ]
+    for i in range(0, len(gz), 16):
+        lines.append("  " + ", ".join(f"0x{b:02x}" for b in gz[i:i + 16]) + ",")
+    lines.append("};")
+    with open(OUT, "w", newline="\n") as f:
+        f.write("\n".join(lines) + "\n")
+    print(f"{os.path.relpath(OUT)}: {len(html)} -> {len(gz)} bytes, ETag {etag}", file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
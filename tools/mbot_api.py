@@ -0,0 +1,88 @@
+#!/usr/bin/env python3
+"""
+mbot_api.py — 平衡车 HTTP JSON 接口客户端 (接口见 sketch_feb13a/web_control.cpp)
+
+    python3 tools/mbot_api.py 192.168.1.50 status
+    python3 tools/mbot_api.py 192.168.1.50 192.168.1.51 params Kp,Kd
+    python3 tools/mbot_api.py 192.168.1.5{0,1,2} set Kp=18 Kd=1.5
+    python3 tools/mbot_api.py 192.168.1.50 regs speedKp,speedKi,speedKd,speedMaxCur
+    python3 tools/mbot_api.py 192.168.1.50 diag
+    python3 tools/mbot_api.py 192.168.1.50 cmd G,150000,100000,0
+
+多台机器依次请求, 输出每台一行 JSON (便于 jq / 脚本处理)。仅依赖标准库。
+寄存器读取来自机器人侧快照 (ageMs 为快照年龄), 不会在平衡期触发阻塞 CAN 读。
+"""
+
+import argparse
+import json
+import sys
+import urllib.error
+import urllib.parse
+import urllib.request
+
+
+def request(host, path, query=None, form=None, timeout=3.0):
+    url = f"http://{host}{path}"
+    if query:
+        url += "?" + urllib.parse.urlencode(query)
+    data = urllib.parse.urlencode(form).encode() if form is not None else None
+    try:
+        with urllib.request.urlopen(url, data=data, timeout=timeout) as r:
+            return json.loads(r.read())
+    except urllib.error.HTTPError as e:
+        try:
+            return json.loads(e.read())
+        except ValueError:
+            return {"ok": False, "error": f"http {e.code}"}
+    except (urllib.error.URLError, OSError) as e:
+        return {"ok": False, "error": str(e)}
+
+
+def run(host, args):
+    if args.action == "status":
+        return request(host, "/api/status")
+    if args.action == "diag":
+        return request(host, "/api/diag")
+    if args.action == "params":
+        return request(host, "/api/params", {"names": args.items[0]} if args.items else None)
+    if args.action == "regs":
+        q = {}
+        if args.items:
+            q["reg"] = args.items[0]
+        if args.motor:
+            q["motor"] = args.motor
+        return request(host, "/api/registers", q)
+    if args.action == "set":
+        form = dict(item.split("=", 1) for item in args.items)
+        return request(host, "/api/params", form=form)
+    if args.action == "cmd":
+        return request(host, "/api/cmd", form={"c": ",".join(args.items)})
+    raise ValueError(args.action)
+
+
+def main():
+    ap = argparse.ArgumentParser(description="平衡车 HTTP 接口 (多机批量)")
+    ap.add_argument("hosts", nargs="+", help="机器人 IP (可多个), 之后为动作")
+    ap.add_argument("--motor", choices=["R", "L"], help="regs: 只取一侧电机")
+    argv = sys.argv[1:]
+    actions = ("status", "params", "regs", "set", "diag", "cmd")
+    split = next((i for i, a in enumerate(argv) if a in actions), None)
+    if split is None:
+        ap.error(f"需要动作: {', '.join(actions)}")
+    args = ap.parse_args(argv[:split])
+    args.action = argv[split]
+    args.items = argv[split + 1:]
+    if args.action == "set" and not all("=" in i for i in args.items):
+        ap.error("set 需要 name=value")
+
+    failed = 0
+    for host in args.hosts:
+        res = run(host, args)
+        if res.get("ok") is False:
+            failed += 1
+        print(json.dumps({"host": host, **res}, ensure_ascii=False))
+    sys.exit(1 if failed else 0)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,110 @@
+#!/usr/bin/env python3
+"""
+mbot_udp.py — 平衡车 UDP 低延迟通道客户端库 (协议见 sketch_feb13a/udp_transport.h)
+
+    from mbot_udp import MbotUdp
+    bot = MbotUdp("192.168.1.50")
+    bot.subscribe(10)            # 100Hz 遥测, 需每 <3s 续订 (poll() 自动续订)
+    bot.joystick(0, 40)          # 前进
+    t = bot.poll(0.05)           # 最新遥测 (dict) 或 None
+
+仅依赖标准库。摇杆与遥测都是"最新值"语义: 迟到的旧包直接丢弃。
+"""
+
+import socket
+import struct
+import time
+
+PORT = 4210
+VERSION = 1
+HDR = struct.Struct("<2sBBHI")
+TELEM = struct.Struct("<ffffhhhhffHIB")
+TELEM_FIELDS = ("pitch", "target", "gyro", "pid", "cmdR", "cmdL", "actR", "actL",
+                "linearSpeed", "ctrlDtMs", "joySeq", "joyEchoMs", "flags")
+
+JOY, SUB, PING = 0x01, 0x02, 0x03
+TELEM_T, PONG = 0x81, 0x83
+
+
+def now_ms():
+    return int(time.monotonic() * 1000) & 0xFFFFFFFF
+
+
+class MbotUdp:
+    def __init__(self, host, port=PORT, timeout=0.0):
+        self.addr = (host, port)
+        self.sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        if timeout:
+            self.sock.settimeout(timeout)
+        else:
+            self.sock.setblocking(False)
+        self.seq = 0
+        self.sub_period = 0
+        self.sub_sent = 0.0
+        self.last_telem_seq = None
+        self.telem = None
+        self.pongs = {}
+        self.dropped_stale = 0
+
+    def _send(self, ptype, payload=b"", seq=None, ms=None):
+        if seq is None:
+            self.seq = (self.seq + 1) & 0xFFFF
+            seq = self.seq
+        ms = now_ms() if ms is None else ms
+        self.sock.sendto(HDR.pack(b"MB", VERSION, ptype, seq, ms) + payload, self.addr)
+        return seq, ms
+
+    def joystick(self, x, y):
+        """x: 转向, y: 前后, 范围 -100..100。返回 (seq, clientMs)。"""
+        x = max(-100, min(100, int(x)))
+        y = max(-100, min(100, int(y)))
+        return self._send(JOY, struct.pack("<hh", x, y))
+
+    def subscribe(self, period_ms):
+        self.sub_period = period_ms
+        self.sub_sent = time.monotonic()
+        self._send(SUB, struct.pack("<H", period_ms))
+
+    def ping(self):
+        return self._send(PING)
+
+    def _handle(self, data):
+        if len(data) < HDR.size:
+            return
+        magic, ver, ptype, seq, ms = HDR.unpack_from(data)
+        if magic != b"MB" or ver != VERSION:
+            return
+        body = data[HDR.size:]
+        if ptype == TELEM_T and len(body) >= TELEM.size:
+            if self.last_telem_seq is not None and ((seq - self.last_telem_seq) & 0xFFFF) >= 0x8000:
+                self.dropped_stale += 1
+                return
+            self.last_telem_seq = seq
+            t = dict(zip(TELEM_FIELDS, TELEM.unpack_from(body)))
+            t["seq"], t["robotMs"], t["rxMs"] = seq, ms, now_ms()
+            self.telem = t
+        elif ptype == PONG and len(body) >= 4:
+            self.pongs[seq] = (time.monotonic(), struct.unpack_from("<I", body)[0])
+
+    def poll(self, wait=0.0):
+        """收取所有待处理包, 返回最新遥测 (无新遥测返回 None)。"""
+        if self.sub_period and time.monotonic() - self.sub_sent > 1.0:
+            self.subscribe(self.sub_period)
+        before = self.telem
+        deadline = time.monotonic() + wait
+        while True:
+            try:
+                data, _ = self.sock.recvfrom(256)
+                self._handle(data)
+                continue
+            except (BlockingIOError, socket.timeout):
+                pass
+            if self.telem is not before or time.monotonic() >= deadline:
+                break
+            time.sleep(0.0005)
+        return self.telem if self.telem is not before else None
+
+    def close(self):
+        if self.sub_period:
+            self.subscribe(0)
+        self.sock.close()
@@ -0,0 +1,202 @@
+#!/usr/bin/env python3
+"""
+motor_charact.py — 架空轮电机特性辨识 (主机端)
+
+连接机器人 WebSocket (端口 81), 发送 CH,1 启动固件中的辨识序列
+(motor_charact.cpp), 接收全速率采样块, 拟合每个电机的:
+  - 力矩常数 / 惯量比 Kt/J, 粘滞摩擦 B, 库仑摩擦 Fc (电流扫频 + PRBS 段)
+  - 静摩擦 (起转电流, 电流斜坡段)
+  - 指令→电流响应时延 (PRBS 段互相关)
+  - 内部速度环阶跃上升时间与指令→速度时延 (速度阶跃/扫频段)
+结果写入 charact_<unitId>.json, 可选 --raw 保存原始 CSV。
+
+只有电流与转速可测, 因此 Kt 与 J 不能单独辨识: 默认按手册力矩常数
+(0.065 N·m @ 927mA ≈ 0.070 N·m/A) 换算 J/B/Fc, 也可用 --kt 或 --inertia 指定其一。
+
+依赖: numpy, websocket-client
+用法: python3 tools/motor_charact.py 192.168.1.50 [--raw run.csv] [--kt 0.070]
+"""
+
+import argparse
+import json
+import struct
+import sys
+import time
+
+import numpy as np
+import websocket
+
+SAMPLE_FMT = "<IBBhhhhh"
+SAMPLE_SIZE = struct.calcsize(SAMPLE_FMT)
+FRAME_HDR = 8
+SEG_NAMES = ["CUR_RAMP", "CUR_CHIRP", "CUR_PRBS", "SPD_STEP", "SPD_CHIRP"]
+KT_NOMINAL = 0.065 / 0.927  # N·m/A, RollerCAN 手册 16V 额定点
+RPM_TO_RADS = 2.0 * np.pi / 60.0
+
+
+def capture(host, timeout_s):
+    ws = websocket.create_connection(f"ws://{host}:81/", timeout=5)
+    ws.send("CH,1")
+    meta = {"unit": "unknown", "ctrl_hz": 500, "segments": {}}
+    rows = {}
+    status = None
+    deadline = time.time() + timeout_s
+    while time.time() < deadline:
+        try:
+            op, data = ws.recv_data()
+        except websocket.WebSocketTimeoutException:
+            continue
+        if op == websocket.ABNF.OPCODE_BINARY:
+            if len(data) < FRAME_HDR or data[0] != ord("C"):
+                continue
+            n, first = struct.unpack_from("<HI", data, 2)
+            for i in range(n):
+                rows[first + i] = struct.unpack_from(SAMPLE_FMT, data, FRAME_HDR + i * SAMPLE_SIZE)
+            continue
+        text = data.decode("utf-8", "replace")
+        if not text.startswith("CH,"):
+            continue
+        p = text.split(",")
+        if p[1] == "START":
+            meta["unit"], meta["ctrl_hz"] = p[2], int(p[3])
+            print(f"unit {p[2]}: {p[6]} segments", file=sys.stderr)
+        elif p[1] == "SEG":
+            meta["segments"][int(p[2])] = p[3]
+            print(f"  segment {p[2]} {p[3]}", file=sys.stderr)
+        elif p[1] in ("DONE", "ABORT"):
+            status = p[1]
+            meta["samples"], meta["dropped"], meta["guard_ticks"] = int(p[2]), int(p[3]), int(p[4])
+            break
+    ws.close()
+    if status is None:
+        raise SystemExit("timeout waiting for CH,DONE")
+    if status == "ABORT":
+        raise SystemExit("characterization aborted on the robot")
+    data = np.array([rows[k] for k in sorted(rows)], dtype=np.float64)
+    return meta, data
+
+
+def derivative(t, x, half=5):
+    """中心差分 (±half 个采样), 抑制转速整数量化噪声。"""
+    d = np.full_like(x, np.nan)
+    d[half:-half] = (x[2 * half:] - x[:-2 * half]) / (t[2 * half:] - t[:-2 * half])
+    return d
+
+
+def xcorr_lag(u, y, dt, max_lag):
+    """互相关峰值时延 (抛物线插值到亚采样)。"""
+    u = u - u.mean()
+    y = y - y.mean()
+    lags = np.arange(0, max_lag + 1)
+    c = np.array([np.dot(u[: len(u) - k], y[k:]) for k in lags])
+    k = int(np.argmax(c))
+    frac = 0.0
+    if 0 < k < len(c) - 1:
+        den = c[k - 1] - 2 * c[k] + c[k + 1]
+        if den != 0:
+            frac = 0.5 * (c[k - 1] - c[k + 1]) / den
+    return (k + frac) * dt
+
+
+def fit_motor(t, seg, active, guard, cmd, cur, spd, dt, kt, inertia):
+    res = {}
+    w = spd * RPM_TO_RADS
+    acc = derivative(t, w)
+
+    # ---- 动力学回归: J·dω/dt = Kt·I − B·ω − Fc·sign(ω) ----
+    m = np.isin(seg, [1, 2]) & active & ~guard & np.isfinite(acc) & (np.abs(w) > 0.5)
+    if m.sum() > 50:
+        A = np.column_stack([cur[m] / 1000.0, -w[m], -np.sign(w[m])])
+        (a, b, c), *_ = np.linalg.lstsq(A, acc[m], rcond=None)
+        pred = A @ np.array([a, b, c])
+        r2 = 1.0 - np.var(acc[m] - pred) / np.var(acc[m])
+        if inertia:
+            J = inertia
+            kt = a * J
+        else:
+            J = kt / a
+        res.update({
+            "kt_over_j": a, "kt_nm_per_a": kt, "inertia_kgm2": J,
+            "viscous_nm_per_rads": b * J, "coulomb_nm": c * J, "fit_r2": r2,
+        })
+
+    # ---- 静摩擦: 斜坡段首次起转时的电流 ----
+    breakaway = []
+    for sign in (1, -1):
+        m = (seg == 0) & active & (np.sign(cmd) == sign) & (np.abs(spd) > 3)
+        if m.any():
+            breakaway.append(abs(cur[np.argmax(m)]))
+    if breakaway:
+        i_s = float(np.mean(breakaway)) / 1000.0
+        res["breakaway_ma"] = i_s * 1000.0
+        res["static_friction_nm"] = i_s * res.get("kt_nm_per_a", kt)
+
+    # ---- 指令→电流时延 (PRBS) ----
+    m = (seg == 2) & active
+    if m.sum() > 100:
+        res["current_latency_ms"] = 1000.0 * xcorr_lag(cmd[m], cur[m], dt, int(0.05 / dt))
+
+    # ---- 速度环: 阶跃 63% 上升时间 + 扫频时延 ----
+    m = (seg == 3) & active
+    if m.any():
+        tt, cc, ss = t[m], cmd[m], spd[m]
+        edges = np.nonzero(np.diff(cc) != 0)[0] + 1
+        rises = []
+        for e in edges:
+            step = cc[e] - cc[e - 1]
+            target = ss[e - 1] + 0.63 * step
+            after = np.nonzero((ss[e:] - target) * np.sign(step) >= 0)[0]
+            if after.size:
+                rises.append(tt[e + after[0]] - tt[e])
+        if rises:
+            res["speed_rise_ms"] = 1000.0 * float(np.median(rises))
+    m = (seg == 4) & active
+    if m.sum() > 100:
+        res["speed_latency_ms"] = 1000.0 * xcorr_lag(cmd[m], spd[m], dt, int(0.2 / dt))
+    return res
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("host")
+    ap.add_argument("--raw", help="保存原始采样 CSV")
+    ap.add_argument("--kt", type=float, default=KT_NOMINAL, help="力矩常数 N·m/A (默认按手册)")
+    ap.add_argument("--inertia", type=float, help="已知转动惯量 kg·m², 指定后反推 Kt")
+    ap.add_argument("--timeout", type=float, default=90.0)
+    ap.add_argument("-o", "--output", help="参数文件路径 (默认 charact_<unit>.json)")
+    args = ap.parse_args()
+
+    meta, d = capture(args.host, args.timeout)
+    t = d[:, 0] / 1e6
+    seg = d[:, 1].astype(int) & 0x7F
+    active = (d[:, 1].astype(int) & 0x80) == 0
+    flags = d[:, 2].astype(int)
+    guard = (flags & 0x04) != 0
+    cmd, curR, curL, spdR, spdL = (d[:, i] for i in range(3, 8))
+    dt = 1.0 / meta["ctrl_hz"]
+
+    if args.raw:
+        np.savetxt(args.raw, d, delimiter=",", fmt="%g",
+                   header="t_us,seg,flags,cmd,curR,curL,spdR,spdL", comments="")
+
+    out = {
+        "unit": meta["unit"],
+        "captured": time.strftime("%Y-%m-%dT%H:%M:%S"),
+        "ctrl_hz": meta["ctrl_hz"],
+        "samples": int(len(d)),
+        "dropped": meta["dropped"],
+        "guard_ticks": meta["guard_ticks"],
+        "motors": {
+            "R": fit_motor(t, seg, active, guard, cmd, curR, spdR, dt, args.kt, args.inertia),
+            "L": fit_motor(t, seg, active, guard, cmd, curL, spdL, dt, args.kt, args.inertia),
+        },
+    }
+    path = args.output or f"charact_{meta['unit']}.json"
+    with open(path, "w") as f:
+        json.dump(out, f, indent=2, default=float)
+    print(json.dumps(out["motors"], indent=2, default=float))
+    print(f"written {path}", file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
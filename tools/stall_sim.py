@@ -0,0 +1,200 @@
+#!/usr/bin/env python3
+"""
+stall_sim.py — 控制器停顿/崩溃后电机断力矩时间的离线仿真 (Linux, 无需硬件)
+
+按固件行为逐事件仿真, 参数直接读 sketch_feb13a/config.h 的 SUP_* 常量:
+  控制拍      每 2ms 一拍, 拍末 supervisorBeat() 打心跳, 每拍发一帧电流指令并收到 0x02 反馈
+  监督任务    核 0 每 SUP_PERIOD_MS (1 tick) 检查一次, 另有协议栈抢占抖动 --sched-jitter-ms
+  保留路径    清空发送队列 → 零电流 ×2 → CMD_OFF ×2 (1Mbps 扩展帧约 0.13ms/帧)
+  看门狗      loop/监督任务 SUP_WDT_TIMEOUT_MS 未喂狗 → panic 复位 (IDF 4.x 向上取整到秒)
+  启动断电    复位后 canInit() 发 CMD_OFF; 耗时取实测: --boot-log 给出串口日志, 解析其中
+              "[SUP] reset reason ..., motors off at Nms" 的 N, 每次仿真从实测值中抽取。
+              没有日志时退回 --boot-ms 假设值, 输出中标注 "assumed"
+
+故障场景:
+  loop       核 1 卡死 (WiFi/阻塞读寄存器/死循环), 核 0 正常 → 心跳超时
+             反馈帧也在 loop 中解析, 同时停止增长; 反馈只在心跳间隔 ≤ SUP_BEAT_FRESH_MS
+             时判定, 触发原因必须是 HEARTBEAT
+  feedback   一侧电机反馈帧中断 (线缆/电机复位)           → 反馈超时
+  hang       两核都卡死 (监督任务也不再运行)               → 看门狗复位 + 启动 CMD_OFF
+  crash      异常 panic 立即复位                           → 启动 CMD_OFF
+
+上界是需求, 不由被测参数推出:
+  --limit-ms          监督任务场景, 默认 9.9ms: 需求为个位数毫秒内断力矩 (< 10ms, 5 拍)
+  --reboot-limit-ms   复位场景, 默认 2000ms: 车已失去控制并倒地, 要求 2s 内停止持续发力
+                      (堵转发热/人手接触)
+
+对每个场景随机化故障时刻相对控制拍/监督 tick 的相位, 输出故障 → 电机收到零力矩帧的
+时间分布; 任一场景最大值超过需求或 loop 场景报错原因时返回非零退出码。
+
+    python3 tools/stall_sim.py --boot-log boot.txt
+    python3 tools/stall_sim.py --runs 20000 --boot-log boot1.txt boot2.txt --idf4
+"""
+
+import argparse
+import math
+import os
+import random
+import re
+import sys
+
+CONFIG_H = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "sketch_feb13a", "config.h")
+
+CTRL_TICK_MS = 2.0
+CAN_FRAME_MS = 0.13     # 29 位 ID + 8 字节数据 + 填充位, 1Mbps
+MOTOR_APPLY_MS = 0.2    # 电机收到帧到电流环执行
+
+
+def load_config(path):
+    vals = {}
+    pat = re.compile(r"^#define\s+(SUP_\w+)\s+\(?([-0-9.]+)f?\)?")
+    with open(path, encoding="utf-8") as f:
+        for line in f:
+            m = pat.match(line)
+            if m:
+                vals[m.group(1)] = float(m.group(2))
+    need = ["SUP_PERIOD_MS", "SUP_HEARTBEAT_MS", "SUP_FEEDBACK_MS", "SUP_BEAT_FRESH_MS", "SUP_WDT_TIMEOUT_MS"]
+    missing = [k for k in need if k not in vals]
+    if missing:
+        sys.exit(f"config.h 缺少 {', '.join(missing)}")
+    return vals
+
+
+def supervisor_checks(start, period, jitter, rng):
+    """监督任务的检查时刻: vTaskDelayUntil 按 tick 对齐, 每次可能被高优先级任务推迟。"""
+    t = start
+    while True:
+        yield t + rng.uniform(0.0, jitter)
+        t += period
+
+
+def off_latency():
+    """保留路径: 队列已清空, 第一帧零电流到达电机后力矩即归零。"""
+    return CAN_FRAME_MS + MOTOR_APPLY_MS
+
+
+def sim_loop_stall(cfg, args, rng):
+    period = cfg["SUP_PERIOD_MS"]
+    # 最后一次心跳在故障前 [0, 2ms) 内 (故障可能发生在两拍之间); 该拍解析的反馈帧
+    # 在心跳之前, 之后两侧反馈计数都不再增长。检查顺序同 supervisorTask: 心跳 (µs) → 反馈 (ms)
+    last_beat = -rng.uniform(0.0, CTRL_TICK_MS)
+    fresh_ms = None
+    for t in supervisor_checks(last_beat - CTRL_TICK_MS, period, args.sched_jitter_ms, rng):
+        if fresh_ms is None:
+            if t >= last_beat:
+                fresh_ms = math.floor(t)
+            continue
+        if t <= 0:
+            continue
+        gap = t - last_beat
+        if gap > cfg["SUP_HEARTBEAT_MS"]:
+            return t + off_latency(), "HEARTBEAT"
+        if gap <= cfg["SUP_BEAT_FRESH_MS"] and math.floor(t) - fresh_ms > cfg["SUP_FEEDBACK_MS"]:
+            return t + off_latency(), "FEEDBACK_R"
+
+
+def sim_feedback_loss(cfg, args, rng):
+    period = cfg["SUP_PERIOD_MS"]
+    # 反馈帧随每拍指令返回, 最后一帧在故障前 [0, 2ms) 内到达。监督任务在看到计数变化的
+    # 那次检查记下 millis() (1ms 分辨率), 之后 millis() 差值超过 SUP_FEEDBACK_MS 即触发
+    # loop 仍在运行, 心跳照常每拍更新
+    last_frame = -rng.uniform(0.0, CTRL_TICK_MS)
+    fresh_ms = None
+    for t in supervisor_checks(-CTRL_TICK_MS - rng.uniform(0.0, period), period, args.sched_jitter_ms, rng):
+        if fresh_ms is None:
+            if t >= last_frame:
+                fresh_ms = math.floor(t)
+            continue
+        gap = (t - last_frame) % CTRL_TICK_MS
+        if t > 0 and gap <= cfg["SUP_BEAT_FRESH_MS"] and math.floor(t) - fresh_ms > cfg["SUP_FEEDBACK_MS"]:
+            return t + off_latency(), "FEEDBACK_R"
+
+
+def wdt_timeout_ms(cfg, args):
+    ms = cfg["SUP_WDT_TIMEOUT_MS"]
+    return math.ceil(ms / 1000.0) * 1000.0 if args.idf4 else ms
+
+
+def boot_ms(args, rng):
+    if args.boot_samples:
+        return rng.choice(args.boot_samples)
+    return args.boot_ms * rng.uniform(0.95, 1.05)
+
+
+def sim_hang(cfg, args, rng):
+    # 最后一次喂狗在故障前 [0, loop 周期) 内; TWDT 由硬件定时器检查, 到期即 panic
+    last_feed = -rng.uniform(0.0, args.loop_period_ms)
+    reset_at = last_feed + wdt_timeout_ms(cfg, args)
+    return reset_at + args.panic_ms + boot_ms(args, rng) + off_latency(), "REBOOT"
+
+
+def sim_crash(cfg, args, rng):
+    return args.panic_ms + boot_ms(args, rng) + off_latency(), "REBOOT"
+
+
+def load_boot_log(paths):
+    """串口日志中每次启动的 "[SUP] ... motors off at Nms"。"""
+    pat = re.compile(r"\[SUP\] reset reason \S+, motors off at (\d+)ms")
+    xs = []
+    for path in paths:
+        with open(path, encoding="utf-8", errors="replace") as f:
+            xs += [float(m.group(1)) for m in pat.finditer(f.read())]
+    if not xs:
+        sys.exit("boot log 中没有 \"[SUP] ... motors off at Nms\" 行")
+    return xs
+
+
+def percentile(xs, q):
+    xs = sorted(xs)
+    return xs[min(len(xs) - 1, int(q * (len(xs) - 1) + 0.5))]
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("--config", default=CONFIG_H)
+    ap.add_argument("--runs", type=int, default=5000)
+    ap.add_argument("--seed", type=int, default=1)
+    ap.add_argument("--sched-jitter-ms", type=float, default=0.5, help="监督任务被 WiFi/lwIP 抢占的最大推迟")
+    ap.add_argument("--loop-period-ms", type=float, default=3.0, help="loop() 一轮的典型时长 (喂狗间隔)")
+    ap.add_argument("--boot-log", nargs="+", help="串口日志, 取其中实测的 motors off at Nms")
+    ap.add_argument("--boot-ms", type=float, default=800.0, help="无 --boot-log 时假设的启动断电时间")
+    ap.add_argument("--panic-ms", type=float, default=30.0, help="panic 处理 (打印回溯) 到芯片复位")
+    ap.add_argument("--idf4", action="store_true", help="Arduino-ESP32 2.x: TWDT 超时按整秒")
+    ap.add_argument("--limit-ms", type=float, default=9.9, help="需求: 监督任务场景 (loop/feedback) 断力矩上界")
+    ap.add_argument("--reboot-limit-ms", type=float, default=2000.0, help="需求: 复位场景 (hang/crash) 断力矩上界")
+    args = ap.parse_args()
+
+    cfg = load_config(args.config)
+    rng = random.Random(args.seed)
+    args.boot_samples = load_boot_log(args.boot_log) if args.boot_log else None
+
+    # (名称, 仿真, 需求上界, 要求的触发原因)
+    scenarios = [
+        ("loop", sim_loop_stall, args.limit_ms, "HEARTBEAT"),
+        ("feedback", sim_feedback_loss, args.limit_ms, "FEEDBACK_R"),
+        ("hang", sim_hang, args.reboot_limit_ms, "REBOOT"),
+        ("crash", sim_crash, args.reboot_limit_ms, "REBOOT"),
+    ]
+
+    if args.boot_samples:
+        boot = f"boot={min(args.boot_samples):.0f}..{max(args.boot_samples):.0f}ms (measured, n={len(args.boot_samples)})"
+    else:
+        boot = f"boot={args.boot_ms:.0f}ms (assumed, pass --boot-log)"
+    print(f"config: period={cfg['SUP_PERIOD_MS']:.0f}ms heartbeat={cfg['SUP_HEARTBEAT_MS']:.0f}ms "
+          f"feedback={cfg['SUP_FEEDBACK_MS']:.0f}ms wdt={wdt_timeout_ms(cfg, args):.0f}ms {boot}")
+    failed = False
+    for name, fn, bound, reason in scenarios:
+        res = [fn(cfg, args, rng) for _ in range(args.runs)]
+        xs = [t for t, _ in res]
+        wrong = sum(1 for _, r in res if r != reason)
+        worst = max(xs)
+        ok = worst <= bound and wrong == 0
+        failed |= not ok
+        note = f"  {wrong} tripped as other than {reason}" if wrong else ""
+        print(f"{name:9s} min={min(xs):8.2f}  p50={percentile(xs, .5):8.2f}  p99={percentile(xs, .99):8.2f}  "
+              f"max={worst:8.2f} ms   limit {bound:8.2f} ms  {'OK' if ok else 'FAIL'}{note}")
+    sys.exit(1 if failed else 0)
+
+
+if __name__ == "__main__":
+    main()
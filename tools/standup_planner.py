@@ -0,0 +1,475 @@
+#!/usr/bin/env python3
+"""
+standup_planner.py — 支架自立轨迹离线规划 (Linux, 无需硬件)
+
+从前/后支架 (-13° / +15°) 静止状态起身的时间最优电流曲线, 生成固件表
+sketch_feb13a/standup_profile.cpp, 并仿真对比现有恢复增益 (RECOVERY_KP/KD 调度)。
+
+模型: 平面轮式倒立摆 (非线性), 电机力矩作用在车身与车轮之间:
+  A·φ'' + m·r·l·cosθ·θ''  - m·r·l·sinθ·θ'² = τ
+  m·r·l·cosθ·φ'' + B·θ''  - m·g·l·sinθ     = -τ          τ = 2·Kt·I (两个电机)
+  A = Iw + (mw+m)·r²,  B = m·(k² + l²)
+参数默认按 config.h (总重, 轮径) 与手册 Kt 估计, 可用命令行覆盖。线性化后得到
+θ'' = ω0²·(θ - I/G), 与 config.h 的 PEND_OMEGA0 / PEND_GRAVITY_MA_PER_DEG 对照
+(底盘加速度与反力矩同向, 等效 G 约为静力矩折算值的一半)。
+
+规划:
+  1. 加速段 I = ±SU_PLAN_LIMIT_MA 推向竖直, 制动段反向满电流; 二分切换时刻,
+     使角速度归零时恰好到 0° (单次切换的 bang-bang 即二阶系统的时间最优解)。
+     执行器时延/一阶滞后、2ms 控制拍、表行线性插值都在仿真内, 规划的就是固件回放的。
+  2. 制动段内逐行尝试交接: PID (含增益调度) 在该状态的指令与表电流相差
+     ≤ SU_MATCH_MA, 且从该状态由 PID 接管能站稳; 取总自立时间最短的一行截断表。
+  3. 表中存 电流前馈 / 期望 pitch / 期望滤波角速度 (固件 filteredGyro 口径)。
+
+固件回放 (standup.cpp): I = 前馈 + Kp·(θ-θref) + Kd·(ω-ωref), 跟踪误差超过
+SU_ABORT_DEG 中止并交回恢复增益。本脚本按同样逻辑仿真, 并在模型参数/时延/起始角
+偏差的组合下对比:
+  自立时间  从启动到 |pitch| < SU_UPRIGHT_DEG 且 |角速度| < SU_UPRIGHT_DPS 持续 SU_UPRIGHT_HOLD_MS
+  峰值电流  单电机实际电流 |I| 最大值
+  过冲      越过 0° 到另一侧的最大角度
+规划表在任一组合下跌倒而恢复增益能站稳时返回非零退出码。
+
+    python3 tools/standup_planner.py                 # 规划 + 对比 + 写表
+    python3 tools/standup_planner.py --no-write -v   # 只看结果
+"""
+
+import argparse
+import copy
+import itertools
+import math
+import os
+import re
+import sys
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "sketch_feb13a")
+CONFIG_H = os.path.join(ROOT, "config.h")
+OUT = os.path.join(ROOT, "standup_profile.cpp")
+
+DT = 0.002
+SUBSTEPS = 4
+STAND_FWD, STAND_BACK = -13.0, 15.0
+DEG = math.pi / 180.0
+
+
+def load_config(path):
+    vals = {}
+    pat = re.compile(r"^#define\s+(\w+)\s+\(?\s*([-0-9.]+)f?\s*\)?")
+    with open(path, encoding="utf-8") as f:
+        for line in f:
+            m = pat.match(line)
+            if m:
+                try:
+                    vals[m.group(1)] = float(m.group(2))
+                except ValueError:
+                    pass
+    return vals
+
+
+# ============ 对象模型 ============
+class Plant:
+    def __init__(self, p):
+        self.r = p.wheel_mm / 2000.0
+        mw = p.wheel_mass_g / 1000.0
+        m = p.mass_g / 1000.0 - mw
+        l = p.cog_mm / 1000.0
+        k = p.gyration_mm / 1000.0
+        iw = p.wheel_inertia * mw * self.r ** 2
+        self.A = iw + (mw + m) * self.r ** 2
+        self.B = m * (k * k + l * l)
+        self.mrl = m * self.r * l
+        self.mgl = m * 9.81 * l
+        self.kt = p.kt
+
+    def linear(self):
+        """线性化: (ω0 rad/s, G mA/° 单电机)。"""
+        bp = self.B - self.mrl ** 2 / self.A
+        w0 = math.sqrt(self.mgl / bp)
+        g = self.mgl / (1.0 + self.mrl / self.A) * DEG / (2.0 * self.kt) * 1000.0
+        return w0, g
+
+    def accel(self, th, om, ma):
+        tau = 2.0 * self.kt * ma / 1000.0
+        c, s = math.cos(th), math.sin(th)
+        a12 = self.mrl * c
+        b1 = tau + self.mrl * s * om * om
+        b2 = self.mgl * s - tau
+        det = self.A * self.B - a12 * a12
+        return (self.A * b2 - a12 * b1) / det, (b1 * self.B - a12 * b2) / det
+
+
+class Sim:
+    """对象 + 执行器 (时延 + 一阶滞后) + 支架。角度 °, 角速度 °/s。"""
+
+    def __init__(self, plant, theta0, latency_ms, tau_ms):
+        self.p = plant
+        self.th = theta0
+        self.om = 0.0
+        self.wheel = 0.0   # 轮角速度 rad/s
+        self.x = 0.0       # 底盘位移 m
+        self.cur = 0.0
+        self.queue = [0.0] * max(1, int(round(latency_ms / 1000.0 / DT)))
+        self.alpha = DT / (tau_ms / 1000.0 + DT)
+
+    def step(self, cmd_ma):
+        self.queue.append(cmd_ma)
+        self.cur += (self.queue.pop(0) - self.cur) * self.alpha
+        h = DT / SUBSTEPS
+        for _ in range(SUBSTEPS):
+            th = self.th * DEG
+            om = self.om * DEG
+            ath, aph = self.p.accel(th, om, self.cur)
+            om += ath * h
+            self.wheel += aph * h
+            th += om * h
+            self.x += self.wheel * self.p.r * h
+            self.th, self.om = th / DEG, om / DEG
+            # 靠在支架上: 只能离开, 不能继续压进去
+            if self.th <= STAND_FWD and self.om < 0:
+                self.th, self.om, self.wheel = STAND_FWD, 0.0, 0.0
+            elif self.th >= STAND_BACK and self.om > 0:
+                self.th, self.om, self.wheel = STAND_BACK, 0.0, 0.0
+
+
+# ============ 固件控制器移植 ============
+def gs_mul(c, pitch_abs):
+    """默认增益调度表的 pitch 轴: 0/5° = 1.0, ≥ RECOVERY_ENTER_ANGLE 的格点 (10/15°) = 恢复倍率。"""
+    kp_rec = c["RECOVERY_KP"] / c["DEFAULT_KP"]
+    kd_rec = c["RECOVERY_KD"] / c["DEFAULT_KD"]
+    step = c["GS_PITCH_STEP"]
+    cells = [(1.0, 1.0) if i * step < c["RECOVERY_ENTER_ANGLE"] else (kp_rec, kd_rec)
+             for i in range(int(c["GS_PITCH_N"]))]
+    u = min(max(pitch_abs / step, 0.0), len(cells) - 1 - 1e-4)
+    i = int(u)
+    f = u - i
+    return (cells[i][0] + (cells[i + 1][0] - cells[i][0]) * f,
+            cells[i][1] + (cells[i + 1][1] - cells[i][1]) * f)
+
+
+class Pid:
+    """balanceControl 的角度环 (目标角 0, 位置/速度外环在保护期内不工作)。"""
+
+    def __init__(self, c):
+        self.c = c
+        self.integral = 0.0
+
+    def ma(self, pitch, gyro_f):
+        c = self.c
+        if abs(pitch) < c["INTEGRAL_DECAY_THRESHOLD"]:
+            self.integral += pitch * DT
+        else:
+            self.integral *= c["INTEGRAL_DECAY_RATE"]
+        self.integral = max(-c["INTEGRAL_LIMIT"], min(c["INTEGRAL_LIMIT"], self.integral))
+        mkp, mkd = gs_mul(c, abs(pitch))
+        d = max(-c["D_LIMIT"], min(c["D_LIMIT"], c["DEFAULT_KD"] * mkd * gyro_f))
+        out = c["DEFAULT_KP"] * mkp * pitch + c["DEFAULT_KI"] * self.integral + d
+        out = max(-c["OUTPUT_LIMIT"], min(c["OUTPUT_LIMIT"], out))
+        return out * c["CURRENT_MODE_GAIN_MA_PER_RPM"]
+
+
+def table_at(rows, row_s, t):
+    """表行线性插值 (与 standup.cpp 相同), 返回 (ma, pitch, rate) 或 None (表已结束)。"""
+    u = t / row_s
+    i = int(u)
+    if i >= len(rows) - 1:
+        return None
+    f = u - i
+    a, b = rows[i], rows[i + 1]
+    return tuple(a[k] + (b[k] - a[k]) * f for k in range(3))
+
+
+def episode(c, plant, theta0, rows, row_s, args, start_t=0.0):
+    """一次自立: rows=None 为现有恢复增益。返回指标字典。"""
+    lim = c["CURRENT_MODE_LIMIT_MA"]
+    gain = c["CURRENT_MODE_GAIN_MA_PER_RPM"]
+    sim = Sim(plant, theta0, args.latency_ms, args.motor_tau_ms)
+    pid = Pid(c)
+    gyro_f = 0.0
+    mode = "plan" if rows else "pid"
+    grace_t = 0.0
+    res = {"mode": "PID", "up_ms": None, "peak": 0.0, "over": 0.0, "travel": 0.0,
+           "handover_ms": None, "max_err": 0.0, "fell": False}
+    if rows:
+        res["mode"] = "PLAN"
+    hold = 0
+    confirm = 0
+    side = -1.0 if theta0 < 0 else 1.0
+    for k in range(int(c["SU_OBSERVE_MS"] / 1000.0 / DT)):
+        t = k * DT
+        gyro_f = c["GYRO_LPF_ALPHA"] * gyro_f + (1 - c["GYRO_LPF_ALPHA"]) * sim.om
+        pitch = sim.th
+        pd = pid.ma(pitch, gyro_f)
+        cmd = pd
+        if mode == "plan":
+            ref = table_at(rows, row_s, t)
+            if ref is None:
+                mode, grace_t = "pid", t
+                res["handover_ms"] = t * 1000.0
+            else:
+                err = pitch - ref[1]
+                res["max_err"] = max(res["max_err"], abs(err))
+                if abs(err) > c["SU_ABORT_DEG"]:
+                    mode, grace_t = "pid", t
+                    res["mode"] = "ABORT"
+                else:
+                    cmd = ref[0] + (c["DEFAULT_KP"] * err + c["DEFAULT_KD"] * (gyro_f - ref[2])) * gain
+        cmd = max(-lim, min(lim, cmd))
+        # 保护期: 从启动 / 交接 / 中止起, |pitch| < RECOVERY_EXIT_ANGLE 或超时后恢复跌倒检测
+        if mode == "pid":
+            in_grace = (grace_t is not None and abs(pitch) >= c["RECOVERY_EXIT_ANGLE"]
+                        and t - grace_t < c["STANDUP_GRACE_MS"] / 1000.0)
+            if not in_grace:
+                grace_t = None
+                confirm = confirm + 1 if abs(pitch) > c["FALL_ANGLE"] else 0
+                if confirm >= c["FALL_CONFIRM_COUNT"]:
+                    res["fell"] = True
+                    break
+        sim.step(cmd)
+        res["peak"] = max(res["peak"], abs(sim.cur))
+        res["over"] = max(res["over"], sim.th * -side)
+        if abs(sim.th) < c["SU_UPRIGHT_DEG"] and abs(sim.om) < c["SU_UPRIGHT_DPS"]:
+            hold += 1
+            if hold * DT * 1000.0 >= c["SU_UPRIGHT_HOLD_MS"] and res["up_ms"] is None:
+                res["up_ms"] = (t + DT - hold * DT) * 1000.0 + start_t * 1000.0
+                res["travel"] = sim.x
+                break
+        else:
+            hold = 0
+    return res
+
+
+# ============ 规划 ============
+def bang_rows(theta0, plan_ma, t_sw, n_rows, row_s):
+    """bang-bang 前馈按表行采样; 切换所在行取线性混合, 回放插值后等效于精确切换时刻。"""
+    s = 1.0 if theta0 > 0 else -1.0
+    acc, brk = s * plan_ma, -s * plan_ma
+    out = []
+    for i in range(n_rows):
+        t0 = i * row_s
+        if t0 + row_s <= t_sw:
+            out.append(acc)
+        elif t0 >= t_sw:
+            out.append(brk)
+        else:
+            f = (t_sw - t0) / row_s
+            out.append(brk + (acc - brk) * f)
+    return out
+
+
+def open_loop(c, plant, theta0, ff, row_s, args, until_stop=False):
+    """按前馈开环回放, 返回每个控制拍的 (t, pitch, rate, gyro_f, sim 快照)。"""
+    sim = Sim(plant, theta0, args.latency_ms, args.motor_tau_ms)
+    gyro_f = 0.0
+    traj = []
+    s = 1.0 if theta0 > 0 else -1.0
+    started = False
+    n = int((len(ff) - 1) * row_s / DT)
+    for k in range(n):
+        t = k * DT
+        gyro_f = c["GYRO_LPF_ALPHA"] * gyro_f + (1 - c["GYRO_LPF_ALPHA"]) * sim.om
+        traj.append((t, sim.th, sim.om, gyro_f))
+        u = k * DT / row_s
+        i = int(u)
+        cmd = ff[i] + (ff[i + 1] - ff[i]) * (u - i)
+        sim.step(cmd)
+        if until_stop:
+            moving = sim.om * -s > 0
+            started |= moving
+            if started and not moving:
+                return traj, sim.th
+            if abs(sim.th) > 45.0:
+                return traj, -s * 90.0
+    return traj, None
+
+
+def plan_side(c, plant, theta0, args):
+    row_s = args.row_ms / 1000.0
+    plan_ma = c["SU_PLAN_LIMIT_MA"]
+    n_rows = int(1.0 / row_s)
+    s = 1.0 if theta0 > 0 else -1.0
+
+    def stop_angle(t_sw):
+        _, th = open_loop(c, plant, theta0, bang_rows(theta0, plan_ma, t_sw, n_rows, row_s), row_s,
+                          args, until_stop=True)
+        # 停在 0° 的哪一侧: 越过 (多加速) 为正
+        return (th if th is not None else s * 90.0) * -s
+
+    lo, hi = 0.0, 0.8
+    if stop_angle(hi) < 0:
+        sys.exit(f"{theta0:+.0f}°: {plan_ma:.0f}mA 无法起身 (规划电流不足)")
+    for _ in range(40):
+        mid = 0.5 * (lo + hi)
+        if stop_angle(mid) < 0:
+            lo = mid
+        else:
+            hi = mid
+    t_sw = hi
+    ff = bang_rows(theta0, plan_ma, t_sw, n_rows, row_s)
+    traj, _ = open_loop(c, plant, theta0, ff, row_s, args, until_stop=True)
+    t_stop = traj[-1][0]
+
+    # 表行参考 (期望 pitch / 期望滤波角速度)
+    per_row = int(round(row_s / DT))
+    full = []
+    for i in range(len(traj) // per_row + 1):
+        k = min(i * per_row, len(traj) - 1)
+        full.append((ff[i], traj[k][1], traj[k][3]))
+
+    # 制动段逐行尝试交接, 取总自立时间最短者
+    best = None
+    sw_row = int(t_sw / row_s)
+    for j in range(sw_row + 1, len(full)):
+        rows = full[:j + 1]
+        r = episode(c, plant, theta0, rows, row_s, args)
+        if r["fell"] or r["up_ms"] is None or r["mode"] != "PLAN":
+            continue
+        # 交接拍的 PID 指令与表电流
+        pid = Pid(c)
+        gf = 0.0
+        for k in range(j * per_row + 1):
+            tk = traj[min(k, len(traj) - 1)]
+            gf = tk[3]
+            pd = pid.ma(tk[1], gf)
+        pd = max(-c["CURRENT_MODE_LIMIT_MA"], min(c["CURRENT_MODE_LIMIT_MA"], pd))
+        if abs(pd - full[j][0]) > c["SU_MATCH_MA"]:
+            continue
+        if r["over"] > args.max_overshoot:
+            continue
+        if best is None or r["up_ms"] < best[1]["up_ms"]:
+            best = (j, r, pd)
+    if best is None:
+        sys.exit(f"{theta0:+.0f}°: 制动段内找不到 PID 指令匹配 (±{c['SU_MATCH_MA']:.0f}mA) 且能站稳的交接点")
+    j, r, pd = best
+    return {"theta0": theta0, "t_sw": t_sw, "t_stop": t_stop, "rows": full[:j + 1], "row_s": row_s,
+            "handover_pd": pd, "nominal": r}
+
+
+# ============ 输出 ============
+def write_table(path, plans, lin, args, c):
+    w0, g = lin
+    lines = [
+        "// 由 tools/standup_planner.py 生成, 请勿手改",
+        f"// 模型 ω0={w0:.1f}rad/s G={g:.1f}mA/°, 规划电流 {c['SU_PLAN_LIMIT_MA']:.0f}mA, "
+        f"时延 {args.latency_ms:.1f}ms + τ {args.motor_tau_ms:.1f}ms",
+        "#include \"standup_profile.h\"",
+        "",
+        f"const uint16_t SU_ROW_MS = {args.row_ms};",
+    ]
+    for name, p in plans:
+        lines.append("")
+        lines.append(f"// 起点 {p['theta0']:+.1f}°: 切换 {p['t_sw'] * 1000:.1f}ms, "
+                     f"交接 {(len(p['rows']) - 1) * args.row_ms}ms (PID {p['handover_pd']:.0f}mA)")
+        lines.append(f"static const StandupRow ROWS_{name}[] = {{")
+        for ma, th, om in p["rows"]:
+            lines.append(f"  {{{int(round(ma)):5d}, {int(round(th * 100)):6d}, {int(round(om * 10)):6d}}},")
+        lines.append("};")
+    lines.append("")
+    for name, p in plans:
+        lines.append(f"const StandupProfile SU_PROFILE_{name} = {{{int(round(p['theta0'] * 100))}, "
+                     f"{len(p['rows'])}, ROWS_{name}}};")
+    with open(path, "w", newline="\n") as f:
+        f.write("\n".join(lines) + "\n")
+    size = sum(len(p["rows"]) for _, p in plans) * 6
+    print(f"{os.path.relpath(path)}: {size} 字节表", file=sys.stderr)
+
+
+def fmt(r):
+    up = f"{r['up_ms']:5.0f}ms" if r["up_ms"] is not None else ("  跌倒" if r["fell"] else "  未稳")
+    return f"{r['mode']:5s} {up}  峰值 {r['peak']:5.0f}mA  过冲 {max(r['over'], 0):4.1f}°  位移 {r['travel'] * 1000:4.0f}mm"
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("--config", default=CONFIG_H)
+    ap.add_argument("--out", default=OUT)
+    ap.add_argument("--no-write", action="store_true", help="只仿真对比, 不写表")
+    ap.add_argument("--row-ms", type=int, default=4, help="表行间隔 (控制拍 2ms 的整数倍)")
+    ap.add_argument("--mass-g", type=float, default=None, help="总重 (默认 ROBOT_WEIGHT_G)")
+    ap.add_argument("--wheel-mm", type=float, default=None, help="轮径 (默认 WHEEL_DIAMETER_MM)")
+    ap.add_argument("--wheel-mass-g", type=float, default=120.0, help="两侧转子+轮毂+轮胎")
+    ap.add_argument("--wheel-inertia", type=float, default=0.6, help="轮惯量 / (m·r²)")
+    ap.add_argument("--cog-mm", type=float, default=60.0, help="重心到轮轴")
+    ap.add_argument("--gyration-mm", type=float, default=40.0, help="车身绕重心的回转半径")
+    ap.add_argument("--kt", type=float, default=0.070, help="力矩常数 N·m/A (motor_charact.py 的 Kt)")
+    ap.add_argument("--latency-ms", type=float, default=2.0, help="指令到电流开始变化")
+    ap.add_argument("--motor-tau-ms", type=float, default=1.0, help="电流环一阶时间常数")
+    ap.add_argument("--max-overshoot", type=float, default=3.0, help="交接后允许越过 0° 的角度")
+    ap.add_argument("-v", "--verbose", action="store_true")
+    args = ap.parse_args()
+
+    c = load_config(args.config)
+    if args.mass_g is None:
+        args.mass_g = c["ROBOT_WEIGHT_G"]
+    if args.wheel_mm is None:
+        args.wheel_mm = c["WHEEL_DIAMETER_MM"]
+    if args.row_ms % 2:
+        sys.exit("--row-ms 必须是控制拍 (2ms) 的整数倍")
+
+    plant = Plant(args)
+    w0, g = plant.linear()
+    print(f"线性化: ω0 = {w0:.1f} rad/s, G = {g:.1f} mA/° "
+          f"(config: PEND_OMEGA0 {c.get('PEND_OMEGA0', float('nan')):.1f}, "
+          f"PEND_GRAVITY_MA_PER_DEG {c.get('PEND_GRAVITY_MA_PER_DEG', float('nan')):.1f})")
+    for key, val in (("PEND_OMEGA0", w0), ("PEND_GRAVITY_MA_PER_DEG", g)):
+        if key in c and abs(c[key] - val) > 0.1 * val:
+            print(f"  注意: {key} 与模型相差超过 10%, 跌倒预测与规划表用的不是同一模型")
+
+    plans = [("FWD", plan_side(c, plant, STAND_FWD, args)),
+             ("BACK", plan_side(c, plant, STAND_BACK, args))]
+
+    failed = False
+    for name, p in plans:
+        rows, row_s = p["rows"], p["row_s"]
+        old = episode(c, plant, p["theta0"], None, row_s, args)
+        new = p["nominal"]
+        print(f"\n{name} {p['theta0']:+.0f}°  切换 {p['t_sw'] * 1000:.0f}ms  交接 {(len(rows) - 1) * args.row_ms}ms "
+              f"({len(rows)} 行)")
+        print(f"  恢复增益  {fmt(old)}")
+        print(f"  规划表    {fmt(new)}")
+
+        # 失配扫描: Kt (G), 回转半径/重心 (ω0), 时延, 起始角
+        stats = {"n": 0, "plan_up": [], "old_up": [], "abort": 0, "plan_fell": 0, "old_fell": 0,
+                 "plan_peak": 0.0, "old_peak": 0.0}
+        for kt, gy, cog, lat, d0 in itertools.product((0.85, 1.0, 1.15), (0.8, 1.0, 1.25), (0.85, 1.0, 1.15),
+                                                      (1.0, 2.0, 4.0), (-1.5, 0.0, 1.5)):
+            a = copy.copy(args)
+            a.kt, a.gyration_mm, a.cog_mm, a.latency_ms = args.kt * kt, args.gyration_mm * gy, \
+                args.cog_mm * cog, lat
+            pl = Plant(a)
+            th0 = max(-17.0, min(17.0, p["theta0"] + d0))
+            stand = STAND_FWD if th0 < 0 else STAND_BACK
+            th0 = max(th0, stand) if th0 < 0 else min(th0, stand)
+            rn = episode(c, pl, th0, rows, row_s, a)
+            ro = episode(c, pl, th0, None, row_s, a)
+            stats["n"] += 1
+            stats["abort"] += rn["mode"] == "ABORT"
+            stats["plan_fell"] += rn["up_ms"] is None
+            stats["old_fell"] += ro["up_ms"] is None
+            if rn["up_ms"] is not None:
+                stats["plan_up"].append(rn["up_ms"])
+                stats["plan_peak"] = max(stats["plan_peak"], rn["peak"])
+            if ro["up_ms"] is not None:
+                stats["old_up"].append(ro["up_ms"])
+                stats["old_peak"] = max(stats["old_peak"], ro["peak"])
+            if rn["up_ms"] is None and ro["up_ms"] is not None:
+                failed = True
+                print(f"  失败: Kt×{kt} k×{gy} l×{cog} 时延 {lat}ms 起点 {th0:+.1f}°  规划 {fmt(rn)} / 恢复 {fmt(ro)}")
+            elif args.verbose:
+                print(f"    Kt×{kt:4.2f} k×{gy:4.2f} l×{cog:4.2f} {lat:.0f}ms {th0:+5.1f}°  "
+                      f"{fmt(rn)}  |  {fmt(ro)}")
+
+        def avg(xs):
+            return sum(xs) / len(xs) if xs else float("nan")
+
+        print(f"  失配扫描 {stats['n']} 组: 规划表 平均 {avg(stats['plan_up']):.0f}ms 最长 "
+              f"{max(stats['plan_up'] or [float('nan')]):.0f}ms 峰值 {stats['plan_peak']:.0f}mA "
+              f"中止 {stats['abort']} 未站稳 {stats['plan_fell']}  |  恢复增益 平均 {avg(stats['old_up']):.0f}ms "
+              f"最长 {max(stats['old_up'] or [float('nan')]):.0f}ms 峰值 {stats['old_peak']:.0f}mA "
+              f"未站稳 {stats['old_fell']}")
+
+    if not args.no_write:
+        write_table(args.out, plans, (w0, g), args, c)
+    sys.exit(1 if failed else 0)
+
+
+if __name__ == "__main__":
+    main()
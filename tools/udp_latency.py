@@ -0,0 +1,125 @@
+#!/usr/bin/env python3
+"""
+udp_latency.py — UDP 通道端到端时延/抖动测试
+
+测两条路径:
+  transport  PING → PONG 往返 (纯网络 + udpLoop 调度)
+  command    摇杆包发出 → 遥测中回传该包序号 (进入 joystick_input 并被下一帧遥测带回)
+输出 p50/p90/p99/max 与丢包率。
+
+    python3 tools/udp_latency.py 192.168.1.50 --seconds 20 --rate 50
+    python3 tools/udp_latency.py --loopback          # 本机模拟机器人, 校验客户端库与统计
+
+--loopback 在 127.0.0.1 上起一个按相同协议应答的模拟端 (含 2ms 控制拍量化),
+用于在没有硬件时验证测试工具本身。
+"""
+
+import argparse
+import socket
+import struct
+import threading
+import time
+
+import mbot_udp as mu
+
+
+def percentile(xs, q):
+    if not xs:
+        return float("nan")
+    xs = sorted(xs)
+    return xs[min(len(xs) - 1, int(q * (len(xs) - 1) + 0.5))]
+
+
+def summary(name, xs, sent=None):
+    lost = f"{100.0 * (1 - len(xs) / sent):5.1f}%" if sent else "    -"
+    print(f"{name:9s} n={len(xs):5d} lost={lost}  "
+          f"p50={percentile(xs, .5):6.2f}  p90={percentile(xs, .9):6.2f}  "
+          f"p99={percentile(xs, .99):6.2f}  max={max(xs) if xs else float('nan'):6.2f} ms  "
+          f"jitter(p99-p50)={percentile(xs, .99) - percentile(xs, .5):5.2f} ms")
+
+
+def fake_robot(port, stop):
+    """按 udp_transport.cpp 行为应答: PONG 立即回, JOY 在下一控制拍生效, 遥测按订阅周期。"""
+    s = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    s.bind(("127.0.0.1", port))
+    s.settimeout(0.001)
+    sub, period, last_tx, seq = None, 0, 0.0, 0
+    joy_seq, joy_ms, pending = 0, 0, None
+    t0 = time.monotonic()
+    while not stop.is_set():
+        try:
+            data, addr = s.recvfrom(256)
+            magic, ver, ptype, pseq, ms = mu.HDR.unpack_from(data)
+            if ptype == mu.PING:
+                us = int((time.monotonic() - t0) * 1e6) & 0xFFFFFFFF
+                s.sendto(mu.HDR.pack(b"MB", 1, mu.PONG, pseq, ms) + struct.pack("<I", us), addr)
+            elif ptype == mu.SUB:
+                sub, period = addr, struct.unpack_from("<H", data, mu.HDR.size)[0] / 1000.0
+            elif ptype == mu.JOY:
+                tick = 0.002
+                pending = (pseq, ms, (int(time.monotonic() / tick) + 1) * tick)
+        except socket.timeout:
+            pass
+        now = time.monotonic()
+        if pending and now >= pending[2]:
+            joy_seq, joy_ms, pending = pending[0], pending[1], None
+        if sub and period and now - last_tx >= period:
+            last_tx = now
+            seq = (seq + 1) & 0xFFFF
+            body = mu.TELEM.pack(0, 0, 0, 0, 0, 0, 0, 0, 0, 2.0, joy_seq, joy_ms, 2)
+            s.sendto(mu.HDR.pack(b"MB", 1, mu.TELEM_T, seq, int(now * 1000) & 0xFFFFFFFF) + body, sub)
+    s.close()
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("host", nargs="?", default="127.0.0.1")
+    ap.add_argument("--port", type=int, default=mu.PORT)
+    ap.add_argument("--seconds", type=float, default=10.0)
+    ap.add_argument("--rate", type=float, default=50.0, help="摇杆/PING 发送频率 (Hz)")
+    ap.add_argument("--telem-ms", type=int, default=5, help="遥测订阅周期 (ms)")
+    ap.add_argument("--loopback", action="store_true", help="本机模拟机器人")
+    args = ap.parse_args()
+
+    stop = threading.Event()
+    if args.loopback:
+        args.host = "127.0.0.1"
+        threading.Thread(target=fake_robot, args=(args.port, stop), daemon=True).start()
+        time.sleep(0.1)
+
+    bot = mu.MbotUdp(args.host, args.port)
+    bot.subscribe(args.telem_ms)
+    # 摇杆幅值为 0: 只测时延, 不让机器人移动
+    joy_sent, ping_sent = {}, {}
+    cmd_lat, rtt = [], []
+    period = 1.0 / args.rate
+    next_tx = time.monotonic()
+    end = next_tx + args.seconds
+    while time.monotonic() < end:
+        now = time.monotonic()
+        if now >= next_tx:
+            next_tx += period
+            seq, _ = bot.joystick(0, 0)
+            joy_sent[seq] = now
+            pseq, _ = bot.ping()
+            ping_sent[pseq] = now
+        t = bot.poll(0.0005)
+        if t and t["joySeq"] in joy_sent:
+            cmd_lat.append((time.monotonic() - joy_sent.pop(t["joySeq"])) * 1000.0)
+        for pseq in list(bot.pongs):
+            if pseq in ping_sent:
+                rtt.append((bot.pongs[pseq][0] - ping_sent[pseq]) * 1000.0)
+                del ping_sent[pseq]
+            del bot.pongs[pseq]
+
+    sent = int(args.seconds * args.rate)
+    summary("transport", rtt, sent)
+    # 命令时延: 同一遥测周期内被后续包覆盖的摇杆包不会被回传, 不计为丢失
+    summary("command", cmd_lat)
+    print(f"stale telemetry dropped: {bot.dropped_stale}")
+    bot.close()
+    stop.set()
+
+
+if __name__ == "__main__":
+    main()